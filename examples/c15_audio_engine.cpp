@@ -49,7 +49,7 @@
 using namespace std;
 
 //TODO: Glbal Variables are bad (even in a namespace)
-std::shared_ptr<Nl::StopWatch> sw(new Nl::StopWatch("AudioCallback", 10000, Nl::StopWatch::SUMMARY));
+std::shared_ptr<Nl::StopWatch> sw(new Nl::StopWatch("AudioCallback", Nl::StopWatch::SUMMARY));
 
 //
 //#include "c15_audio_engine/soundgenerator.h"
@@ -60,7 +60,7 @@ void usage(const char* name)
                  "   " << name << ":" << std::endl <<
                  "        -s" << " Samplerate in Hz (default=48000)" << std::endl <<
                  "        -v" << " Voice count (default=20)" << std::endl <<
-                 "        -t" << " Mode" << std::endl <<
+                 "        -t" << " Mode (0=minisynth, 1=dsp host on alsa, 2=dsp host on jack)" << std::endl <<
                  "        -a" << " Audio Device" << std::endl <<
                  "        -m" << " Midi Device" << std::endl;
 
@@ -182,24 +182,35 @@ int main(int argc, char **argv)
             std::cout << "Nl::DSP_HOST_HANDLE::dspHostTCDControl()" << std::endl;
             handle = Nl::DSP_HOST_HANDLE::dspHostTCDControl(audioOut, midiIn, buffersize, samplerate, polyphony);
             break;
+        case 2:
+            std::cout << "Nl::DSP_HOST_HANDLE::dspHostJackControl()" << std::endl;
+            handle = Nl::DSP_HOST_HANDLE::dspHostJackControl(audioOut, midiIn, buffersize, polyphony);
+            break;
         default:
             std::cout << ">>> INVALID MODE <<<" << std::endl;
             exit(EXIT_FAILURE);
         }
 
+        // Every callback, that takes longer than one periode, is counted as a deadline miss
+        if (handle.audioOutput) {
+            const double periode = static_cast<double>(handle.audioOutput->getBuffersize()) / handle.audioOutput->getBufferCount()
+                    / handle.audioOutput->getSamplerate();
+            sw->setDeadline(std::chrono::nanoseconds(static_cast<int64_t>(periode * 1e9)));
+        }
+
         // Wait for user to exit by pressing 'q'
         // Print buffer statistics on other keys
-        // TODO: We might have a deadlock here:
-        //		 sw.printSummary() holds a lock
-        //		 audioXX->getStats() holds a lock
-        //		 inMidiBuffer->getStats() holds a lock
-        //	     The calls should happen in this order. Otherwise we trigger
-        //		 a deadlock with the audio callback.
+        // Printing the StopWatch does not lock the audio callback, it only drains the histograms.
+        // TODO: audioXX->getStats() and inMidiBuffer->getStats() still hold a lock, that is shared
+        //       with the audio thread.
 
         while(getchar() != 'q')
         {
             std::cout << *sw << std::endl;
 
+            if (opts[OPT_MODE] == 1 || opts[OPT_MODE] == 2)
+                std::cout << Nl::DSP_HOST_HANDLE::getVoiceStatistics() << std::endl;
+
             if (handle.audioOutput) std::cout << "Audio: Output Statistics:" << std::endl
                                               << handle.audioOutput->getStats() << std::endl;
             if (handle.audioInput) std::cout << "Audio: Input Statistics:" << std::endl
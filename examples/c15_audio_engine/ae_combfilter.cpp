@@ -25,7 +25,7 @@ ae_combfilter::ae_combfilter()
 /** @brief
 *******************************************************************************/
 
-void ae_combfilter::init(float _samplerate, uint32_t _vn)
+void ae_combfilter::init(float _samplerate, uint32_t _vn, EngineArena &_arena)
 {
     m_sampleComb = 0.f;
     m_decayStateVar = 0.f;
@@ -52,9 +52,9 @@ void ae_combfilter::init(float _samplerate, uint32_t _vn)
 
     //***************************** Delay ************************************//
     m_delayBufferInd = 0;
-    m_delayBuffer = {};
+    m_delayBuffer.init(_arena, DelayLine::sizeFor(COMB_MAX_DELAY_TIME * _samplerate));
 
-    m_delayFreqClip = _samplerate / (COMB_BUFFER_SIZE - 2);
+    m_delayFreqClip = _samplerate / (m_delayBuffer.mSize - 2);
     m_delayConst = 0.693147f / (0.0025f * _samplerate);          // 25ms
     m_delaySamples = 0.f;
     m_delayStateVar = 0.f;
@@ -73,11 +73,47 @@ void ae_combfilter::setDelaySmoother()
 }
 
 
+
+/******************************************************************************/
+/** @brief    clears all rendering states and the delay buffer (idle voice,
+              triggered again)
+*******************************************************************************/
+
+void ae_combfilter::resetDSP()
+{
+    m_sampleComb = 0.f;
+    m_decayStateVar = 0.f;
+
+    m_hpInStateVar  = 0.f;
+    m_hpOutStateVar = 0.f;
+    m_lpStateVar    = 0.f;
+
+    m_apStateVar_1  = 0.f;
+    m_apStateVar_2  = 0.f;
+    m_apStateVar_3  = 0.f;
+    m_apStateVar_4  = 0.f;
+
+    m_delayBuffer.clear();
+}
+
+
+
+/******************************************************************************/
+/** @brief    memory of the module, the delay buffer lives in the arena of the
+              host
+*******************************************************************************/
+
+size_t ae_combfilter::footprint() const
+{
+    return sizeof(ae_combfilter) + m_delayBuffer.footprint();
+}
+
+
 /******************************************************************************/
 /** @brief
 *******************************************************************************/
 
-void ae_combfilter::applyCombfilter(float _sampleA, float _sampleB, float *_signal)
+void ae_combfilter::applyCombfilter(float _sampleA, float _sampleB, voice_signal _signal)
 {
     float tmpVar;
 
@@ -188,9 +224,9 @@ void ae_combfilter::applyCombfilter(float _sampleA, float _sampleB, float *_sign
     /// hier kommt voicestealing hin!!
 
     tmpVar -= 1.f;
-    if (tmpVar > COMB_BUFFER_SIZE_M3)
+    if (tmpVar > m_delayBuffer.mMask - 2)
     {
-        tmpVar = COMB_BUFFER_SIZE_M3;
+        tmpVar = m_delayBuffer.mMask - 2;
     }
     else if (tmpVar < 1.f)
     {
@@ -210,10 +246,10 @@ void ae_combfilter::applyCombfilter(float _sampleA, float _sampleB, float *_sign
     ind_tp1 = m_delayBufferInd - ind_tp1;
     ind_tp2 = m_delayBufferInd - ind_tp2;
 
-    ind_tm1 &= COMB_BUFFER_SIZE_M1;                             // Wrap with a mask sampleBuffer.size()-1
-    ind_t0  &= COMB_BUFFER_SIZE_M1;
-    ind_tp1 &= COMB_BUFFER_SIZE_M1;
-    ind_tp2 &= COMB_BUFFER_SIZE_M1;
+    ind_tm1 &= m_delayBuffer.mMask;                             // Wrap with a mask sampleBuffer.size()-1
+    ind_t0  &= m_delayBuffer.mMask;
+    ind_tp1 &= m_delayBuffer.mMask;
+    ind_tp2 &= m_delayBuffer.mMask;
 
     m_sampleComb = NlToolbox::Math::interpolRT(delaySamples_fract,          // Interpolation
                                                m_delayBuffer[ind_tm1],
@@ -226,7 +262,7 @@ void ae_combfilter::applyCombfilter(float _sampleA, float _sampleB, float *_sign
     /// Envelope for voicestealingtmpVar
 
 
-    m_delayBufferInd = (m_delayBufferInd + 1) & COMB_BUFFER_SIZE_M1;      // increase index and check boundaries
+    m_delayBufferInd = (m_delayBufferInd + 1) & m_delayBuffer.mMask;      // increase index and check boundaries
 
     tmpVar = _signal[CMB_BYP];                                            // Bypass
     m_sampleComb = tmpVar * holdsample + (1.f - tmpVar) * m_sampleComb;
@@ -241,7 +277,7 @@ void ae_combfilter::applyCombfilter(float _sampleA, float _sampleB, float *_sign
 /** @brief
 *******************************************************************************/
 
-void ae_combfilter::setCombfilter(float *_signal, float _samplerate)
+void ae_combfilter::setCombfilter(voice_signal _signal, float _samplerate)
 {
     //********************** Highpass Coefficients *************************//
     float frequency = _signal[CMB_FRQ];
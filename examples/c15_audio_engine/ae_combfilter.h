@@ -9,13 +9,11 @@
 
 #pragma once
 
-#include <array>
 #include "nltoolbox.h"
-#include "dsp_defines_signallabels.h"
+#include "dsp_shared_signal.h"
+#include "delay_line.h"
 
-#define COMB_BUFFER_SIZE    8192
-#define COMB_BUFFER_SIZE_M1 8191
-#define COMB_BUFFER_SIZE_M3 8189
+#define COMB_MAX_DELAY_TIME 0.17f       // longest delay in seconds (the lowest comb frequency is about 6 Hz)
 
 struct ae_combfilter
 {
@@ -32,10 +30,12 @@ struct ae_combfilter
     float m_freqClip_4;
     float m_freqClip_24576;
 
-    void init(float _samplerate, uint32_t _vn);
-    void applyCombfilter(float _sampleA, float _sampleB, float *_signal);
-    void setCombfilter(float *_signal, float _samplerate);
+    void init(float _samplerate, uint32_t _vn, EngineArena &_arena);     // the delay buffer is taken from the arena
+    void applyCombfilter(float _sampleA, float _sampleB, voice_signal _signal);
+    void setCombfilter(voice_signal _signal, float _samplerate);
     void setDelaySmoother();
+    void resetDSP();
+    size_t footprint() const;                                           // memory of the module including its delay buffer
 
     //**************************** Highpass Filter ****************************//
     float m_hpCoeff_b0, m_hpCoeff_b1, m_hpCoeff_a1;
@@ -54,7 +54,7 @@ struct ae_combfilter
 
     //****************************** Delay/ Decay *****************************//
     uint32_t m_delayBufferInd;
-    std::array<float, COMB_BUFFER_SIZE> m_delayBuffer;
+    DelayLine m_delayBuffer;                                            // sized for the lowest comb frequency at the sample rate
 
     float m_delaySamples;
     float m_delayFreqClip;
@@ -28,11 +28,16 @@ void ae_outputmixer::init(float _samplerate, uint32_t _numberOfVoices)
 {
     m_sampleL = 0.f;
     m_sampleR = 0.f;
+    m_voiceSampleL = 0.f;
+    m_voiceSampleR = 0.f;
 
     m_warpedConst_30hz = (6.28319f / _samplerate) * 30.f;
 
     m_stateVarL.assign(_numberOfVoices, 0.f);
     m_stateVarR.assign(_numberOfVoices, 0.f);
+    m_peak.assign(_numberOfVoices, 0.f);
+    m_fade.assign(_numberOfVoices, 1.f);
+    m_fadeStep.assign(_numberOfVoices, 0.f);
 
     m_highpass_L.initFilter(_samplerate, NlToolbox::Conversion::pitch2freq(8.f));
     m_highpass_R.initFilter(_samplerate, NlToolbox::Conversion::pitch2freq(8.f));
@@ -44,8 +49,14 @@ void ae_outputmixer::init(float _samplerate, uint32_t _numberOfVoices)
 /** @brief
 *******************************************************************************/
 
-void ae_outputmixer::mixAndShape(float _sampleA, float _sampleB, float _sampleComb, float _sampleSVFilter, float *_signal, uint32_t _voiceID)
+void ae_outputmixer::mixAndShape(float _sampleA, float _sampleB, float _sampleComb, float _sampleSVFilter, voice_signal _signal, uint32_t _voiceID)
 {
+    //*************************** Voice Activity *****************************//
+    float peak = NlToolbox::Clipping::floatMax(m_peak[_voiceID], fabs(_sampleA));
+    peak = NlToolbox::Clipping::floatMax(peak, fabs(_sampleB));
+    peak = NlToolbox::Clipping::floatMax(peak, fabs(_sampleComb));
+    m_peak[_voiceID] = NlToolbox::Clipping::floatMax(peak, fabs(_sampleSVFilter));
+
     //******************************* Left Mix *******************************//
     float mainSample = _signal[OUT_A_L] * _sampleA
                      + _signal[OUT_B_L] * _sampleB
@@ -65,7 +76,7 @@ void ae_outputmixer::mixAndShape(float _sampleA, float _sampleB, float _sampleCo
 
     mainSample = NlToolbox::Others::parAsym(mainSample, tmpVar, _signal[OUT_ASM]);
 
-    m_sampleL += mainSample;
+    m_voiceSampleL = mainSample * m_fade[_voiceID];
 
     //****************************** Right Mix *******************************//
     mainSample = _signal[OUT_A_R] * _sampleA
@@ -86,7 +97,10 @@ void ae_outputmixer::mixAndShape(float _sampleA, float _sampleB, float _sampleCo
 
     mainSample = NlToolbox::Others::parAsym(mainSample, tmpVar, _signal[OUT_ASM]);
 
-    m_sampleR += mainSample;
+    m_voiceSampleR = mainSample * m_fade[_voiceID];
+
+    //****************************** Voice Fade ******************************//
+    m_fade[_voiceID] = NlToolbox::Clipping::floatMax(m_fade[_voiceID] - m_fadeStep[_voiceID], 0.f);
 }
 
 
@@ -95,7 +109,7 @@ void ae_outputmixer::mixAndShape(float _sampleA, float _sampleB, float _sampleCo
 /** @brief
 *******************************************************************************/
 
-void ae_outputmixer::filterAndLevel(float *_signal)
+void ae_outputmixer::filterAndLevel(voice_signal _signal)
 {
     m_sampleL = m_highpass_L.applyFilter(m_sampleL);
     m_sampleR = m_highpass_R.applyFilter(m_sampleR);
@@ -103,3 +117,31 @@ void ae_outputmixer::filterAndLevel(float *_signal)
     m_sampleL *= _signal[OUT_LVL];
     m_sampleR *= _signal[OUT_LVL];
 }
+
+
+
+/******************************************************************************/
+/** @brief    clears the shaper states, the peak and the fade of one voice
+              (idle voice, triggered again)
+*******************************************************************************/
+
+void ae_outputmixer::resetVoice(uint32_t _voiceID)
+{
+    m_stateVarL[_voiceID] = 0.f;
+    m_stateVarR[_voiceID] = 0.f;
+    m_peak[_voiceID] = 0.f;
+    m_fade[_voiceID] = 1.f;
+    m_fadeStep[_voiceID] = 0.f;
+}
+
+
+
+/******************************************************************************/
+/** @brief    starts fading one voice out (stolen voice), it is silent after
+              1 / _step samples
+*******************************************************************************/
+
+void ae_outputmixer::fadeVoice(uint32_t _voiceID, float _step)
+{
+    m_fadeStep[_voiceID] = _step;
+}
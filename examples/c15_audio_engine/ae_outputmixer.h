@@ -10,7 +10,7 @@
 #pragma once
 
 #include "nltoolbox.h"
-#include "dsp_defines_signallabels.h"
+#include "dsp_shared_signal.h"
 #include <vector>
 
 struct ae_outputmixer
@@ -18,15 +18,21 @@ struct ae_outputmixer
     ae_outputmixer();       // Default Constructor
 
     float m_sampleL, m_sampleR;
+    float m_voiceSampleL, m_voiceSampleR;   // faded sample of the last mixAndShape() call, summed into m_sampleL/R by the host (like the voice bank)
 
     float m_warpedConst_30hz;
 
     std::vector<float> m_stateVarL;
     std::vector<float> m_stateVarR;
+    std::vector<float> m_peak;      // per voice peak of the mixed samples since the last voice activity check
+    std::vector<float> m_fade;      // per voice output gain, lowered by m_fadeStep per sample (stolen voices fade out)
+    std::vector<float> m_fadeStep;
 
     void init(float _samplerate, uint32_t _numberOfVoices);
-    void mixAndShape(float _sampleA, float _sampleB, float _sampleComb, float _sampleSVFilter, float *_signal, uint32_t _voiceID);
-    void filterAndLevel(float *_signal);
+    void mixAndShape(float _sampleA, float _sampleB, float _sampleComb, float _sampleSVFilter, voice_signal _signal, uint32_t _voiceID);
+    void filterAndLevel(voice_signal _signal);
+    void resetVoice(uint32_t _voiceID);
+    void fadeVoice(uint32_t _voiceID, float _step);
 
 
     //*************************** Highpass Filters ****************************//
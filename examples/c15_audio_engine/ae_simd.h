@@ -0,0 +1,238 @@
+/******************************************************************************/
+/** @file           ae_simd.h
+    @version        1.0
+    @brief          Voice parallel vector types and vector versions of the
+                    NlToolbox functions used in the poly chain
+                    (one lane per voice, 4 lanes on SSE/NEON, 8 on AVX2)
+    @todo
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <cstring>
+#include "pe_defines_config.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define dsp_simd_lanes      8               // AVX2: 8 voices per instruction
+#else
+#define dsp_simd_lanes      4               // SSE2/NEON: 4 voices per instruction
+#endif
+
+#define dsp_simd_groups     ((dsp_number_of_voices + dsp_simd_lanes - 1) / dsp_simd_lanes)     // voice groups (one vector each)
+#define dsp_simd_voices     (dsp_simd_groups * dsp_simd_lanes)                                  // voices including unused lanes
+
+namespace NlToolbox {
+namespace Simd {
+
+typedef float vfloat __attribute__((vector_size(dsp_simd_lanes * sizeof(float))));
+typedef int32_t vint __attribute__((vector_size(dsp_simd_lanes * sizeof(int32_t))));
+typedef double vdouble __attribute__((vector_size(dsp_simd_lanes * sizeof(double))));
+
+/*****************************************************************************/
+/** @brief    basic lane operations
+******************************************************************************/
+
+inline vfloat splat(float _value)
+{
+    return vfloat{} + _value;
+}
+
+inline vint splat(int32_t _value)
+{
+    return vint{} + _value;
+}
+
+inline vfloat load(const float *_data)                                  // unaligned load of one lane per voice
+{
+    vfloat result;
+    std::memcpy(&result, _data, sizeof(result));
+    return result;
+}
+
+inline void store(float *_data, vfloat _value)                          // unaligned store of one lane per voice
+{
+    std::memcpy(_data, &_value, sizeof(_value));
+}
+
+inline vint load(const uint32_t *_data)
+{
+    vint result;
+    std::memcpy(&result, _data, sizeof(result));
+    return result;
+}
+
+inline void store(uint32_t *_data, vint _value)
+{
+    std::memcpy(_data, &_value, sizeof(_value));
+}
+
+inline vint laneIndex()                                                 // {0, 1, 2, ...}
+{
+    vint result;
+    for(uint32_t l = 0; l < dsp_simd_lanes; l++)
+    {
+        result[l] = static_cast<int32_t>(l);
+    }
+    return result;
+}
+
+inline vint laneMask(uint32_t _bits)                                    // bit l of _bits selects lane l (-1), others are 0
+{
+    return ((splat(static_cast<int32_t>(_bits)) >> laneIndex()) & 1) != 0;
+}
+
+inline bool any(vint _mask)
+{
+#if defined(__AVX2__)
+    return !_mm256_testz_si256(reinterpret_cast<__m256i>(_mask), reinterpret_cast<__m256i>(_mask));
+#else
+    int32_t result = 0;
+    for(uint32_t l = 0; l < dsp_simd_lanes; l++)
+    {
+        result |= _mask[l];
+    }
+    return result != 0;
+#endif
+}
+
+inline vfloat toFloat(vint _value)
+{
+    return __builtin_convertvector(_value, vfloat);
+}
+
+inline vint toInt(vfloat _value)                                        // truncating, like static_cast<int>
+{
+    return __builtin_convertvector(_value, vint);
+}
+
+inline vfloat select(vint _mask, vfloat _true, vfloat _false)
+{
+    return _mask ? _true : _false;
+}
+
+inline vint select(vint _mask, vint _true, vint _false)
+{
+    return _mask ? _true : _false;
+}
+
+inline vfloat abs(vfloat _value)
+{
+    return reinterpret_cast<vfloat>(reinterpret_cast<vint>(_value) & 0x7FFFFFFF);
+}
+
+/*****************************************************************************/
+/** @brief    gather floats from base + offset (one offset per lane)
+******************************************************************************/
+
+inline vfloat gather(const float *_base, vint _offset)
+{
+#if defined(__AVX2__)
+    return reinterpret_cast<vfloat>(_mm256_i32gather_ps(_base, reinterpret_cast<__m256i>(_offset), 4));
+#else
+    vfloat result;
+    for(uint32_t l = 0; l < dsp_simd_lanes; l++)
+    {
+        result[l] = _base[_offset[l]];
+    }
+    return result;
+#endif
+}
+
+inline vint gather(const uint32_t *_base, vint _offset)
+{
+#if defined(__AVX2__)
+    return reinterpret_cast<vint>(_mm256_i32gather_epi32(reinterpret_cast<const int *>(_base), reinterpret_cast<__m256i>(_offset), 4));
+#else
+    vint result;
+    for(uint32_t l = 0; l < dsp_simd_lanes; l++)
+    {
+        result[l] = static_cast<int32_t>(_base[_offset[l]]);
+    }
+    return result;
+#endif
+}
+
+/*****************************************************************************/
+/** @brief    vector versions of NlToolbox functions - the operations and their
+ *            order are kept, so every lane produces the scalar result
+******************************************************************************/
+
+inline vfloat float2int(vfloat _value)                                  // Conversion::float2int, returned as float
+{
+    return toFloat(toInt(select(_value >= 0.f, _value + 0.5f, _value - 0.5f)));
+}
+
+inline vfloat floatMax(vfloat _x, vfloat _y)                            // Clipping::floatMax
+{
+    return select(_x > _y, _x, _y);
+}
+
+inline vfloat sinP3_noWrap(vfloat _x)                                   // Math::sinP3_noWrap (polynomial in double precision)
+{
+    _x += _x;
+    _x = abs(_x);
+    _x = 0.5f - _x;
+
+    vdouble x_square = __builtin_convertvector(_x * _x, vdouble);
+    vdouble x = __builtin_convertvector(_x, vdouble);
+    return __builtin_convertvector(x * ((2.26548 * x_square - 5.13274) * x_square + 3.14159), vfloat);
+}
+
+inline vfloat sinP3_wrap(vfloat _x)                                     // Math::sinP3_wrap
+{
+    _x += -0.25f;
+    _x -= float2int(_x);
+    return sinP3_noWrap(_x);
+}
+
+inline vfloat squaredCurvature(vfloat _value, vfloat _curvature)        // Curves::SquaredCurvature (fabs() promotes to double)
+{
+    vdouble value = __builtin_convertvector(_value, vdouble);
+    vdouble magnitude = __builtin_convertvector(abs(_value), vdouble);
+    vdouble curvature = __builtin_convertvector(_curvature, vdouble);
+    return __builtin_convertvector(value * (1.0 + (curvature * (magnitude - 1.0))), vfloat);
+}
+
+inline vfloat interpolRT(vfloat fract, vfloat sample_tm1, vfloat sample_t0, vfloat sample_tp1, vfloat sample_tp2)
+{
+    vfloat fract_square = fract * fract;
+    vfloat fract_cube = fract_square * fract;
+
+    vfloat a = 0.5f * (sample_tp1 - sample_tm1);
+    vfloat b = 0.5f * (sample_tp2 - sample_t0);
+    vfloat c = sample_t0 - sample_tp1;
+
+    return sample_t0 + fract * a + fract_cube * (a + b + 2.f * c) - fract_square * (2.f * a + b + 3.f * c);
+}
+
+inline vfloat bipolarCrossFade(vfloat _sample1, vfloat _sample2, vfloat _mix)
+{
+    _sample1 = (1.f - abs(_mix)) * _sample1;
+    _sample2 = _mix * _sample2;
+
+    return _sample1 + _sample2;
+}
+
+inline vfloat unipolarCrossFade(vfloat _sample1, vfloat _sample2, vfloat _mix)
+{
+    _sample1 = (1.f - _mix) * _sample1;
+    _sample2 = _mix * _sample2;
+
+    return _sample1 + _sample2;
+}
+
+inline vfloat threeRanges(vfloat sample, vfloat ctrlSample, vfloat foldAmnt)
+{
+    sample = select(ctrlSample < -0.25f, (sample + 1.f) * foldAmnt + (-1.f), sample);
+    return select(ctrlSample > 0.25f, (sample + (-1.f)) * foldAmnt + 1.f, sample);
+}
+
+inline vfloat parAsym(vfloat sample, vfloat sample_square, vfloat asymAmnt)
+{
+    return ((1.f - asymAmnt) * sample) + (2.f * asymAmnt * sample_square);
+}
+
+} // namespace Simd
+} // namespace NlToolbox
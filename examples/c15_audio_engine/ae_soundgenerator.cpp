@@ -55,11 +55,35 @@ void ae_soundgenerator::resetPhase(float _phaseA, float _phaseB)
 
 
 
+/******************************************************************************/
+/** @brief    clears all rendering states (idle voice, triggered again),
+              phases are set by resetPhase() and the random generators go on
+*******************************************************************************/
+
+void ae_soundgenerator::resetDSP()
+{
+    m_sampleA = 0.f;
+    m_sampleB = 0.f;
+
+    m_oscA_selfmix = 0.f;
+    m_oscA_crossmix = 0.f;
+    m_oscA_phase_stateVar = 0.f;
+
+    m_oscB_selfmix = 0.f;
+    m_oscB_crossmix = 0.f;
+    m_oscB_phase_stateVar = 0.f;
+
+    m_chirpFilter_A.m_stateVar = 0.f;
+    m_chirpFilter_B.m_stateVar = 0.f;
+}
+
+
+
 /******************************************************************************/
 /** @brief
 *******************************************************************************/
 
-void ae_soundgenerator::generateSound(float _feedbackSample, float *_signal)
+void ae_soundgenerator::generateSound(float _feedbackSample, voice_signal _signal)
 {
     //**************************** Modulation A ******************************//
     float tmpVar = m_oscA_selfmix * _signal[OSC_A_PMSEA];
@@ -13,7 +13,7 @@
 
 #include <cmath>
 #include "nltoolbox.h"
-#include "dsp_defines_signallabels.h"
+#include "dsp_shared_signal.h"
 
 struct ae_soundgenerator
 {
@@ -22,8 +22,9 @@ struct ae_soundgenerator
     float m_sampleA, m_sampleB;       // Generated Samples
 
     void init(float _samplerate, uint32_t _vn);
-    void generateSound(float _feedbackSample, float *_signal);
+    void generateSound(float _feedbackSample, voice_signal _signal);
     void resetPhase(float _phaseA, float _phaseB);
+    void resetDSP();
 
     //************************** Shared Variables *****************************//
     float m_sample_interval;
@@ -49,11 +49,33 @@ void ae_svfilter::init(float _samplerate, uint32_t _vn)
 
 
 
+/******************************************************************************/
+/** @brief    clears all rendering states (idle voice, triggered again)
+*******************************************************************************/
+
+void ae_svfilter::resetDSP()
+{
+    m_sampleSVF = 0.f;
+
+    m_first_fir_stateVar = 0.f;
+    m_second_fir_stateVar = 0.f;
+    m_first_int1_stateVar = 0.f;
+    m_first_int2_stateVar = 0.f;
+    m_second_int1_stateVar = 0.f;
+    m_second_int2_stateVar = 0.f;
+
+    m_first_sv_sample = 0.f;
+    m_first_sat_stateVar = 0.f;
+    m_second_sat_stateVar = 0.f;
+}
+
+
+
 /******************************************************************************/
 /** @brief
 *******************************************************************************/
 
-void ae_svfilter::applySVFilter(float _sampleA, float _sampleB, float _sampleComb, float *_signal)
+void ae_svfilter::applySVFilter(float _sampleA, float _sampleB, float _sampleComb, voice_signal _signal)
 {
     //******************************** Sample Mix ****************************//
     float tmpVar = _signal[SVF_AB];
@@ -173,7 +195,7 @@ void ae_svfilter::applySVFilter(float _sampleA, float _sampleB, float _sampleCom
 /** @brief
 *******************************************************************************/
 
-void ae_svfilter::setSVFilter(float *_signal, float _samplerate)
+void ae_svfilter::setSVFilter(voice_signal _signal, float _samplerate)
 {
     float resonance = _signal[SVF_RES];
     resonance = 1.f - resonance;
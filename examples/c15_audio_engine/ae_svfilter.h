@@ -10,7 +10,7 @@
 #pragma once
 
 #include "nltoolbox.h"
-#include "dsp_defines_signallabels.h"
+#include "dsp_shared_signal.h"
 
 struct ae_svfilter
 {
@@ -20,8 +20,9 @@ struct ae_svfilter
     float m_warpConst_2PI;
 
     void init(float _samplerate, uint32_t _vn);
-    void applySVFilter(float _sampleA, float _sampleB, float _sampleComb, float *_signal);
-    void setSVFilter(float *_signal, float _samplerate);
+    void applySVFilter(float _sampleA, float _sampleB, float _sampleComb, voice_signal _signal);
+    void setSVFilter(voice_signal _signal, float _samplerate);
+    void resetDSP();
 
     float m_first_attenuation, m_second_attenuation;
 
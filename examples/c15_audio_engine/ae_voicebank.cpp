@@ -0,0 +1,682 @@
+/******************************************************************************/
+/** @file           ae_voicebank.cpp
+    @version        1.0
+    @brief          Voice parallel (structure of arrays) poly chain:
+                    Soundgenerator, Combfilter, State Variable Filter and the
+                    Outputmixer shaping for dsp_simd_lanes voices at once
+    @todo
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include "ae_voicebank.h"
+
+using namespace NlToolbox::Simd;
+
+/* the vectors in front of the shaped samples are the states and coefficients of a group */
+static constexpr uint32_t group_state_vectors = offsetof(ae_voicebank::group, m_mixL) / sizeof(ae_voicebank::vint);
+
+static_assert(sizeof(ae_voicebank::vfloat) == sizeof(ae_voicebank::vint), "group states are blended as integer vectors");
+static_assert(offsetof(ae_voicebank::group, m_mixL) % sizeof(ae_voicebank::vint) == 0, "group states have to be whole vectors");
+
+/******************************************************************************/
+/** @brief    puts the states of the lanes, which are not selected by _active,
+              back to _frozen (the group states before render())
+*******************************************************************************/
+
+static void freezeLanes(ae_voicebank::group &_bank, const ae_voicebank::vint *_frozen, ae_voicebank::vint _active)
+{
+    char *states = reinterpret_cast<char*>(&_bank);
+
+    for(uint32_t i = 0; i < group_state_vectors; i++)
+    {
+        ae_voicebank::vint state;
+        std::memcpy(&state, states + i * sizeof(state), sizeof(state));
+        state = select(_active, state, _frozen[i]);
+        std::memcpy(states + i * sizeof(state), &state, sizeof(state));
+    }
+}
+
+/******************************************************************************/
+/** @brief    transposes states and coefficients of all voices into the lanes
+              (unused lanes of the last group stay silent and are never stored)
+*******************************************************************************/
+
+void ae_voicebank::load(ae_soundgenerator *_soundgenerator, ae_combfilter *_combfilter, ae_svfilter *_svfilter,
+                        ae_outputmixer &_outputmixer, uint32_t _voices)
+{
+    m_voices = _voices;
+    m_groups = (_voices + dsp_simd_lanes - 1) / dsp_simd_lanes;
+    m_delayBase = _combfilter[0].m_delayBuffer.pData;
+    m_delayMask = static_cast<int32_t>(_combfilter[0].m_delayBuffer.mMask);
+    m_delayClip = static_cast<float>(_combfilter[0].m_delayBuffer.mMask - 2);
+    m_warpedConst_30hz = _outputmixer.m_warpedConst_30hz;
+
+    for(uint32_t g = 0; g < m_groups; g++)
+    {
+        group &bank = m_group[g];
+        bank = group();
+
+        for(uint32_t l = 0; l < dsp_simd_lanes; l++)
+        {
+            const uint32_t v = g * dsp_simd_lanes + l;
+
+            if(v >= _voices)
+            {
+                break;
+            }
+
+            const ae_soundgenerator &sg = _soundgenerator[v];
+            const ae_combfilter &cmb = _combfilter[v];
+            const ae_svfilter &svf = _svfilter[v];
+
+            //***************************** Soundgenerator ****************************//
+            bank.m_sampleA[l] = sg.m_sampleA;
+            bank.m_sampleB[l] = sg.m_sampleB;
+            bank.m_sample_interval[l] = sg.m_sample_interval;
+            bank.m_oscA_selfmix[l] = sg.m_oscA_selfmix;
+            bank.m_oscA_crossmix[l] = sg.m_oscA_crossmix;
+            bank.m_oscA_phase[l] = sg.m_oscA_phase;
+            bank.m_oscA_phase_stateVar[l] = sg.m_oscA_phase_stateVar;
+            bank.m_oscA_phaseInc[l] = sg.m_oscA_phaseInc;
+            bank.m_OscA_randVal_int[l] = sg.m_OscA_randVal_int;
+            bank.m_OscA_randVal_float[l] = sg.m_OscA_randVal_float;
+            bank.m_oscB_selfmix[l] = sg.m_oscB_selfmix;
+            bank.m_oscB_crossmix[l] = sg.m_oscB_crossmix;
+            bank.m_oscB_phase[l] = sg.m_oscB_phase;
+            bank.m_oscB_phase_stateVar[l] = sg.m_oscB_phase_stateVar;
+            bank.m_oscB_phaseInc[l] = sg.m_oscB_phaseInc;
+            bank.m_OscB_randVal_int[l] = sg.m_OscB_randVal_int;
+            bank.m_OscB_randVal_float[l] = sg.m_OscB_randVal_float;
+            bank.m_chirpA_stateVar[l] = sg.m_chirpFilter_A.m_stateVar;
+            bank.m_chirpB_stateVar[l] = sg.m_chirpFilter_B.m_stateVar;
+
+            //******************************* Combfilter ******************************//
+            bank.m_sampleComb[l] = cmb.m_sampleComb;
+            bank.m_decayStateVar[l] = cmb.m_decayStateVar;
+            bank.m_hpInStateVar[l] = cmb.m_hpInStateVar;
+            bank.m_hpOutStateVar[l] = cmb.m_hpOutStateVar;
+            bank.m_lpStateVar[l] = cmb.m_lpStateVar;
+            bank.m_apStateVar_1[l] = cmb.m_apStateVar_1;
+            bank.m_apStateVar_2[l] = cmb.m_apStateVar_2;
+            bank.m_apStateVar_3[l] = cmb.m_apStateVar_3;
+            bank.m_apStateVar_4[l] = cmb.m_apStateVar_4;
+            bank.m_delayConst[l] = cmb.m_delayConst;
+            bank.m_delayStateVar[l] = cmb.m_delayStateVar;
+            bank.m_delayBufferInd[l] = static_cast<int32_t>(cmb.m_delayBufferInd);
+            bank.m_delayOffset[l] = static_cast<int32_t>(cmb.m_delayBuffer.pData - m_delayBase);
+
+            //************************* State Variable Filter *************************//
+            bank.m_sampleSVF[l] = svf.m_sampleSVF;
+            bank.m_warpConst_2PI[l] = svf.m_warpConst_2PI;
+            bank.m_first_fir_stateVar[l] = svf.m_first_fir_stateVar;
+            bank.m_second_fir_stateVar[l] = svf.m_second_fir_stateVar;
+            bank.m_first_int1_stateVar[l] = svf.m_first_int1_stateVar;
+            bank.m_first_int2_stateVar[l] = svf.m_first_int2_stateVar;
+            bank.m_second_int1_stateVar[l] = svf.m_second_int1_stateVar;
+            bank.m_second_int2_stateVar[l] = svf.m_second_int2_stateVar;
+            bank.m_first_sv_sample[l] = svf.m_first_sv_sample;
+            bank.m_first_sat_stateVar[l] = svf.m_first_sat_stateVar;
+            bank.m_second_sat_stateVar[l] = svf.m_second_sat_stateVar;
+
+            //******************************* Outputmixer *****************************//
+            bank.m_stateVarL[l] = _outputmixer.m_stateVarL[v];
+            bank.m_stateVarR[l] = _outputmixer.m_stateVarR[v];
+            bank.m_peak[l] = _outputmixer.m_peak[v];
+            bank.m_fade[l] = _outputmixer.m_fade[v];
+            bank.m_fadeStep[l] = _outputmixer.m_fadeStep[v];
+        }
+    }
+
+    loadCoeffs(_soundgenerator, _combfilter, _svfilter);
+}
+
+
+
+/******************************************************************************/
+/** @brief    transposes the coefficients (slow clock and key event updates)
+*******************************************************************************/
+
+void ae_voicebank::loadCoeffs(const ae_soundgenerator *_soundgenerator, const ae_combfilter *_combfilter, const ae_svfilter *_svfilter)
+{
+    for(uint32_t v = 0; v < m_voices; v++)
+    {
+        group &bank = m_group[v / dsp_simd_lanes];
+        const uint32_t l = v % dsp_simd_lanes;
+
+        const ae_soundgenerator &sg = _soundgenerator[v];
+        const ae_combfilter &cmb = _combfilter[v];
+        const ae_svfilter &svf = _svfilter[v];
+
+        //************************** Osciallator Chirp Filter *********************//
+        bank.m_chirpA_omega[l] = sg.m_chirpFilter_A.m_omega;
+        bank.m_chirpA_a0[l] = sg.m_chirpFilter_A.m_a0;
+        bank.m_chirpA_a1[l] = sg.m_chirpFilter_A.m_a1;
+        bank.m_chirpB_omega[l] = sg.m_chirpFilter_B.m_omega;
+        bank.m_chirpB_a0[l] = sg.m_chirpFilter_B.m_a0;
+        bank.m_chirpB_a1[l] = sg.m_chirpFilter_B.m_a1;
+
+        //******************************* Combfilter ******************************//
+        bank.m_hpCoeff_b0[l] = cmb.m_hpCoeff_b0;
+        bank.m_hpCoeff_b1[l] = cmb.m_hpCoeff_b1;
+        bank.m_hpCoeff_a1[l] = cmb.m_hpCoeff_a1;
+        bank.m_lpCoeff[l] = cmb.m_lpCoeff;
+        bank.m_apCoeff_1[l] = cmb.m_apCoeff_1;
+        bank.m_apCoeff_2[l] = cmb.m_apCoeff_2;
+        bank.m_delaySamples[l] = cmb.m_delaySamples;
+        bank.m_decayGain[l] = cmb.m_decayGain;
+
+        //************************* State Variable Filter *************************//
+        bank.m_first_attenuation[l] = svf.m_first_attenuation;
+        bank.m_second_attenuation[l] = svf.m_second_attenuation;
+    }
+}
+
+
+
+/******************************************************************************/
+/** @brief    writes the rendering states back to the per voice modules
+*******************************************************************************/
+
+void ae_voicebank::store(ae_soundgenerator *_soundgenerator, ae_combfilter *_combfilter, ae_svfilter *_svfilter, ae_outputmixer &_outputmixer)
+{
+    for(uint32_t v = 0; v < m_voices; v++)
+    {
+        const group &bank = m_group[v / dsp_simd_lanes];
+        const uint32_t l = v % dsp_simd_lanes;
+
+        ae_soundgenerator &sg = _soundgenerator[v];
+        ae_combfilter &cmb = _combfilter[v];
+        ae_svfilter &svf = _svfilter[v];
+
+        //***************************** Soundgenerator ****************************//
+        sg.m_sampleA = bank.m_sampleA[l];
+        sg.m_sampleB = bank.m_sampleB[l];
+        sg.m_oscA_selfmix = bank.m_oscA_selfmix[l];
+        sg.m_oscA_crossmix = bank.m_oscA_crossmix[l];
+        sg.m_oscA_phase = bank.m_oscA_phase[l];
+        sg.m_oscA_phase_stateVar = bank.m_oscA_phase_stateVar[l];
+        sg.m_oscA_phaseInc = bank.m_oscA_phaseInc[l];
+        sg.m_OscA_randVal_int = bank.m_OscA_randVal_int[l];
+        sg.m_OscA_randVal_float = bank.m_OscA_randVal_float[l];
+        sg.m_oscB_selfmix = bank.m_oscB_selfmix[l];
+        sg.m_oscB_crossmix = bank.m_oscB_crossmix[l];
+        sg.m_oscB_phase = bank.m_oscB_phase[l];
+        sg.m_oscB_phase_stateVar = bank.m_oscB_phase_stateVar[l];
+        sg.m_oscB_phaseInc = bank.m_oscB_phaseInc[l];
+        sg.m_OscB_randVal_int = bank.m_OscB_randVal_int[l];
+        sg.m_OscB_randVal_float = bank.m_OscB_randVal_float[l];
+        sg.m_chirpFilter_A.m_stateVar = bank.m_chirpA_stateVar[l];
+        sg.m_chirpFilter_B.m_stateVar = bank.m_chirpB_stateVar[l];
+
+        //******************************* Combfilter ******************************//
+        cmb.m_sampleComb = bank.m_sampleComb[l];
+        cmb.m_decayStateVar = bank.m_decayStateVar[l];
+        cmb.m_hpInStateVar = bank.m_hpInStateVar[l];
+        cmb.m_hpOutStateVar = bank.m_hpOutStateVar[l];
+        cmb.m_lpStateVar = bank.m_lpStateVar[l];
+        cmb.m_apStateVar_1 = bank.m_apStateVar_1[l];
+        cmb.m_apStateVar_2 = bank.m_apStateVar_2[l];
+        cmb.m_apStateVar_3 = bank.m_apStateVar_3[l];
+        cmb.m_apStateVar_4 = bank.m_apStateVar_4[l];
+        cmb.m_delayStateVar = bank.m_delayStateVar[l];
+        cmb.m_delayBufferInd = static_cast<uint32_t>(bank.m_delayBufferInd[l]);
+
+        //************************* State Variable Filter *************************//
+        svf.m_sampleSVF = bank.m_sampleSVF[l];
+        svf.m_first_fir_stateVar = bank.m_first_fir_stateVar[l];
+        svf.m_second_fir_stateVar = bank.m_second_fir_stateVar[l];
+        svf.m_first_int1_stateVar = bank.m_first_int1_stateVar[l];
+        svf.m_first_int2_stateVar = bank.m_first_int2_stateVar[l];
+        svf.m_second_int1_stateVar = bank.m_second_int1_stateVar[l];
+        svf.m_second_int2_stateVar = bank.m_second_int2_stateVar[l];
+        svf.m_first_sv_sample = bank.m_first_sv_sample[l];
+        svf.m_first_sat_stateVar = bank.m_first_sat_stateVar[l];
+        svf.m_second_sat_stateVar = bank.m_second_sat_stateVar[l];
+
+        //******************************* Outputmixer *****************************//
+        _outputmixer.m_stateVarL[v] = bank.m_stateVarL[l];
+        _outputmixer.m_stateVarR[v] = bank.m_stateVarR[l];
+    }
+
+    storeActivity(_outputmixer);
+}
+
+
+
+/******************************************************************************/
+/** @brief    writes the voice peaks and fades back (voice activity check
+              within a block)
+*******************************************************************************/
+
+void ae_voicebank::storeActivity(ae_outputmixer &_outputmixer)
+{
+    for(uint32_t v = 0; v < m_voices; v++)
+    {
+        _outputmixer.m_peak[v] = m_group[v / dsp_simd_lanes].m_peak[v % dsp_simd_lanes];
+        _outputmixer.m_fade[v] = m_group[v / dsp_simd_lanes].m_fade[v % dsp_simd_lanes];
+    }
+}
+
+
+
+/******************************************************************************/
+/** @brief    restarts peak tracking (after a voice activity check)
+*******************************************************************************/
+
+void ae_voicebank::clearPeaks()
+{
+    for(uint32_t g = 0; g < m_groups; g++)
+    {
+        m_group[g].m_peak = splat(0.f);
+    }
+}
+
+
+
+/******************************************************************************/
+/** @brief    renders one voice group over _frames frames, the shaped mixer
+              samples are kept per voice, _flushFade holds the fade point of
+              every frame (groups only touch their own states,
+              so they can be rendered on different threads), idle voices
+              (bits of _activeVoices not set) keep their states like in
+              dsp_host::tickMain()
+              (same operations as ae_soundgenerator::generateSound(),
+              ae_combfilter::applyCombfilter(), ae_svfilter::applySVFilter()
+              and ae_outputmixer::mixAndShape(), one lane per voice)
+*******************************************************************************/
+
+void ae_voicebank::render(uint32_t _group, uint32_t _frames, const shared_signal *_signal, const float *_flushFade, uint32_t _activeVoices)
+{
+    group &bank = m_group[_group];
+    const uint32_t voiceOffset = _group * dsp_simd_lanes;
+    const uint32_t lanes = std::min(m_voices - voiceOffset, static_cast<uint32_t>(dsp_simd_lanes));
+    const vfloat feedbackSample = splat(0.f);                                  /// _feedbackSample
+
+    /* a group is rendered as a whole, so the states of its idle lanes are restored afterwards */
+    const vint active = laneMask(_activeVoices >> voiceOffset);
+    const bool freeze = any(~active & laneMask((1u << lanes) - 1));
+    vint frozen[group_state_vectors];
+
+    if(freeze)
+    {
+        std::memcpy(frozen, &bank, sizeof(frozen));
+    }
+
+    for(uint32_t f = 0; f < _frames; f++)
+    {
+        const shared_signal &signal = _signal[f];
+        const float flushFadePoint = _flushFade[f];
+        auto sig = [&signal, voiceOffset](uint32_t _id) { return NlToolbox::Simd::load(&signal.m_data[_id][voiceOffset]); };
+
+        //**************************** Modulation A ******************************//
+        vfloat tmpVar = bank.m_oscA_selfmix * sig(OSC_A_PMSEA);
+        tmpVar = tmpVar + bank.m_oscB_crossmix * sig(OSC_A_PMBEB);
+        tmpVar = tmpVar + feedbackSample * sig(OSC_A_PMFEC);
+
+        //**************************** Oscillator A ******************************//
+        tmpVar = tmpVar - (bank.m_chirpA_a1 * bank.m_chirpA_stateVar);        // Chirp Filter
+        tmpVar *= bank.m_chirpA_a0;
+        vfloat chirpVar = tmpVar;
+        tmpVar = (tmpVar + bank.m_chirpA_stateVar) * bank.m_chirpA_omega;
+        bank.m_chirpA_stateVar = chirpVar + DNC_CONST;
+
+        tmpVar += bank.m_oscA_phase;
+        tmpVar += (-0.25f);                                                     // Wrap
+        tmpVar -= float2int(tmpVar);
+
+        vint edge = abs(bank.m_oscA_phase_stateVar - tmpVar) > 0.5f;            // Check edge
+        vint randVal = bank.m_OscA_randVal_int * 1103515245 + 12345;
+        bank.m_OscA_randVal_int = select(edge, randVal, bank.m_OscA_randVal_int);
+        bank.m_OscA_randVal_float = select(edge, toFloat(randVal) * 4.5657e-10f, bank.m_OscA_randVal_float);
+
+        vfloat osc_freq = sig(OSC_A_FRQ);
+        bank.m_oscA_phaseInc = ((bank.m_OscA_randVal_float * sig(OSC_A_FLUEC) * osc_freq) + osc_freq) * bank.m_sample_interval;
+
+        bank.m_oscA_phase_stateVar = tmpVar;
+
+        bank.m_oscA_phase += bank.m_oscA_phaseInc;
+        bank.m_oscA_phase -= float2int(bank.m_oscA_phase);
+
+        vfloat oscSampleA = sinP3_noWrap(tmpVar);
+
+        //**************************** Modulation B ******************************//
+        tmpVar = bank.m_oscB_selfmix * sig(OSC_B_PMSEB);
+        tmpVar = tmpVar + bank.m_oscA_crossmix * sig(OSC_B_PMAEA);
+        tmpVar = tmpVar + feedbackSample * sig(OSC_B_PMFEC);
+
+        //**************************** Oscillator B ******************************//
+        tmpVar = tmpVar - (bank.m_chirpB_a1 * bank.m_chirpB_stateVar);        // Chirp Filter
+        tmpVar *= bank.m_chirpB_a0;
+        chirpVar = tmpVar;
+        tmpVar = (tmpVar + bank.m_chirpB_stateVar) * bank.m_chirpB_omega;
+        bank.m_chirpB_stateVar = chirpVar + DNC_CONST;
+
+        tmpVar += bank.m_oscB_phase;
+        tmpVar += (-0.25f);                                                     // Wrap
+        tmpVar -= float2int(tmpVar);
+
+        edge = abs(bank.m_oscB_phase_stateVar - tmpVar) > 0.5f;                 // Check edge
+        randVal = bank.m_OscB_randVal_int * 1103515245 + 12345;
+        bank.m_OscB_randVal_int = select(edge, randVal, bank.m_OscB_randVal_int);
+        bank.m_OscB_randVal_float = select(edge, toFloat(randVal) * 4.5657e-10f, bank.m_OscB_randVal_float);
+
+        osc_freq = sig(OSC_B_FRQ);
+        bank.m_oscB_phaseInc = ((bank.m_OscB_randVal_float * sig(OSC_B_FLUEC) * osc_freq) + osc_freq) * bank.m_sample_interval;
+
+        bank.m_oscB_phase_stateVar = tmpVar;
+
+        bank.m_oscB_phase += bank.m_oscB_phaseInc;
+        bank.m_oscB_phase -= float2int(bank.m_oscB_phase);
+
+        vfloat oscSampleB = sinP3_noWrap(tmpVar);
+
+        //******************************* Shaper A *******************************//
+        vfloat shaperSampleA = oscSampleA * sig(SHP_A_DRVEA);
+        tmpVar = shaperSampleA;
+
+        shaperSampleA = sinP3_wrap(shaperSampleA);
+        shaperSampleA = threeRanges(shaperSampleA, tmpVar, sig(SHP_A_FLD));
+
+        tmpVar = shaperSampleA * shaperSampleA + (-0.5f);
+
+        shaperSampleA = parAsym(shaperSampleA, tmpVar, sig(SHP_A_ASM));
+
+        //******************************* Shaper B *******************************//
+        vfloat shaperSampleB = oscSampleB * sig(SHP_B_DRVEB);
+        tmpVar = shaperSampleB;
+
+        shaperSampleB = sinP3_wrap(shaperSampleB);
+        shaperSampleB = threeRanges(shaperSampleB, tmpVar, sig(SHP_B_FLD));
+
+        tmpVar = shaperSampleB * shaperSampleB + (-0.5f);
+
+        shaperSampleB = parAsym(shaperSampleB, tmpVar, sig(SHP_B_ASM));
+
+        //****************************** Crossfades ******************************//
+        bank.m_oscA_selfmix  = bipolarCrossFade(oscSampleA, shaperSampleA, sig(OSC_A_PMSSH));
+        bank.m_oscA_crossmix = bipolarCrossFade(oscSampleA, shaperSampleA, sig(OSC_B_PMASH));
+
+        bank.m_oscB_selfmix  = bipolarCrossFade(oscSampleB, shaperSampleB, sig(OSC_B_PMSSH));
+        bank.m_oscB_crossmix = bipolarCrossFade(oscSampleB, shaperSampleB, sig(OSC_A_PMBSH));
+
+        vfloat sampleA = bipolarCrossFade(oscSampleA, shaperSampleA, sig(SHP_A_MIX));
+        vfloat sampleB = bipolarCrossFade(oscSampleB, shaperSampleB, sig(SHP_B_MIX));
+
+        //******************* Envelope Influence (Magnitudes) ********************//
+        sampleA *= sig(ENV_A_MAG);
+        sampleB *= sig(ENV_B_MAG);
+
+        //**************************** Feedback Mix ******************************//
+        tmpVar  = unipolarCrossFade(sig(ENV_G_SIG), sig(ENV_C_SIG), sig(SHP_A_FBEC));
+        tmpVar *= feedbackSample;
+        sampleA = unipolarCrossFade(sampleA, tmpVar, sig(SHP_A_FBM));
+
+        tmpVar  = unipolarCrossFade(sig(ENV_G_SIG), sig(ENV_C_SIG), sig(SHP_B_FBEC));
+        tmpVar *= feedbackSample;
+        sampleB = unipolarCrossFade(sampleB, tmpVar, sig(SHP_B_FBM));
+
+        //************************** Ring Modulation *****************************//
+        tmpVar = sampleA * sampleB;
+
+        sampleA = unipolarCrossFade(sampleA, tmpVar, sig(SHP_A_RM));
+        sampleB = unipolarCrossFade(sampleB, tmpVar, sig(SHP_B_RM));
+
+        bank.m_sampleA = sampleA;
+        bank.m_sampleB = sampleB;
+
+        //***************************** Comb Filter ******************************//
+        tmpVar = sig(CMB_AB);                                                   // AB Sample Mix
+        vfloat sampleComb = sampleB * (1.f - tmpVar) + sampleA * tmpVar;
+
+        tmpVar = sig(CMB_PMAB);                                                 // AB Sample Phase Modulation Mix
+        vfloat phaseMod = sampleA * (1.f - tmpVar) + sampleB * tmpVar;
+        phaseMod *= sig(CMB_PM);
+
+        tmpVar  = bank.m_hpCoeff_b0 * sampleComb;                               // 1-Pole Highpass
+        tmpVar += (bank.m_hpCoeff_b1 * bank.m_hpInStateVar);
+        tmpVar += (bank.m_hpCoeff_a1 * bank.m_hpOutStateVar);
+
+        bank.m_hpInStateVar  = sampleComb + DNC_CONST;
+        bank.m_hpOutStateVar = tmpVar + DNC_CONST;
+
+        sampleComb = tmpVar;
+        sampleComb += bank.m_decayStateVar;
+
+        sampleComb *= (1.f - bank.m_lpCoeff);                                   // 1-Pole Lowpass
+        sampleComb += (bank.m_lpCoeff * bank.m_lpStateVar);
+        sampleComb += DNC_CONST;
+        bank.m_lpStateVar = sampleComb;
+
+        tmpVar = sampleComb;                                                    // Allpass
+
+        sampleComb *= bank.m_apCoeff_2;
+        sampleComb += (bank.m_apStateVar_1 * bank.m_apCoeff_1);
+        sampleComb += bank.m_apStateVar_2;
+
+        sampleComb -= (bank.m_apStateVar_3 * bank.m_apCoeff_1);
+        sampleComb -= (bank.m_apStateVar_4 * bank.m_apCoeff_2);
+
+        sampleComb += DNC_CONST;
+
+        bank.m_apStateVar_2 = bank.m_apStateVar_1;
+        bank.m_apStateVar_1 = tmpVar;
+
+        bank.m_apStateVar_4 = bank.m_apStateVar_3;
+        bank.m_apStateVar_3 = sampleComb;
+
+        vfloat positive = sampleComb - 0.501187f;                               // Para D (both branches, selected per lane)
+        tmpVar = positive;
+        positive = select(positive > 2.98815f, splat(2.98815f), positive);
+        positive *= (1.f - positive * 0.167328f);
+        positive *= 0.7488f;
+        positive += (tmpVar * 0.2512f + 0.501187f);
+
+        vfloat negative = sampleComb + 0.501187f;
+        tmpVar = negative;
+        negative = select(negative < -2.98815f, splat(-2.98815f), negative);
+        negative *= (1.f - abs(negative) * 0.167328f);
+        negative *= 0.7488f;
+        negative += (tmpVar * 0.2512f - 0.501187f);
+
+        sampleComb = select(abs(sampleComb) > 0.501187f, select(sampleComb > 0.f, positive, negative), sampleComb);
+
+        tmpVar  = bank.m_delaySamples - bank.m_delayStateVar;                   // SmoothB
+        tmpVar *= bank.m_delayConst;
+        tmpVar += bank.m_delayStateVar;
+
+        bank.m_delayStateVar = tmpVar;
+
+        tmpVar *= sig(CMB_FEC);
+        tmpVar += (phaseMod * tmpVar);
+
+        vfloat holdsample = sampleComb;                                         // for Bypass
+
+        sampleComb *= flushFadePoint;                                          // Delay
+        for(uint32_t l = 0; l < lanes; l++)
+        {
+            m_delayBase[bank.m_delayOffset[l] + bank.m_delayBufferInd[l]] = sampleComb[l];
+        }
+
+        tmpVar -= 1.f;
+        tmpVar = select(tmpVar > m_delayClip, splat(m_delayClip), select(tmpVar < 1.f, splat(1.f), tmpVar));
+
+        vfloat delaySamples_int = float2int(tmpVar - 0.5f);                     // integer and fraction speration
+        vfloat delaySamples_fract = tmpVar - delaySamples_int;
+
+        vint ind_t0 = toInt(delaySamples_int);
+        vint ind_tm1 = ((bank.m_delayBufferInd - (ind_t0 - 1)) & m_delayMask) + bank.m_delayOffset;
+        vint ind_tp1 = ((bank.m_delayBufferInd - (ind_t0 + 1)) & m_delayMask) + bank.m_delayOffset;
+        vint ind_tp2 = ((bank.m_delayBufferInd - (ind_t0 + 2)) & m_delayMask) + bank.m_delayOffset;
+        ind_t0 = ((bank.m_delayBufferInd - ind_t0) & m_delayMask) + bank.m_delayOffset;
+
+        sampleComb = interpolRT(delaySamples_fract,                             // Interpolation
+                                gather(m_delayBase, ind_tm1),
+                                gather(m_delayBase, ind_t0),
+                                gather(m_delayBase, ind_tp1),
+                                gather(m_delayBase, ind_tp2));
+
+        sampleComb *= flushFadePoint;
+
+        bank.m_delayBufferInd = (bank.m_delayBufferInd + 1) & m_delayMask;
+
+        tmpVar = sig(CMB_BYP);                                                  // Bypass
+        sampleComb = tmpVar * holdsample + (1.f - tmpVar) * sampleComb;
+
+        bank.m_decayStateVar = sampleComb * bank.m_decayGain;                   // Decay
+        bank.m_sampleComb = sampleComb;
+
+        //************************* State Variable Filter ************************//
+        tmpVar = sig(SVF_AB);                                                   // Sample Mix
+        vfloat firstSample = sampleB * (1.f - tmpVar) + sampleA * tmpVar;
+        tmpVar = sig(SVF_CMIX);
+        firstSample = firstSample * (1.f - abs(tmpVar)) + sampleComb * tmpVar;
+
+        vfloat secondSample = firstSample * sig(SVF_PAR_4);
+        secondSample += (bank.m_first_sv_sample * sig(SVF_PAR_3));
+        secondSample += (bank.m_second_sat_stateVar * 0.1f);
+
+        firstSample += (bank.m_first_sat_stateVar * 0.1f);
+
+        vfloat fmab = sig(SVF_FMAB);                                            // Frequency Modulation
+        tmpVar = sampleA * fmab + sampleB * (1.f - fmab);
+
+        vfloat omega = (sig(SVF_F1_CUT) + tmpVar * sig(SVF_F1_FM)) * bank.m_warpConst_2PI;     // 1st Stage
+        omega = select(omega > 1.9f, splat(1.9f), omega);
+
+        vfloat firOut = (bank.m_first_fir_stateVar + firstSample) * 0.25f;
+        bank.m_first_fir_stateVar = firstSample + DNC_CONST;
+
+        bank.m_first_sv_sample = firOut - (bank.m_first_attenuation * bank.m_first_int1_stateVar + bank.m_first_int2_stateVar);
+
+        vfloat int1Out = bank.m_first_sv_sample * omega + bank.m_first_int1_stateVar;
+        vfloat int2Out = int1Out * omega + bank.m_first_int2_stateVar;
+
+        vfloat lowpassOutput  = int2Out + bank.m_first_int2_stateVar;
+        vfloat bandpassOutput = int1Out + int1Out;
+        vfloat highpassOutput = firstSample - (int1Out * bank.m_first_attenuation + lowpassOutput);
+
+        bank.m_first_int1_stateVar = int1Out + DNC_CONST;
+        bank.m_first_int2_stateVar = int2Out + DNC_CONST;
+
+        vfloat lbh = sig(SVF_LBH_1);
+        bank.m_first_sv_sample  =  lowpassOutput  * floatMax(-lbh, splat(0.f));
+        bank.m_first_sv_sample += (bandpassOutput * (1.f - abs(lbh)));
+        bank.m_first_sv_sample += (highpassOutput * floatMax(lbh, splat(0.f)));
+
+        bank.m_first_sat_stateVar = select(bandpassOutput > 2.f, splat(2.f), select(bandpassOutput < -2.f, splat(-2.f), bandpassOutput));
+        bank.m_first_sat_stateVar *= (1.f - abs(bank.m_first_sat_stateVar) * 0.25f);
+
+        omega = (sig(SVF_F2_CUT) + tmpVar * sig(SVF_F2_FM)) * bank.m_warpConst_2PI;            // 2nd Stage
+        omega = select(omega > 1.9f, splat(1.9f), omega);
+
+        firOut = (bank.m_second_fir_stateVar + secondSample) * 0.25f;
+        bank.m_second_fir_stateVar = secondSample + DNC_CONST;
+
+        tmpVar = firOut - (bank.m_second_attenuation * bank.m_second_int1_stateVar + bank.m_second_int2_stateVar);
+
+        int1Out = tmpVar * omega + bank.m_second_int1_stateVar;
+        int2Out = int1Out * omega + bank.m_second_int2_stateVar;
+
+        lowpassOutput  = int2Out + bank.m_second_int2_stateVar;
+        bandpassOutput = int1Out + int1Out;
+        highpassOutput = tmpVar - (int1Out * bank.m_second_attenuation + lowpassOutput);
+
+        bank.m_second_int1_stateVar = int1Out + DNC_CONST;
+        bank.m_second_int2_stateVar = int2Out + DNC_CONST;
+
+        lbh = sig(SVF_LBH_2);
+        tmpVar  =  lowpassOutput  * floatMax(-lbh, splat(0.f));
+        tmpVar += (bandpassOutput * (1.f - abs(lbh)));
+        tmpVar += (highpassOutput * floatMax(lbh, splat(0.f)));
+
+        bank.m_second_sat_stateVar = select(bandpassOutput > 2.f, splat(2.f), select(bandpassOutput < -2.f, splat(-2.f), bandpassOutput));
+        bank.m_second_sat_stateVar *= (1.f - abs(bank.m_second_sat_stateVar) * 0.25f);
+
+        vfloat sampleSVF  = bank.m_first_sv_sample * sig(SVF_PAR_1);            // Crossfades
+        sampleSVF += (tmpVar * sig(SVF_PAR_2));
+        bank.m_sampleSVF = sampleSVF;
+
+        //****************************** Outputmixer *****************************//
+        tmpVar = floatMax(bank.m_peak, abs(sampleA));                           // Voice Activity
+        tmpVar = floatMax(tmpVar, abs(sampleB));
+        tmpVar = floatMax(tmpVar, abs(sampleComb));
+        bank.m_peak = floatMax(tmpVar, abs(sampleSVF));
+
+        vfloat mainSample = sig(OUT_A_L) * sampleA                              // Left Mix
+                          + sig(OUT_B_L) * sampleB
+                          + sig(OUT_CMB_L) * sampleComb
+                          + sig(OUT_SVF_L) * sampleSVF;
+
+        vfloat drive = sig(OUT_DRV);                                            // Left Sample Shaper
+        vfloat fold = sig(OUT_FLD);
+        vfloat asym = sig(OUT_ASM);
+
+        mainSample *= drive;
+        tmpVar = mainSample;
+
+        mainSample = sinP3_wrap(mainSample);
+        mainSample = threeRanges(mainSample, tmpVar, fold);
+
+        tmpVar = mainSample * mainSample;
+        tmpVar = tmpVar - bank.m_stateVarL;
+        bank.m_stateVarL = tmpVar * m_warpedConst_30hz + bank.m_stateVarL + DNC_CONST;
+
+        vfloat mainSampleL = parAsym(mainSample, tmpVar, asym);
+
+        mainSample = sig(OUT_A_R) * sampleA                                     // Right Mix
+                   + sig(OUT_B_R) * sampleB
+                   + sig(OUT_CMB_R) * sampleComb
+                   + sig(OUT_SVF_R) * sampleSVF;
+
+        mainSample *= drive;                                                    // Right Sample Shaper
+        tmpVar = mainSample;
+
+        mainSample = sinP3_wrap(mainSample);
+        mainSample = threeRanges(mainSample, tmpVar, fold);
+
+        tmpVar = mainSample * mainSample;
+        tmpVar = tmpVar - bank.m_stateVarR;
+        bank.m_stateVarR = tmpVar * m_warpedConst_30hz + bank.m_stateVarR + DNC_CONST;
+
+        bank.m_mixL[f] = mainSampleL * bank.m_fade;
+        bank.m_mixR[f] = parAsym(mainSample, tmpVar, asym) * bank.m_fade;
+
+        bank.m_fade = floatMax(bank.m_fade - bank.m_fadeStep, splat(0.f));    // Voice Fade
+    }
+
+    if(freeze)
+    {
+        freezeLanes(bank, frozen, active);
+    }
+}
+
+
+
+/******************************************************************************/
+/** @brief    adds the shaped samples of the active voices (bits of
+              _activeVoices) of one voice group to _mixL/_mixR in voice order
+              (groups have to be mixed in order, too - then the sum equals the
+              one of the per voice outputmixer)
+*******************************************************************************/
+
+void ae_voicebank::mix(uint32_t _group, uint32_t _frames, uint32_t _activeVoices, float *_mixL, float *_mixR)
+{
+    const group &bank = m_group[_group];
+    const uint32_t voiceOffset = _group * dsp_simd_lanes;
+    const uint32_t lanes = std::min(m_voices - voiceOffset, static_cast<uint32_t>(dsp_simd_lanes));
+
+    for(uint32_t l = 0; l < lanes; l++)
+    {
+        if(!(_activeVoices & (1u << (voiceOffset + l))))
+        {
+            continue;
+        }
+
+        for(uint32_t f = 0; f < _frames; f++)
+        {
+            _mixL[f] += bank.m_mixL[f][l];
+            _mixR[f] += bank.m_mixR[f][l];
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/******************************************************************************/
+/** @file           ae_voicebank.h
+    @version        1.0
+    @brief          Voice parallel (structure of arrays) poly chain:
+                    Soundgenerator, Combfilter, State Variable Filter and the
+                    Outputmixer shaping for dsp_simd_lanes voices at once
+    @todo
+*******************************************************************************/
+
+#pragma once
+
+#include "ae_simd.h"
+#include "ae_soundgenerator.h"
+#include "ae_combfilter.h"
+#include "ae_svfilter.h"
+#include "ae_outputmixer.h"
+#include "pe_defines_config.h"
+#include "dsp_shared_signal.h"
+
+/* The per voice modules (ae_soundgenerator, ae_combfilter, ae_svfilter) stay the owners of all states and coefficients
+   and remain the reference implementation. The voice bank loads them into vectors before rendering a block, stores the
+   states back afterwards and reads/writes the comb filter delay buffers of the modules in place. */
+struct ae_voicebank
+{
+    typedef NlToolbox::Simd::vfloat vfloat;
+    typedef NlToolbox::Simd::vint vint;
+
+    void load(ae_soundgenerator *_soundgenerator, ae_combfilter *_combfilter, ae_svfilter *_svfilter, ae_outputmixer &_outputmixer, uint32_t _voices);
+    void loadCoeffs(const ae_soundgenerator *_soundgenerator, const ae_combfilter *_combfilter, const ae_svfilter *_svfilter);
+    void store(ae_soundgenerator *_soundgenerator, ae_combfilter *_combfilter, ae_svfilter *_svfilter, ae_outputmixer &_outputmixer);
+    void storeActivity(ae_outputmixer &_outputmixer);
+    void clearPeaks();
+
+    void render(uint32_t _group, uint32_t _frames, const shared_signal *_signal, const float *_flushFade, uint32_t _activeVoices);
+    void mix(uint32_t _group, uint32_t _frames, uint32_t _activeVoices, float *_mixL, float *_mixR);
+
+    uint32_t m_voices = 0;
+    uint32_t m_groups = 0;
+    float *m_delayBase = nullptr;                                       // delay buffer of voice 0, the others are addressed by offset
+    int32_t m_delayMask = 0;                                            // all delay buffers have the same size (sample rate dependent)
+    float m_delayClip = 0.f;                                            // longest delay: size - 3
+    float m_warpedConst_30hz = 0.f;
+
+    /* groups are rendered concurrently by dsp_workers, so each one owns its cache lines */
+    struct alignas(64) group
+    {
+        //***************************** Soundgenerator ****************************//
+        vfloat m_sampleA, m_sampleB;
+        vfloat m_sample_interval;
+        vfloat m_oscA_selfmix, m_oscA_crossmix, m_oscA_phase, m_oscA_phase_stateVar, m_oscA_phaseInc, m_OscA_randVal_float;
+        vfloat m_oscB_selfmix, m_oscB_crossmix, m_oscB_phase, m_oscB_phase_stateVar, m_oscB_phaseInc, m_OscB_randVal_float;
+        vint m_OscA_randVal_int, m_OscB_randVal_int;
+        vfloat m_chirpA_omega, m_chirpA_a0, m_chirpA_a1, m_chirpA_stateVar;
+        vfloat m_chirpB_omega, m_chirpB_a0, m_chirpB_a1, m_chirpB_stateVar;
+
+        //******************************* Combfilter ******************************//
+        vfloat m_sampleComb, m_decayStateVar, m_decayGain;
+        vfloat m_hpCoeff_b0, m_hpCoeff_b1, m_hpCoeff_a1, m_hpInStateVar, m_hpOutStateVar;
+        vfloat m_lpCoeff, m_lpStateVar;
+        vfloat m_apCoeff_1, m_apCoeff_2, m_apStateVar_1, m_apStateVar_2, m_apStateVar_3, m_apStateVar_4;
+        vfloat m_delaySamples, m_delayConst, m_delayStateVar;
+        vint m_delayBufferInd, m_delayOffset;
+
+        //************************* State Variable Filter *************************//
+        vfloat m_sampleSVF, m_warpConst_2PI;
+        vfloat m_first_attenuation, m_second_attenuation;
+        vfloat m_first_fir_stateVar, m_second_fir_stateVar;
+        vfloat m_first_int1_stateVar, m_first_int2_stateVar;
+        vfloat m_second_int1_stateVar, m_second_int2_stateVar;
+        vfloat m_first_sv_sample, m_first_sat_stateVar, m_second_sat_stateVar;
+
+        //******************************* Outputmixer *****************************//
+        vfloat m_stateVarL, m_stateVarR;
+        vfloat m_peak;                                                  // voice activity: peak of the mixed samples
+        vfloat m_fade, m_fadeStep;                                      // output gain (stolen voices fade out)
+        vfloat m_mixL[dsp_block_max_frames], m_mixR[dsp_block_max_frames];    // shaped samples of the last render(), per voice
+    } m_group[dsp_simd_groups];
+};
@@ -0,0 +1,54 @@
+/******************************************************************************/
+/** @file           allocation_trap.cpp
+    @version        1.0
+    @brief          debug builds only: aborts with a message, whenever the
+                    thread allocates (operator new) while an AllocationTrap
+                    is in scope (parameter setters and the voice loop must
+                    not allocate on the audio thread)
+    @todo
+*******************************************************************************/
+
+#include "allocation_trap.h"
+
+#ifndef NDEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+
+thread_local unsigned int AllocationTrap::sDepth = 0;
+
+void AllocationTrap::check(size_t _size)
+{
+    if (sDepth > 0)
+    {
+        fprintf(stderr, "AllocationTrap: %zu bytes allocated in an allocation free scope\n", _size);
+        abort();
+    }
+}
+
+/******************************************************************************/
+/** @brief    replaced global operator new (the nothrow and array forms end up
+ *            here as well), memory is released by the default operator delete
+*******************************************************************************/
+
+void* operator new(size_t _size)
+{
+    AllocationTrap::check(_size);
+
+    void* memory = malloc(_size > 0 ? _size : 1);
+
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void* operator new[](size_t _size)
+{
+    return operator new(_size);
+}
+
+#endif
@@ -0,0 +1,29 @@
+/******************************************************************************/
+/** @file           allocation_trap.h
+    @version        1.0
+    @brief          debug builds only: aborts with a message, whenever the
+                    thread allocates (operator new) while an AllocationTrap
+                    is in scope (parameter setters and the voice loop must
+                    not allocate on the audio thread)
+    @todo
+*******************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+
+class AllocationTrap
+{
+public:
+#ifndef NDEBUG
+    AllocationTrap()  { sDepth++; }
+    ~AllocationTrap() { sDepth--; }
+
+    static void check(size_t _size);                // called by operator new
+
+private:
+    static thread_local unsigned int sDepth;        // number of armed traps of the thread
+#else
+    static void check(size_t) {}
+#endif
+};
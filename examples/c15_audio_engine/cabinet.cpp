@@ -34,12 +34,12 @@ Cabinet::Cabinet()
     mSaturation = NlToolbox::Conversion::db2af(0.5f * -12.f);
     mSaturationConst = (0.1588f / mSaturation);
 
-    pHighpass = new BiquadFilters(61.f, 0.f, 0.5, BiquadFilterType::HIGHPASS);
-    pLowpass_1 = new BiquadFilters(4700.f, 0.f, 0.5, BiquadFilterType::LOWPASS);
-    pLowpass_2 = new BiquadFilters(4700.f * 1.333f, 0.f, 0.5, BiquadFilterType::LOWPASS);
-    pLowshelf_1 = new TiltFilters(1200.f, -12.f, 2.f, 0.5f, TiltFilterType::LOWSHELF);
-    pLowshelf_2 = new TiltFilters(1200.f, -12.f * (-1.f), 2.f, 0.5f, TiltFilterType::LOWSHELF);
-    pHighpass30Hz = new NlToolbox::Filters::Highpass30Hz(SAMPLERATE);
+    mHighpass = BiquadFilters(61.f, 0.f, 0.5, BiquadFilterType::HIGHPASS);
+    mLowpass_1 = BiquadFilters(4700.f, 0.f, 0.5, BiquadFilterType::LOWPASS);
+    mLowpass_2 = BiquadFilters(4700.f * 1.333f, 0.f, 0.5, BiquadFilterType::LOWPASS);
+    mLowshelf_1 = TiltFilters(1200.f, -12.f, 2.f, 0.5f, TiltFilterType::LOWSHELF);
+    mLowshelf_2 = TiltFilters(1200.f, -12.f * (-1.f), 2.f, 0.5f, TiltFilterType::LOWSHELF);
+    mHighpass30Hz = NlToolbox::Filters::Highpass30Hz(SAMPLERATE);
 
     mSmootherMask = 0x0000;
     mDry_ramp = 1.0f;
@@ -71,12 +71,12 @@ Cabinet::Cabinet(float _drive,
     mSaturation = NlToolbox::Conversion::db2af(0.5f * _tilt);
     mSaturationConst = (0.1588f / mSaturation);
 
-    pHighpass = new BiquadFilters(_loCut, 0.f, 0.5, BiquadFilterType::HIGHPASS);
-    pLowpass_1 = new BiquadFilters(_hiCut, 0.f, 0.5, BiquadFilterType::LOWPASS);
-    pLowpass_2 = new BiquadFilters(_hiCut * 1.333f, 0.f, 0.5, BiquadFilterType::LOWPASS);
-    pLowshelf_1 = new TiltFilters(1200.f, _tilt, 2.f, 0.5f, TiltFilterType::LOWSHELF);
-    pLowshelf_2 = new TiltFilters(1200.f, _tilt * (-1.f), 2.f, 0.5f, TiltFilterType::LOWSHELF);
-    pHighpass30Hz = new NlToolbox::Filters::Highpass30Hz(SAMPLERATE);
+    mHighpass = BiquadFilters(_loCut, 0.f, 0.5, BiquadFilterType::HIGHPASS);
+    mLowpass_1 = BiquadFilters(_hiCut, 0.f, 0.5, BiquadFilterType::LOWPASS);
+    mLowpass_2 = BiquadFilters(_hiCut * 1.333f, 0.f, 0.5, BiquadFilterType::LOWPASS);
+    mLowshelf_1 = TiltFilters(1200.f, _tilt, 2.f, 0.5f, TiltFilterType::LOWSHELF);
+    mLowshelf_2 = TiltFilters(1200.f, _tilt * (-1.f), 2.f, 0.5f, TiltFilterType::LOWSHELF);
+    mHighpass30Hz = NlToolbox::Filters::Highpass30Hz(SAMPLERATE);
 
     mSmootherMask = 0x0000;
     mDry_ramp = 1.0f;
@@ -86,22 +86,6 @@ Cabinet::Cabinet(float _drive,
 
 
 
-/******************************************************************************/
-/** Cabinet Destructor
- * @brief   Destroys the created Filter Objects
-*******************************************************************************/
-
-Cabinet::~Cabinet()
-{
-    delete pHighpass;
-    delete pLowpass_1;
-    delete pLowpass_2;
-    delete pLowshelf_1;
-    delete pLowshelf_2;
-    delete pHighpass30Hz;
-}
-
-
 /*****************************************************************************/
 /** @brief    interface method which converts and scales the incoming midi
  *            values and passes these to the respective methods
@@ -120,8 +104,8 @@ void Cabinet::setCabinetParams(unsigned char _ctrlId, float _ctrlVal)
 #endif
             _ctrlVal = pow(2.f, (_ctrlVal - 69.f) / 12) * 440.f;    //Pitch to Freq [261Hz .. 26580Hz]
 
-            pLowpass_1->setCutFreq(_ctrlVal);
-            pLowpass_2->setCutFreq(_ctrlVal * 1.333f);
+            mLowpass_1.setCutFreq(_ctrlVal);
+            mLowpass_2.setCutFreq(_ctrlVal * 1.333f);
             break;
 
         case CtrlId::LOCUT:
@@ -131,7 +115,7 @@ void Cabinet::setCabinetParams(unsigned char _ctrlId, float _ctrlVal)
 #endif
             _ctrlVal = pow(2.f, (_ctrlVal - 69.f) / 12) * 440.f;    //Pitch to Freq [26Hz .. 2637Hz]
 
-            pHighpass->setCutFreq(_ctrlVal);
+            mHighpass.setCutFreq(_ctrlVal);
             break;
 
         case CtrlId::MIX:
@@ -193,8 +177,8 @@ void Cabinet::setCabinetParams(unsigned char _ctrlId, float _ctrlVal)
 #ifdef PRINT_PARAMVALUES
             printf("Cabinet - Tilt: %f\n", _ctrlVal);
 #endif
-            pLowshelf_1->setTilt(_ctrlVal);
-            pLowshelf_2->setTilt(_ctrlVal * (-1.f));
+            mLowshelf_1.setTilt(_ctrlVal);
+            mLowshelf_2.setTilt(_ctrlVal * (-1.f));
 
             mSaturation = NlToolbox::Conversion::db2af(0.5f * _ctrlVal);
             mSaturationConst = (0.1588f / mSaturation);
@@ -239,11 +223,11 @@ void Cabinet::applyCab(float _rawSample)
 
 
     //*************************** Biquad Highpass ***************************//
-    processedSample = pHighpass->applyFilter(processedSample);
+    processedSample = mHighpass.applyFilter(processedSample);
 
 
     //************************** 1st Tilt Lowshelf **************************//
-    processedSample = pLowshelf_1->applyFilter(processedSample);
+    processedSample = mLowshelf_1.applyFilter(processedSample);
 
 
     //******************************* Shaper ********************************//
@@ -253,19 +237,19 @@ void Cabinet::applyCab(float _rawSample)
     processedSample = NlToolbox::Math::sinP3_wrap(processedSample);
     processedSample = NlToolbox::Others::threeRanges(processedSample, ctrlSample, mFold);
 
-    float processedSample_square = pHighpass30Hz->applyFilter(processedSample * processedSample);
+    float processedSample_square = mHighpass30Hz.applyFilter(processedSample * processedSample);
 
     processedSample = NlToolbox::Others::parAsym(processedSample, processedSample_square, mAsym);
     processedSample *= mSaturation;
 
 
     //************************* 2nd Tilt Lowshelf ***************************//
-    processedSample = pLowshelf_2->applyFilter(processedSample);
+    processedSample = mLowshelf_2.applyFilter(processedSample);
 
 
     //************************* 2 Biquad Lowpass ****************************//
-    processedSample = pLowpass_1->applyFilter(processedSample);
-    processedSample = pLowpass_2->applyFilter(processedSample);
+    processedSample = mLowpass_1.applyFilter(processedSample);
+    processedSample = mLowpass_2.applyFilter(processedSample);
 
 
     //**************************** Crossfade ********************************//
@@ -29,7 +29,7 @@ public:
             float _cabLvl,
             float _mix);
 
-    ~Cabinet();                             // Class Destructor
+    ~Cabinet(){}                            // Class Destructor
 
     float mCabinetOut;                      // public processed sample
 
@@ -50,12 +50,12 @@ private:
 
 
     //**************************** Cabinet Filters ****************************//
-    BiquadFilters* pHighpass;       // first highpass
-    BiquadFilters* pLowpass_1;      // first lowpass
-    BiquadFilters* pLowpass_2;      // second lowpass
-    TiltFilters* pLowshelf_1;       // first lowshelf
-    TiltFilters* pLowshelf_2;       // second lowshelf
-    NlToolbox::Filters::Highpass30Hz* pHighpass30Hz;        // 1-Pole 30Hz Highpass for Smoothing within the sineShaper function
+    BiquadFilters mHighpass;        // first highpass
+    BiquadFilters mLowpass_1;       // first lowpass
+    BiquadFilters mLowpass_2;       // second lowpass
+    TiltFilters mLowshelf_1;        // first lowshelf
+    TiltFilters mLowshelf_2;        // second lowshelf
+    NlToolbox::Filters::Highpass30Hz mHighpass30Hz;         // 1-Pole 30Hz Highpass for Smoothing within the sineShaper function
 
 
     //************************** Smoothing Variables *************************//
@@ -51,7 +51,7 @@ CombFilter::CombFilter()
     mDecayStateVar = 0.f;
 
     //***************************** Highpass *********************************//
-    pHighpass = new OnePoleFilters(60.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass = OnePoleFilters(60.f, 0.f, OnePoleFilterType::HIGHPASS);
 
     //****************************** Allpass *********************************//
     mAllpassTune = 140.f;
@@ -77,9 +77,8 @@ CombFilter::CombFilter()
 
     //***************************** Delay ************************************//
     mSampleBufferIndex = 0;
-    mSampleBuffer = {0.f};
 
-    mDelayClipMin = SAMPLERATE / (COMB_BUFFERSIZE - 2);
+    mDelayClipMin = SAMPLERATE / (DelayLine::sizeFor(COMB_MAX_DELAYTIME * SAMPLERATE) - 2);
     mDelaySamples = 0.f;
     mDelayStateVar = 0.f;
 
@@ -135,7 +134,7 @@ CombFilter::CombFilter(float _ABMix,
     mDecayStateVar = 0.f;
 
     //***************************** Highpass *********************************//
-    pHighpass = new OnePoleFilters(60.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass = OnePoleFilters(60.f, 0.f, OnePoleFilterType::HIGHPASS);
 
     //****************************** Allpass *********************************//
     mAllpassTune = _allpassTune;
@@ -161,9 +160,8 @@ CombFilter::CombFilter(float _ABMix,
 
     //***************************** Delay ************************************//
     mSampleBufferIndex = 0;
-    mSampleBuffer = {0.f};
 
-    mDelayClipMin = SAMPLERATE / (COMB_BUFFERSIZE - 2);
+    mDelayClipMin = SAMPLERATE / (DelayLine::sizeFor(COMB_MAX_DELAYTIME * SAMPLERATE) - 2);
     mDelaySamples = 0.f;
     mDelayStateVar = 0.f;
 
@@ -177,18 +175,6 @@ CombFilter::CombFilter(float _ABMix,
 
 
 
-/******************************************************************************/
-/** Comb Filter Destructor
- * @brief
-*******************************************************************************/
-
-CombFilter::~CombFilter()
-{
-    delete pHighpass;
-}
-
-
-
 /******************************************************************************/
 /** @brief    main function which applies the comb filter on the incoming
  *            samples from the Soundgenerators
@@ -216,7 +202,7 @@ void CombFilter::applyCombFilter(float _sampleA, float _sampleB)
 
 
     //************************** 1-Pole Highpass ****************************//
-    mCombFilterOut = pHighpass->applyFilter(mCombFilterOut);
+    mCombFilterOut = mHighpass.applyFilter(mCombFilterOut);
 
 
     //*************************** 1-Pole Lowpass ****************************//
@@ -301,9 +287,9 @@ void CombFilter::applyCombFilter(float _sampleA, float _sampleB)
     sampleVar = sampleVar * phaseMod + sampleVar;   // phM
     sampleVar = sampleVar - 1.f;
 
-    if (sampleVar > COMB_BUFFERSIZE_M3)                // Clip 1, size-3
+    if (sampleVar > mSampleBuffer.mMask - 2)           // Clip 1, size-3
     {
-        sampleVar = COMB_BUFFERSIZE_M3;
+        sampleVar = mSampleBuffer.mMask - 2;
     }
     else if (sampleVar < 1.f)
     {
@@ -323,10 +309,10 @@ void CombFilter::applyCombFilter(float _sampleA, float _sampleB)
     ind_tp1 = mSampleBufferIndex - ind_tp1;
     ind_tp2 = mSampleBufferIndex - ind_tp2;
 
-    ind_tm1 &= COMB_BUFFERSIZE_M1;                             // Wrap with a mask sampleBuffer.size()-1
-    ind_t0  &= COMB_BUFFERSIZE_M1;
-    ind_tp1 &= COMB_BUFFERSIZE_M1;
-    ind_tp2 &= COMB_BUFFERSIZE_M1;
+    ind_tm1 &= mSampleBuffer.mMask;                            // Wrap with a mask sampleBuffer.size()-1
+    ind_t0  &= mSampleBuffer.mMask;
+    ind_tp1 &= mSampleBuffer.mMask;
+    ind_tp2 &= mSampleBuffer.mMask;
 
     mCombFilterOut = NlToolbox::Math::interpolRT(delaySamples_fract,          // Interpolation
                                                  mSampleBuffer[ind_tm1],
@@ -339,7 +325,7 @@ void CombFilter::applyCombFilter(float _sampleA, float _sampleB)
     /// Hier wird am ende och mal mit EnvC multiplieziert
     /// mCombFilterOut *= env;
 
-    mSampleBufferIndex = (mSampleBufferIndex + 1) & COMB_BUFFERSIZE_M1;      // increase index and check boundaries
+    mSampleBufferIndex = (mSampleBufferIndex + 1) & mSampleBuffer.mMask;     // increase index and check boundaries
 
 
     //****************************** Decay ********************************//
@@ -675,7 +661,7 @@ void CombFilter::calcMainFreq()
 
     calcDecayGain();                     // calculates mDecayGain, with new mMainFreq
 
-    pHighpass->setCutFreq(mMainFreq * 0.125f);
+    mHighpass.setCutFreq(mMainFreq * 0.125f);
 }
 
 
@@ -925,7 +911,32 @@ void CombFilter::calcDelayTime()
 
 void CombFilter::resetBuffer()
 {
-    mSampleBuffer.fill(0.f);
+    mSampleBuffer.clear();
+}
+
+
+
+/*****************************************************************************/
+/** @brief    sample buffer sized for the lowest comb frequency at the sample
+ *            rate (mDelayClipMin is derived from the same size)
+******************************************************************************/
+
+void CombFilter::initDelayLines(EngineArena& _arena, DelayFlush& _flush)
+{
+    mSampleBuffer.init(_arena, DelayLine::sizeFor(COMB_MAX_DELAYTIME * SAMPLERATE));
+    _flush.add(&mSampleBuffer);
+}
+
+
+
+size_t CombFilter::delayFootprint()
+{
+    return DelayLine::footprint(DelayLine::sizeFor(COMB_MAX_DELAYTIME * SAMPLERATE));
 }
 
 
+
+size_t CombFilter::footprint() const
+{
+    return sizeof(CombFilter) + mSampleBuffer.footprint();
+}
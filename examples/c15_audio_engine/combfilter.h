@@ -15,12 +15,10 @@
 #pragma once
 
 #include "nltoolbox.h"
-#include <array>
 #include "onepolefilters.h"
+#include "delay_line.h"
 
-#define COMB_BUFFERSIZE 8192
-#define COMB_BUFFERSIZE_M1 8191
-#define COMB_BUFFERSIZE_M3 8189
+#define COMB_MAX_DELAYTIME 0.17f            // longest delay in seconds (the lowest comb frequency is about 6 Hz)
 
 class CombFilter                        // Combfilter Class
 {
@@ -42,7 +40,7 @@ public:
                float _phaseModMix);
 
 
-    ~CombFilter();              // Class Destructor
+    ~CombFilter(){}             // Class Destructor
 
     float mCombFilterOut;       // public processed output sample
 
@@ -60,6 +58,10 @@ public:
     float mFlushFade;
     void resetBuffer();
 
+    void initDelayLines(EngineArena& _arena, DelayFlush& _flush);     // takes the sample buffer from the arena, the flush clears it
+    static size_t delayFootprint();                                 // arena memory initDelayLines() will take
+    size_t footprint() const;                                       // memory of the module including its sample buffer
+
 private:
     float mPitch;               // Incoming Pitch from a key
     float mMainFreq;            // Frequency after Pitch Edit
@@ -87,7 +89,7 @@ private:
 
 
     //******************************* Highpass ***********************************//
-    OnePoleFilters* pHighpass;
+    OnePoleFilters mHighpass;
 
 
     //******************************** Allpass ***********************************//
@@ -130,7 +132,6 @@ private:
 
     //***************************** Delay ************************************//
     uint32_t mSampleBufferIndex;
-    std::array<float, COMB_BUFFERSIZE> mSampleBuffer;
 
     float mDelayClipMin;
     float mDelaySamples;
@@ -221,4 +222,7 @@ private:
         PHASEMOD
 #endif
     };
+
+    //**************************** Sample Buffers ****************************//
+    DelayLine mSampleBuffer;
 };
@@ -0,0 +1,138 @@
+/******************************************************************************/
+/** @file           delay_line.h
+    @version        1.0
+    @brief          delay line: a ring buffer of samples taken from an engine
+                    arena, sized from the longest delay at the actual sample
+                    rate (rounded up to a power of two for mask wrapping)
+                    delay flush: clears a set of delay lines in chunks, one
+                    chunk per period, while the flush fade holds the output
+                    muted (for as many periods as the clear takes)
+    @todo
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <algorithm>
+#include <stdexcept>
+#include "engine_arena.h"
+
+#define DELAY_LINE_TAPS     3                       // samples needed beyond the integer delay (4 point interpolation and the written sample)
+#define DELAY_FLUSH_CHUNK   16384                   // samples a delay flush clears per step (64 kB of stores per period)
+#define DELAY_FLUSH_LINES   64                      // number of delay lines one delay flush can clear
+
+class DelayLine
+{
+public:
+    /* smallest power of two, which holds the longest delay (in samples) and the interpolation taps */
+    static constexpr uint32_t sizeFor(float _maxDelaySamples)
+    {
+        uint32_t size = 1;
+
+        while (size < static_cast<uint32_t>(_maxDelaySamples) + DELAY_LINE_TAPS)
+        {
+            size <<= 1;
+        }
+
+        return size;
+    }
+
+    /* memory a line of _size samples takes in the arena */
+    static constexpr size_t footprint(uint32_t _size)
+    {
+        return EngineArena::footprint<float>(_size);
+    }
+
+    /* takes the memory from the arena and clears it (touching every page outside of the audio thread),
+       more than one channel are interleaved: sample i of channel c is [i * _channels + c] */
+    void init(EngineArena& _arena, uint32_t _size, uint32_t _channels = 1)
+    {
+        pData = _arena.createBuffer(_size * _channels);
+        mSize = _size * _channels;
+        mMask = _size - 1;
+        clear();
+    }
+
+    void clear()
+    {
+        std::fill(pData, pData + mSize, 0.f);
+    }
+
+    void clear(uint32_t _from, uint32_t _count)
+    {
+        std::fill(pData + _from, pData + _from + _count, 0.f);
+    }
+
+    size_t footprint() const
+    {
+        return footprint(mSize);
+    }
+
+    /* raw access, the index has to be wrapped with mMask */
+    inline float& operator[](int32_t _index)
+    {
+        return pData[_index];
+    }
+
+    float* pData = nullptr;
+    uint32_t mSize = 0;                             // samples of all channels
+    uint32_t mMask = 0;                             // wraps the index of one channel
+};
+
+
+
+class DelayFlush
+{
+public:
+    /* registers a line (at init time, after its memory was taken from the arena) */
+    void add(DelayLine* _line)
+    {
+        if (mNumLines == DELAY_FLUSH_LINES)
+        {
+            throw std::length_error("DelayFlush: too many delay lines");
+        }
+
+        pLines[mNumLines++] = _line;
+    }
+
+    /* clears the next DELAY_FLUSH_CHUNK samples (once per period), nothing is left to do when all lines are clear */
+    void step()
+    {
+        uint32_t budget = DELAY_FLUSH_CHUNK;
+
+        while (mLine < mNumLines && budget > 0)
+        {
+            DelayLine* line = pLines[mLine];
+            uint32_t count = std::min(budget, line->mSize - mOffset);
+
+            line->clear(mOffset, count);
+            mOffset += count;
+            budget -= count;
+
+            if (mOffset == line->mSize)
+            {
+                mLine++;
+                mOffset = 0;
+            }
+        }
+    }
+
+    /* are all lines clear (since the last restart)? */
+    bool done() const
+    {
+        return mLine == mNumLines;
+    }
+
+    /* the next flush starts with the first line again */
+    void restart()
+    {
+        mLine = 0;
+        mOffset = 0;
+    }
+
+private:
+    DelayLine* pLines[DELAY_FLUSH_LINES];
+    uint32_t mNumLines = 0;
+    uint32_t mLine = 0;                             // line and sample the next step starts with
+    uint32_t mOffset = 0;
+};
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include "dsp_host.h"
 
@@ -8,7 +9,7 @@ dsp_host::dsp_host()
     m_mainOut_R = 0.f;
     m_mainOut_L = 0.f;
     /* init shared signal array */
-//    m_paramsignaldata[dsp_number_of_voices][sig_number_of_signal_items] = {};
+//    m_paramsignaldata = {};
 }
 
 /* proper init - initialize engine(s) according to sampleRate and polyphony */
@@ -16,12 +17,16 @@ void dsp_host::init(uint32_t _samplerate, uint32_t _polyphony)
 {
     /* set up configuration */
     m_samplerate = _samplerate;
-    m_voices = _polyphony;
+    m_voices = std::min(_polyphony, static_cast<uint32_t>(dsp_number_of_voices));  // the arrays are sized for the polyphony of the build
+    if(m_voices < _polyphony)
+    {
+        std::cout << "DSP_HOST::INIT: polyphony " << _polyphony << " exceeds this build, limited to " << m_voices << " voices" << std::endl;
+    }
     m_clockDivision[2] = _samplerate / dsp_clock_rates[0];
     m_clockDivision[3] = _samplerate / dsp_clock_rates[1];
     m_upsampleFactor = _samplerate / 48000;
     /* initialize components */
-    m_params.init(_samplerate, _polyphony);
+    m_params.init(_samplerate, m_voices);
     m_decoder.init();
     /* init messages to terminal */
     std::cout << "DSP_HOST::INIT(samplerate: " << m_samplerate << ", voices: " << m_voices << ")" << std::endl;
@@ -30,12 +35,31 @@ void dsp_host::init(uint32_t _samplerate, uint32_t _polyphony)
     std::cout << "DSP_HOST::upsampleFactor: " << m_upsampleFactor << std::endl;
 
     /* Audio Engine */
-    initAudioEngine(static_cast<float>(_samplerate), _polyphony);
+    initAudioEngine(static_cast<float>(_samplerate), m_voices);
+    std::cout << "DSP_HOST::MEMORY(host: " << footprint() << " bytes, combfilter: " << m_combfilter[0].footprint();
+    std::cout << " bytes per voice, delay arena: " << m_delayArena.mappedSize() << " bytes mapped";
+    std::cout << (m_delayArena.mHugePages ? ", huge pages)" : ")") << std::endl;
+
+    /* Voice Governor */
+    m_governor.init(m_voices);
+    m_voiceFading = 0;
+    m_voiceFadeStep = 1.f / (dsp_governor_fade_time * static_cast<float>(_samplerate));
 
     /* Load Initial Preset (TCD zero for every Parameter) */
     loadInitialPreset();
 }
 
+/* the comb filters are members of the host, only their delay buffers (and the fade table) live elsewhere */
+size_t dsp_host::footprint() const
+{
+    size_t size = sizeof(dsp_host) + m_raised_cos_table.capacity() * sizeof(float);
+    for(uint32_t p = 0; p < m_voices; p++)
+    {
+        size += m_combfilter[p].m_delayBuffer.footprint();
+    }
+    return size;
+}
+
 /* */
 void dsp_host::loadInitialPreset()
 {
@@ -58,25 +82,182 @@ void dsp_host::loadInitialPreset()
 /* */
 void dsp_host::tickMain()
 {
-    /* provide indices for items, voices and parameters */
-    uint32_t i, v, p;
+    /* first: evaluate slow and fast clock status */
+    tickSubAudio();
+    /* second: evaluate audio clock (always) - mono and poly rendering and post processing */
+    tickAudioParams();
+
+    /* Reset Outputmixer Sum Samples */
+    m_outputmixer.m_sampleL = 0.f;
+    m_outputmixer.m_sampleR = 0.f;
+//    m_mainOut_L = 0.f;
+//    m_mainOut_R = 0.f;
+
+    /*set the current fadepoint*/
+    float flushFadePoint = m_raised_cos_table[m_tableCounter];
+
+    for(uint32_t v = 0; v < m_voices; v++)
+    {
+        /* AUDIO_ENGINE: poly dsp phase (active voices only) */
+        if(m_voiceActive & (1u << v))
+        {
+            m_combfilter[v].m_flushFadePoint = flushFadePoint;
+            makePolySound(m_paramsignaldata[v], v);
+            /* the faded voice sample is summed like in the voice bank - bit exact only without fp contraction (-ffp-contract=off, see CMakeLists.txt) */
+            m_outputmixer.m_sampleL += m_outputmixer.m_voiceSampleL;
+            m_outputmixer.m_sampleR += m_outputmixer.m_voiceSampleR;
+        }
+    }
+
+    /* AUDIO_ENGINE: mono dsp phase */
+    makeMonoSound(m_paramsignaldata[0]);
+    tickFlushFade();
+
+    /* finally: update (fast and slow) clock positions */
+    m_clockPosition[2] = (m_clockPosition[2] + 1) % m_clockDivision[2];
+    m_clockPosition[3] = (m_clockPosition[3] + 1) % m_clockDivision[3];
+}
+
+/* block rendering - produces exactly the samples of _frames consecutive tickMain() calls, followed by tickPeriod() (_outR may be null) */
+void dsp_host::tickBlock(float *_outL, float *_outR, uint32_t _frames)
+{
+    /* provide indices for frames and voices */
+    uint32_t f, v;
+    uint32_t done = 0;
+#if dsp_poly_simd == 1
+    /* the per voice modules keep all states, the voice bank works on a transposed copy during the block */
+    m_voicebank.load(m_soundgenerator, m_combfilter, m_svfilter, m_outputmixer, m_voices);
+#endif
+    while(done < _frames)
+    {
+        /* a sub-block never crosses a sub-audio clock boundary, so slow and fast rendering only happen at its start */
+        uint32_t frames = _frames - done;
+        frames = std::min(frames, m_clockDivision[2] - m_clockPosition[2]);
+        frames = std::min(frames, m_clockDivision[3] - m_clockPosition[3]);
+        frames = std::min(frames, static_cast<uint32_t>(dsp_block_max_frames));
+        /* first: evaluate slow and fast clock status */
+#if dsp_poly_simd == 1
+        const bool slowClock = m_clockPosition[3] == 0;
+        if(slowClock)
+        {
+            /* the voice activity check needs the current peaks and fades */
+            m_voicebank.storeActivity(m_outputmixer);
+        }
+        tickSubAudio();
+        if(slowClock)
+        {
+            /* new filter coefficients, restarted peak tracking */
+            m_voicebank.loadCoeffs(m_soundgenerator, m_combfilter, m_svfilter);
+            m_voicebank.clearPeaks();
+        }
+        /* only groups with active voices are rendered */
+        m_blockGroupCount = 0;
+        for(v = 0; v < m_voicebank.m_groups; v++)
+        {
+            if((m_voiceActive >> (v * dsp_simd_lanes)) & ((1u << dsp_simd_lanes) - 1))
+            {
+                m_blockGroups[m_blockGroupCount++] = v;
+            }
+        }
+#else
+        tickSubAudio();
+#endif
+        /* second: audio clock parameters, rendered sample by sample - the shared signal array and the flush fade point are kept per frame
+           (the fade only depends on the delay flush, which progresses in tickPeriod(), so it can run ahead of the mono dsp phase) */
+        for(f = 0; f < frames; f++)
+        {
+            tickAudioParams();
+            m_blockSignal[f] = m_paramsignaldata;
+            m_blockFlushFade[f] = m_raised_cos_table[m_tableCounter];
+            tickFlushFade();
+            m_blockMixL[f] = 0.f;
+            m_blockMixR[f] = 0.f;
+        }
+        /* third: AUDIO_ENGINE poly dsp phase - each voice and module over the whole sub-block */
+#if dsp_poly_simd == 1
+        /* fork/join: the groups are independent, their shaped samples are summed in voice order afterwards (bit exact for any thread count) */
+        m_blockFrames = frames;
+        if(m_blockGroupCount > 0)
+        {
+            m_workers.run(renderVoiceGroup, this, m_blockGroupCount);
+        }
+        for(v = 0; v < m_blockGroupCount; v++)
+        {
+            m_voicebank.mix(m_blockGroups[v], frames, m_voiceActive, m_blockMixL, m_blockMixR);
+        }
+#else
+        for(v = 0; v < m_voices; v++)
+        {
+            if(m_voiceActive & (1u << v))
+            {
+                makePolyBlock(v, frames);
+            }
+        }
+#endif
+        /* fourth: AUDIO_ENGINE mono dsp phase */
+        for(f = 0; f < frames; f++)
+        {
+            m_outputmixer.m_sampleL = m_blockMixL[f];
+            m_outputmixer.m_sampleR = m_blockMixR[f];
+            makeMonoSound(m_blockSignal[f][0]);
+            _outL[done + f] = m_mainOut_L;
+            if(_outR)
+            {
+                _outR[done + f] = m_mainOut_R;
+            }
+        }
+        /* finally: update (fast and slow) clock positions */
+        m_clockPosition[2] = (m_clockPosition[2] + frames) % m_clockDivision[2];
+        m_clockPosition[3] = (m_clockPosition[3] + frames) % m_clockDivision[3];
+        done += frames;
+    }
+#if dsp_poly_simd == 1
+    m_voicebank.store(m_soundgenerator, m_combfilter, m_svfilter, m_outputmixer);
+#endif
+    tickPeriod();
+}
+
+/* once per period (after its samples) - work, which is paced by periods rather than samples */
+void dsp_host::tickPeriod()
+{
+    /* the flush fade holds at its muted point, while the delay buffers are cleared in chunks */
+    if(m_flushnow && m_tableCounter == m_flushIndex)
+    {
+        m_delayFlush.step();
+    }
+}
+
+#if dsp_poly_simd == 1
+/* poly dsp phase of one (active) voice group - called by m_workers, possibly on a worker thread */
+void dsp_host::renderVoiceGroup(void *_host, uint32_t _index)
+{
+    dsp_host *host = static_cast<dsp_host*>(_host);
+    host->m_voicebank.render(host->m_blockGroups[_index], host->m_blockFrames, host->m_blockSignal, host->m_blockFlushFade, host->m_voiceActive);
+}
+#endif
+
+/* slow and fast clock rendering - only performed if the clock position is zero */
+void dsp_host::tickSubAudio()
+{
+    /* provide index for voices */
+    uint32_t v;
     /* first: evaluate slow clock status */
     if(m_clockPosition[3] == 0)
     {
+        /* voice activity check */
+        updateVoiceActivity();
         /* render slow mono parameters and perform mono post processing */
-        for(p = 0; p < m_params.m_clockIds.m_data[3].m_data[0].m_length; p++)
-        {
-            i = m_params.m_head[m_params.m_clockIds.m_data[3].m_data[0].m_data[p]].m_index;
-            m_params.tickItem(i);
-        }
+        m_params.tickMonoRamps(3);
         m_params.postProcessMono_slow(m_paramsignaldata[0]);
+        m_params.postProcessDistribution(m_paramsignaldata, 3);
         /* render slow poly parameters and perform poly slow post processing */
+        m_params.tickPolyRamps(3);                                      // all voices, ramps of idle voices keep running (a woken voice continues in time)
+        const uint32_t ticked = m_voiceActive | 1u;                    // idle voices are not post processed (voice 0 carries the mono signals)
         for(v = 0; v < m_voices; v++)
         {
-            for(p = 0; p < m_params.m_clockIds.m_data[3].m_data[1].m_length; p++)
+            if(!(ticked & (1u << v)))
             {
-                i = m_params.m_head[m_params.m_clockIds.m_data[3].m_data[1].m_data[p]].m_index + v;
-                m_params.tickItem(i);
+                continue;
             }
             m_params.postProcessPoly_slow(m_paramsignaldata[v], v);
 
@@ -91,64 +272,48 @@ void dsp_host::tickMain()
     if(m_clockPosition[2] == 0)
     {
         /* render fast mono parameters and perform mono post processing */
-        for(p = 0; p < m_params.m_clockIds.m_data[2].m_data[0].m_length; p++)
-        {
-            i = m_params.m_head[m_params.m_clockIds.m_data[2].m_data[0].m_data[p]].m_index;
-            m_params.tickItem(i);
-        }
+        m_params.tickMonoRamps(2);
         m_params.postProcessMono_fast(m_paramsignaldata[0]);
+        m_params.postProcessDistribution(m_paramsignaldata, 2);
         /* render fast poly parameters and perform poly fast post processing */
+        m_params.tickPolyRamps(2);                                      // all voices, ramps of idle voices keep running
+        const uint32_t ticked = m_voiceActive | 1u;                    // idle voices are not post processed (voice 0 carries the mono signals)
         for(v = 0; v < m_voices; v++)
         {
-            for(p = 0; p < m_params.m_clockIds.m_data[2].m_data[1].m_length; p++)
+            if(!(ticked & (1u << v)))
             {
-                i = m_params.m_head[m_params.m_clockIds.m_data[2].m_data[1].m_data[p]].m_index + v;
-                m_params.tickItem(i);
+                continue;
             }
             m_params.postProcessPoly_fast(m_paramsignaldata[v], v);
         }
     }
-    /* third: evaluate audio clock (always) - mono rendering and post processing, poly rendering and post processing */
-    for(p = 0; p < m_params.m_clockIds.m_data[1].m_data[0].m_length; p++)
-    {
-        /* render mono audio parameters */
-        i = m_params.m_head[m_params.m_clockIds.m_data[1].m_data[0].m_data[p]].m_index;
-        m_params.tickItem(i);
-    }
-    m_params.postProcessMono_audio(m_paramsignaldata[0]);
-
-    /* Reset Outputmixer Sum Samples */
-    m_outputmixer.m_sampleL = 0.f;
-    m_outputmixer.m_sampleR = 0.f;
-//    m_mainOut_L = 0.f;
-//    m_mainOut_R = 0.f;
-
-    /*set the current fadepoint*/
-    float flushFadePoint = m_raised_cos_table[m_tableCounter];
+}
 
+/* audio clock rendering - mono rendering and post processing, poly rendering and post processing (envelopes) */
+void dsp_host::tickAudioParams()
+{
+    /* provide index for voices */
+    uint32_t v;
+    /* render mono audio parameters */
+    m_params.tickMonoRamps(1);
+    m_params.postProcessMono_audio(m_paramsignaldata[0]);
+    m_params.postProcessDistribution(m_paramsignaldata, 1);
+
+    /* idle voices are not post processed (voice 0 carries the mono signals) */
+    const uint32_t ticked = m_voiceActive | 1u;
+    /* envelope rendering (all ticked voices at once) */
+    m_params.tickPolyEnvelopes(ticked);
+    /* render poly audio parameters (all voices, ramps of idle voices keep running) */
+    m_params.tickPolyRamps(1);
     for(v = 0; v < m_voices; v++)
     {
-        /* this is the MAIN POLYPHONIC LOOP - rendering (and post processing) parameters, envelopes and the AUDIO_ENGINE */
-        /* render poly audio parameters */
-        for(p = 0; p < m_params.m_clockIds.m_data[1].m_data[1].m_length; p++)
+        if(!(ticked & (1u << v)))
         {
-            i = m_params.m_head[m_params.m_clockIds.m_data[1].m_data[1].m_data[p]].m_index + v;
-            m_params.tickItem(i);
+            continue;
         }
-        /* post processing and envelope rendering */
+        /* post processing */
         m_params.postProcessPoly_audio(m_paramsignaldata[v], v);
-
-        /* AUDIO_ENGINE: poly dsp phase */
-        m_combfilter[v].m_flushFadePoint = flushFadePoint;
-        makePolySound(m_paramsignaldata[v], v);
     }
-
-    /* AUDIO_ENGINE: mono dsp phase */
-    makeMonoSound(m_paramsignaldata[0]);
-
-    /* finally: update (fast and slow) clock positions */
-    m_clockPosition[2] = (m_clockPosition[2] + 1) % m_clockDivision[2];
-    m_clockPosition[3] = (m_clockPosition[3] + 1) % m_clockDivision[3];
 }
 
 /* */
@@ -360,9 +525,9 @@ void dsp_host::preloadUpdate(uint32_t _mode, uint32_t _listId)
         m_decoder.m_listId = _listId;
         m_decoder.m_listIndex = 0;
         /* reset parameter preload counters */
-        for(p = 0; p < sig_number_of_param_items; p++)
+        for(p = 0; p < dsp_param_items; p++)
         {
-            m_params.m_body[p].m_preload = 0;
+            m_params.m_body.m_preload[p] = 0;
         }
         /* reset key event preload counters */
         m_params.m_event.m_mono.m_preload = 0;
@@ -527,11 +692,21 @@ void dsp_host::keyApply(uint32_t _voiceId)
     /* keyDown events cause triggers to the AUDIO_ENGINE */
     if(m_params.m_event.m_poly[_voiceId].m_type == 1)
     {
+        /* idle and stolen voices start from clean states */
+        if(!(m_voiceActive & (1u << _voiceId)) || (m_voiceFading & (1u << _voiceId)))
+        {
+            wakeVoice(_voiceId);
+        }
+
+        /* the voice governor makes room for the new voice */
+        m_voiceStart[_voiceId] = ++m_voiceStartCount;
+        stealVoices(1u << _voiceId);
+
         /*Audio DSP trigger */
         m_combfilter[_voiceId].setDelaySmoother();
 
         /* determine note steal */
-        if(m_params.m_body[m_params.m_head[P_KEY_VS].m_index].m_signal == 1)
+        if(m_params.m_body.m_signal[m_params.m_head[P_KEY_VS].m_index] == 1)
         {
             /* AUDIO_ENGINE: trigger voice-steal */
         }
@@ -541,18 +716,117 @@ void dsp_host::keyApply(uint32_t _voiceId)
         }
         /* OLD approach of phase reset - over shared array */
         /* update and reset oscillator phases */
-        //m_paramsignaldata[_voiceId][OSC_A_PHS] = m_params.m_body[m_params.m_head[P_KEY_PA].m_index + _voiceId].m_signal;  // POLY PHASE_A -> OSC_A Phase
+        //m_paramsignaldata[_voiceId][OSC_A_PHS] = m_params.m_body.m_signal[m_params.m_head[P_KEY_PA].m_index + _voiceId];  // POLY PHASE_A -> OSC_A Phase
 
         /* AUDIO_ENGINE: reset oscillator phases */
         //resetOscPhase(m_paramsignaldata[_voiceId], _voiceId);
         /* NEW approach of phase reset - no array involved - still only unisono phase */
 
-        float phaseA = m_params.m_body[m_params.m_head[P_KEY_PA].m_index + _voiceId].m_signal;
-        float phaseB = m_params.m_body[m_params.m_head[P_KEY_PB].m_index + _voiceId].m_signal;
+        float phaseA = m_params.m_body.m_signal[m_params.m_head[P_KEY_PA].m_index + _voiceId];
+        float phaseB = m_params.m_body.m_signal[m_params.m_head[P_KEY_PB].m_index + _voiceId];
         m_soundgenerator[_voiceId].resetPhase(phaseA, phaseB);
     }
 }
 
+/* voice activity check (slow clock) - a released voice goes idle, once its mixer inputs stayed below the threshold for dsp_voice_idle_hold samples */
+void dsp_host::updateVoiceActivity()
+{
+    for(uint32_t v = 0; v < m_voices; v++)
+    {
+        if(m_voiceFading & (1u << v))
+        {
+            /* a stolen voice goes idle, once it faded out */
+            if(m_outputmixer.m_fade[v] <= 0.f)
+            {
+                m_voiceActive &= ~(1u << v);
+                m_voiceFading &= ~(1u << v);
+            }
+        }
+        else if(m_voiceActive & (1u << v))
+        {
+            if((m_outputmixer.m_peak[v] < dsp_voice_idle_threshold) && m_params.polyEnvelopesIdle(v))
+            {
+                m_voiceQuiet[v] += m_clockDivision[3];
+                if(m_voiceQuiet[v] >= dsp_voice_idle_hold)
+                {
+                    m_voiceActive &= ~(1u << v);
+                }
+            }
+            else
+            {
+                m_voiceQuiet[v] = 0;
+            }
+        }
+        m_outputmixer.m_peak[v] = 0.f;
+    }
+}
+
+/* key down on an idle voice - clear the module states and catch up on the sub-audio signals, which were not rendered while idle */
+void dsp_host::wakeVoice(uint32_t _voiceID)
+{
+    m_soundgenerator[_voiceID].resetDSP();
+    m_combfilter[_voiceID].resetDSP();
+    m_svfilter[_voiceID].resetDSP();
+    m_outputmixer.resetVoice(_voiceID);
+
+    m_params.postProcessPoly_slow(m_paramsignaldata[_voiceID], _voiceID);
+    setPolyFilterCoeffs(m_paramsignaldata[_voiceID], _voiceID);
+    m_params.postProcessPoly_fast(m_paramsignaldata[_voiceID], _voiceID);
+
+    m_voiceActive |= 1u << _voiceID;
+    m_voiceFading &= ~(1u << _voiceID);
+    m_voiceQuiet[_voiceID] = 0;
+}
+
+/* voice governor (once per period) - a thin render margin lowers the allowed polyphony, the surplus voices are stolen */
+void dsp_host::governVoices(float _load)
+{
+    const uint32_t sounding = static_cast<uint32_t>(__builtin_popcount(m_voiceActive & ~m_voiceFading));
+    m_governor.update(_load, sounding);
+    stealVoices(0);
+}
+
+/* voice stealing - sounding voices beyond the allowed polyphony fade out: released voices first, then the quietest, then the oldest */
+void dsp_host::stealVoices(uint32_t _keep)
+{
+    /* true, if voice _a is stolen before voice _b */
+    auto stealsFirst = [this](uint32_t _a, uint32_t _b)
+    {
+        const bool releasedA = m_params.m_event.m_poly[_a].m_type == 0;
+        const bool releasedB = m_params.m_event.m_poly[_b].m_type == 0;
+        if(releasedA != releasedB)
+        {
+            return releasedA;
+        }
+        if(m_outputmixer.m_peak[_a] != m_outputmixer.m_peak[_b])
+        {
+            return m_outputmixer.m_peak[_a] < m_outputmixer.m_peak[_b];
+        }
+        return m_voiceStart[_a] < m_voiceStart[_b];
+    };
+
+    uint32_t sounding = m_voiceActive & ~m_voiceFading;
+    while(static_cast<uint32_t>(__builtin_popcount(sounding)) > m_governor.m_limit)
+    {
+        int32_t steal = -1;
+        for(uint32_t v = 0; v < m_voices; v++)
+        {
+            if((sounding & ~_keep & (1u << v)) && ((steal < 0) || stealsFirst(v, static_cast<uint32_t>(steal))))
+            {
+                steal = static_cast<int32_t>(v);
+            }
+        }
+        if(steal < 0)
+        {
+            break;
+        }
+        m_outputmixer.fadeVoice(static_cast<uint32_t>(steal), m_voiceFadeStep);
+        m_voiceFading |= 1u << steal;
+        sounding &= ~(1u << steal);
+        m_governor.countStolen();
+    }
+}
+
 /* End of Main Definition, Test functionality below:
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - *
  */
@@ -958,12 +1232,11 @@ void dsp_host::testGetParamRenderData()
         uint32_t index = obj->m_index;
         for(uint32_t i = 0; i < obj->m_size; i++)
         {
-            param_body* item = &m_params.m_body[index];
             std::cout << "P(" << obj->m_id << ", " << i << "):\t";
-            std::cout << "state: " << item->m_state << ",\tpreload: " << item->m_preload;
-            std::cout << ",\tsignal: " << item->m_signal << ",\tdx:[" << item->m_dx[0] << ", " << item->m_dx[1] << "]";
-            std::cout << ",\tx: " << item->m_x << ",\tstart: " << item->m_start;
-            std::cout << ",\tdiff: " << item->m_diff << ",\tdest: " << item->m_dest << std::endl;
+            std::cout << "state: " << m_params.m_body.m_state[index] << ",\tpreload: " << m_params.m_body.m_preload[index];
+            std::cout << ",\tsignal: " << m_params.m_body.m_signal[index] << ",\tdx:[" << m_params.m_body.m_dx[0][index] << ", " << m_params.m_body.m_dx[1][index] << "]";
+            std::cout << ",\tx: " << m_params.m_body.m_x[index] << ",\tstart: " << m_params.m_body.m_start[index];
+            std::cout << ",\tdiff: " << m_params.m_body.m_diff[index] << ",\tdest: " << m_params.m_body.m_dest[index] << std::endl;
             index++;
         }
     }
@@ -1038,10 +1311,14 @@ void dsp_host::initAudioEngine(float _samplerate, uint32_t _polyphony)
     }
 
     //****************************** DSP Modules *****************************//
+    m_delayArena.init(_polyphony * DelayLine::footprint(DelayLine::sizeFor(COMB_MAX_DELAY_TIME * _samplerate)));
+    m_delayFlush = DelayFlush();
+
     for (uint32_t p = 0; p < _polyphony; p++)
     {
         m_soundgenerator[p].init(_samplerate, p);
-        m_combfilter[p].init(_samplerate, p);
+        m_combfilter[p].init(_samplerate, p, m_delayArena);
+        m_delayFlush.add(&m_combfilter[p].m_delayBuffer);
         m_svfilter[p].init(_samplerate, p);
     }
 
@@ -1054,7 +1331,7 @@ void dsp_host::initAudioEngine(float _samplerate, uint32_t _polyphony)
 /**
 *******************************************************************************/
 
-void dsp_host::makePolySound(float *_signal, uint32_t _voiceID)
+void dsp_host::makePolySound(voice_signal _signal, uint32_t _voiceID)
 {
     //***************************** Soundgenerator ***************************//
     //************************* Oscillators n Shapers ************************//
@@ -1082,34 +1359,90 @@ void dsp_host::makePolySound(float *_signal, uint32_t _voiceID)
 
 
 
+/******************************************************************************/
+/** @brief    poly dsp phase of one voice over a sub-block, module by module
+              (same results as makePolySound() per frame, the output mixer sums
+              into m_blockMixL/R in voice order)
+*******************************************************************************/
+
+void dsp_host::makePolyBlock(uint32_t _voiceID, uint32_t _frames)
+{
+    uint32_t f;
+
+    //***************************** Soundgenerator ***************************//
+    //************************* Oscillators n Shapers ************************//
+    ae_soundgenerator &soundgenerator = m_soundgenerator[_voiceID];
+
+    for(f = 0; f < _frames; f++)
+    {
+        soundgenerator.generateSound(0.f, m_blockSignal[f][_voiceID]);          /// _feedbackSample
+        m_blockSampleA[f] = soundgenerator.m_sampleA;
+        m_blockSampleB[f] = soundgenerator.m_sampleB;
+    }
+
+    //****************************** Comb Filter *****************************//
+    ae_combfilter &combfilter = m_combfilter[_voiceID];
+
+    for(f = 0; f < _frames; f++)
+    {
+        combfilter.m_flushFadePoint = m_blockFlushFade[f];
+        combfilter.applyCombfilter(m_blockSampleA[f], m_blockSampleB[f], m_blockSignal[f][_voiceID]);
+        m_blockSampleComb[f] = combfilter.m_sampleComb;
+    }
+
+    //************************* State Variable Filter ************************//
+    ae_svfilter &svfilter = m_svfilter[_voiceID];
+
+    for(f = 0; f < _frames; f++)
+    {
+        svfilter.applySVFilter(m_blockSampleA[f], m_blockSampleB[f], m_blockSampleComb[f], m_blockSignal[f][_voiceID]);
+        m_blockSampleSVF[f] = svfilter.m_sampleSVF;
+    }
+
+    //****************************** Outputmixer *****************************//
+    for(f = 0; f < _frames; f++)
+    {
+        m_outputmixer.mixAndShape(m_blockSampleA[f], m_blockSampleB[f], m_blockSampleComb[f], m_blockSampleSVF[f],
+                                  m_blockSignal[f][_voiceID], _voiceID);
+        m_blockMixL[f] += m_outputmixer.m_voiceSampleL;
+        m_blockMixR[f] += m_outputmixer.m_voiceSampleR;
+    }
+}
+
+
+
 /******************************************************************************/
 /**
 *******************************************************************************/
 
-void dsp_host::makeMonoSound(float *_signal)
+void dsp_host::tickFlushFade()
 {
     //****************************** Fade n Flush ****************************//
     if (m_flushnow)
     {
-        if (m_tableCounter == m_flushIndex)
+        /* muted point: the fade holds, until the delay buffers are cleared (one chunk per period, see tickPeriod()) */
+        if (m_tableCounter != m_flushIndex || m_delayFlush.done())
         {
-            printf("flushing all buffers ... \n");
-            for (uint32_t voiceNumber = 0; voiceNumber < dsp_number_of_voices; voiceNumber++)
+            m_tableCounter++;
+
+            if (m_tableCounter == m_fadeSamples)
             {
-                m_combfilter[voiceNumber].m_delayBuffer.fill(0.f);
+                m_tableCounter = 0;
+                m_flushnow = false;
+                m_delayFlush.restart();
             }
         }
-
-        if (m_tableCounter > m_fadeSamples)
-        {
-            m_tableCounter = 0;
-            m_flushnow = false;
-        }
-        else
-        {
-            m_tableCounter++;
-        }
     }
+}
+
+
+
+/******************************************************************************/
+/**
+*******************************************************************************/
+
+void dsp_host::makeMonoSound(voice_signal _signal)
+{
     //****************************** Mono Modules ****************************//
     m_outputmixer.filterAndLevel(_signal);
 
@@ -1164,7 +1497,7 @@ void dsp_host::makeMonoSound(float *_signal)
 /**
 *******************************************************************************/
 
-inline void dsp_host::setPolyFilterCoeffs(float *_signal, uint32_t _voiceID)
+inline void dsp_host::setPolyFilterCoeffs(voice_signal _signal, uint32_t _voiceID)
 {
     //************************ Osciallator Chirp Filter **********************//
     m_soundgenerator[_voiceID].m_chirpFilter_A.setCoeffs(_signal[OSC_A_CHI]);
@@ -1184,7 +1517,7 @@ inline void dsp_host::setPolyFilterCoeffs(float *_signal, uint32_t _voiceID)
 /**
 *******************************************************************************/
 
-inline void dsp_host::setMonoFilterCoeffs(float *_signal)
+inline void dsp_host::setMonoFilterCoeffs(voice_signal _signal)
 {
 
 }
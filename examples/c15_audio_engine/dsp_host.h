@@ -23,6 +23,11 @@
 #include "ae_combfilter.h"
 #include "ae_svfilter.h"
 #include "ae_outputmixer.h"
+#include "ae_voicebank.h"
+#include "dsp_workers.h"
+#include "dsp_voice_governor.h"
+
+static_assert(dsp_number_of_voices <= 32, "voice activity is kept in a 32 bit mask");
 
 /* dsp_host: main dsp object, holding TCD Decoder, Parameter Engine, Audio Engine, shared Signal Array, main signal (L, R) */
 class dsp_host
@@ -35,8 +40,8 @@ public:
     uint32_t m_clockPosition[dsp_clock_types] = {0, 0, 0, 0};           // sample clock data structure
     uint32_t m_clockDivision[dsp_clock_types] = {0, 1, 5, 120};         // clock division settings (defaults to 48000 Hz sampleRate)
     uint32_t m_upsampleFactor = 1;                                      // time conversion handle (sampleRate / 48000)
-    /* hosting shared param signal array */
-    float m_paramsignaldata[dsp_number_of_voices][sig_number_of_signal_items] = {};
+    /* hosting shared param signal array (voice lanes: [signal][voice], see dsp_shared_signal.h) */
+    shared_signal m_paramsignaldata;
     /* main signal output (left, right) */
     float m_mainOut_R, m_mainOut_L;                                     // final stereo (monophonic) audio (output) signal
     /* local data structures */
@@ -45,8 +50,11 @@ public:
     /* proper init (samplerate & polyphony) */
     void init(uint32_t _samplerate, uint32_t _polyphony);               // proper initialization
     void loadInitialPreset();                                           // load initial preset for valid values in signal array (before rendering begins)
+    size_t footprint() const;                                           // memory of the host including the comb filter delay buffers
     /* the two main interaction methods */
     void tickMain();                                                    // main trigger for sample clock operations
+    void tickBlock(float *_outL, float *_outR, uint32_t _frames);       // block rendering (equivalent to tickMain() per frame, then tickPeriod())
+    void tickPeriod();                                                  // once per period, after tickMain() of all its frames (tickBlock() calls it)
     void evalMidi(uint32_t _status, uint32_t _data0, uint32_t _data1);  // main trigger for MIDI input (TCD)
     /* main TCD mechanism commands */
     void voiceSelectionUpdate();                                        // evaluation of the voice selection mechanism
@@ -88,13 +96,53 @@ public:
     ae_combfilter m_combfilter[dsp_number_of_voices];
     ae_svfilter m_svfilter[dsp_number_of_voices];
     ae_outputmixer m_outputmixer;
+    EngineArena m_delayArena;                                           // delay buffers of the comb filters (sized by the sample rate)
+    DelayFlush m_delayFlush;                                            // clears the delay buffers in chunks (one per period) at the muted point of the flush fade
 
     void initAudioEngine(float _samplerate, uint32_t _polyphony);
-    void makePolySound(float *_signal, uint32_t _voiceID);
-    void makeMonoSound(float *_signal);
+    void makePolySound(voice_signal _signal, uint32_t _voiceID);
+    void makeMonoSound(voice_signal _signal);
+    void tickFlushFade();                                               // advances the flush fade by one sample (after the mono dsp phase)
+
+    /* voice activity: idle voices (released and silent) are neither rendered nor post processed, a key down wakes them with clean states
+       (their live ramps keep running, voice 0 always ticks, as its signal row carries the mono signals) */
+    uint32_t m_voiceActive = 0;                                         // one bit per voice
+    uint32_t m_voiceQuiet[dsp_number_of_voices] = {};                   // samples, a released voice stayed below dsp_voice_idle_threshold
+    void updateVoiceActivity();                                         // slow clock: active voices may go idle
+    void wakeVoice(uint32_t _voiceID);                                  // key down on an idle voice
+
+    /* voice governor: the polyphony follows the render load, voices beyond it are stolen (faded out within dsp_governor_fade_time) */
+    dsp_voice_governor m_governor;
+    uint32_t m_voiceFading = 0;                                         // one bit per stolen voice, fading out (goes idle when silent)
+    uint32_t m_voiceStart[dsp_number_of_voices] = {};                   // key down order of the voices (oldest first)
+    uint32_t m_voiceStartCount = 0;
+    float m_voiceFadeStep = 0.f;                                        // fade decrement per sample
+    void governVoices(float _load);                                     // once per period: load = render time / period time
+    void stealVoices(uint32_t _keep);                                   // fades out voices beyond the allowed polyphony (except the _keep bits)
+
+    /* block rendering: per frame signal snapshots and per module sample buffers of the current sub-block */
+    shared_signal m_blockSignal[dsp_block_max_frames];
+    float m_blockSampleA[dsp_block_max_frames], m_blockSampleB[dsp_block_max_frames];
+    float m_blockSampleComb[dsp_block_max_frames], m_blockSampleSVF[dsp_block_max_frames];
+    float m_blockMixL[dsp_block_max_frames], m_blockMixR[dsp_block_max_frames];
+    float m_blockFlushFade[dsp_block_max_frames];                       // flush fade point of every frame (the fade runs on during a sub-block)
+#if dsp_poly_simd == 1
+    /* voice parallel poly chain, reading the signal snapshots of the current sub-block */
+    ae_voicebank m_voicebank;
+    /* voice groups of a sub-block are shared between the audio thread and the workers (started by the handle, one thread by default) */
+    dsp_workers m_workers;
+    uint32_t m_blockFrames = 0;
+    uint32_t m_blockGroups[dsp_simd_groups] = {};                       // voice groups with at least one active voice
+    uint32_t m_blockGroupCount = 0;
+    static void renderVoiceGroup(void *_host, uint32_t _index);         // dsp_workers job: one active voice group over the current sub-block
+#endif
+
+    void tickSubAudio();                                                // slow and fast clock rendering (if due)
+    void tickAudioParams();                                             // audio clock parameter rendering (mono and poly)
+    void makePolyBlock(uint32_t _voiceID, uint32_t _frames);            // poly dsp phase of one voice over a sub-block
 
-    inline void setPolyFilterCoeffs(float *_signal, uint32_t _voiceID);
-    inline void setMonoFilterCoeffs(float *_signal);
+    inline void setPolyFilterCoeffs(voice_signal _signal, uint32_t _voiceID);
+    inline void setMonoFilterCoeffs(voice_signal _signal);
 
     bool m_flushnow;
     float m_fadepoint;
@@ -6,6 +6,11 @@
 
 #include <common/stopwatch.h>
 
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
 /* run the program either in pure TCD mode (0) or test functionality (1) */
 #define testFlag 1
 
@@ -16,18 +21,42 @@ namespace DSP_HOST_HANDLE {
 
     dsp_host m_host;    // renamed member dsp_host to m_host (Matthias)
 
-    /** @brief    Callback function for Sine Generator and Audio Input - testing with ReMote 61
-            @param    Input Buffer
-            @param    Output Buffer
+    // Audio runs above MIDI, both above everything else. No need to chrt the threads by hand anymore.
+    // The audio thread owns core 0, so it never competes with a spinning voice worker of equal priority.
+    const RealtimePolicy audioThreadPolicy(SCHED_FIFO, 80, {0});
+    const RealtimePolicy midiThreadPolicy(SCHED_FIFO, 70);
+    // Voice workers run on behalf of the audio thread, so they get its priority. Worker n is pinned to core n.
+    const RealtimePolicy voiceThreadPolicy(SCHED_FIFO, 80, {1, 2, 3});
 
-            @param    buffer size
-            @param    Sample Specs
+    /** @brief    starts the voice workers of the host - by default one per core besides the audio thread
+                  (cores 1 - 3 on the quad core target), never more threads than cores or voice groups:
+                  spinning workers sharing a core with the audio thread would only steal its time
     */
-    void dspHostCallback(uint8_t *out, const SampleSpecs &sampleSpecs __attribute__ ((unused)), SharedUserPtr ptr)
+    void startVoiceWorkers()
     {
+#if dsp_poly_simd == 1
+        const uint32_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+        const uint32_t idleCores = std::min(cores - 1, static_cast<uint32_t>(voiceThreadPolicy.cpus.size()));
+        uint32_t threads = dsp_render_threads > 0 ? std::min(static_cast<uint32_t>(dsp_render_threads), cores) : idleCores + 1;
+        threads = std::min(threads, static_cast<uint32_t>(dsp_simd_groups));
+        m_host.m_workers.start(threads, voiceThreadPolicy);
+        std::cout << "DSP_HOST_HANDLE::voiceThreads: " << threads << std::endl;
+#endif
+    }
 
+    // Interned by the control functions, so the audio callback never touches the scope table
+    StopWatch::ScopeId m_stopWatchScope = 0;
 
-        StopBlockTime(sw, "dsp_host");
+    /** @brief    Callback function for Sine Generator and Audio Input - testing with ReMote 61
+            @param    Output Buffer, one float array per channel
+            @param    frames per channel
+
+            @param    Sample Specs
+    */
+    void dspHostCallback(float* const* out, unsigned int frames, const SampleSpecs &sampleSpecs, SharedUserPtr ptr)
+    {
+        StopBlockTime sbt(sw, m_stopWatchScope);
+        const auto periodeStart = std::chrono::steady_clock::now();
         auto midiBuffer = getBufferForName("MidiBuffer");
 
         //---------------- Retrieve Midi Information if midi values have changed
@@ -49,32 +78,34 @@ namespace DSP_HOST_HANDLE {
             }
         }
 
-        for (unsigned int frameIndex = 0; frameIndex < sampleSpecs.buffersizeInFramesPerPeriode; ++frameIndex)
-        {
-            m_host.tickMain();
+        // The device converts to its own format, we only deliver float samples
+        float *out_L = out[0];
+        float *out_R = sampleSpecs.channels > 1 ? out[1] : nullptr;
+
+        // Render the whole periode at once, module by module
+        m_host.tickBlock(out_L, out_R, frames);
 
-            float outputSample;
+        // The voice governor adapts the polyphony to the share of the periode, MIDI and rendering took
+        const std::chrono::duration<float> renderTime = std::chrono::steady_clock::now() - periodeStart;
+        m_host.governVoices(renderTime.count() * static_cast<float>(sampleSpecs.samplerate) / static_cast<float>(frames));
 
-            for (unsigned int channelIndex = 0; channelIndex < sampleSpecs.channels; ++channelIndex)
+        for (unsigned int frameIndex = 0; frameIndex < frames; ++frameIndex)
+        {
+            const float outputSample_L = out_L[frameIndex];
+            const float outputSample_R = out_R ? out_R[frameIndex] : 0.f;
+
+            if (outputSample_L > 1.f || outputSample_L < -1.f || outputSample_R > 1.f || outputSample_R < -1.f)     // Clipping
             {
-                if (channelIndex)
-                {
-                     outputSample = m_host.m_mainOut_R;
-                }
-                else if (!channelIndex)
-                {
-                     outputSample = m_host.m_mainOut_L;
-                }
-
-
-                if (outputSample > 1.f || outputSample < -1.f)                  // Clipping
-                {
-                    printf("WARNING!!! C15 CLIPPING!!!\n");
-                }
-
-                setSample(out, outputSample, frameIndex, channelIndex, sampleSpecs);
+                printf("WARNING!!! C15 CLIPPING!!!\n");
+                break;
             }
         }
+
+        // Further channels get a copy of the right one
+        for (unsigned int channelIndex = 2; channelIndex < sampleSpecs.channels; ++channelIndex)
+        {
+            std::copy(out_R, out_R + frames, out[channelIndex]);
+        }
     }
 
 
@@ -90,25 +121,65 @@ namespace DSP_HOST_HANDLE {
                                 unsigned int polyphony)
     {
         m_host.init(samplerate, polyphony);
+        startVoiceWorkers();
+        m_stopWatchScope = sw->scope("dsp_host");
         JobHandle ret;
 
         // No input here
         ret.inBuffer = nullptr;
         ret.audioInput = nullptr;
 
-        ret.outBuffer = createBuffer("OutputBuffer");
-        ret.audioOutput = createAlsaOutputDevice(audioOutCard, ret.outBuffer, buffersize);
+        // The callback runs on the device thread, so the output buffer stays unused
+        ret.outBuffer = createNonBlockingBuffer("OutputBuffer");
+        ret.audioOutput = createAlsaOutputDevice(audioOutCard, ret.outBuffer, buffersize, audioThreadPolicy);
         ret.audioOutput->setSamplerate(samplerate);
+        registerOutputCallbackOnDevice(ret.audioOutput, dspHostCallback, nullptr);
 
         ret.inMidiBuffer = createBuffer("MidiBuffer");
-        ret.midiInput = createRawMidiDevice(midiInCard, ret.inMidiBuffer);
+        ret.midiInput = createRawMidiDevice(midiInCard, ret.inMidiBuffer, midiThreadPolicy);
 
         ret.audioOutput->start();
         ret.midiInput->start();
 
-        ret.workingThreadHandle = registerOutputCallbackOnBuffer(ret.outBuffer, dspHostCallback, nullptr);
+        return ret;
+    }
+
+    /** @brief    runs the dsp host under JACK, samplerate and periode size are dictated by the JACK server
+    */
+    JobHandle dspHostJackControl(const AlsaAudioCardIdentifier &audioOutCard,
+                                 const AlsaMidiCardIdentifier &midiInCard,
+                                 unsigned int buffersize,
+                                 unsigned int polyphony)
+    {
+        m_stopWatchScope = sw->scope("dsp_host");
+        JobHandle ret;
+
+        // No input here
+        ret.inBuffer = nullptr;
+        ret.audioInput = nullptr;
+
+        // The callback runs in the JACK process callback, so the output buffer stays unused
+        ret.outBuffer = createNonBlockingBuffer("OutputBuffer");
+        ret.audioOutput = createJackOutputDevice(audioOutCard, ret.outBuffer, buffersize, audioThreadPolicy);
+        registerOutputCallbackOnDevice(ret.audioOutput, dspHostCallback, nullptr);
+
+        m_host.init(ret.audioOutput->getSamplerate(), polyphony);
+        startVoiceWorkers();
+
+        ret.inMidiBuffer = createBuffer("MidiBuffer");
+        ret.midiInput = createRawMidiDevice(midiInCard, ret.inMidiBuffer, midiThreadPolicy);
+
+        ret.audioOutput->start();
+        ret.midiInput->start();
 
         return ret;
     }
+
+    /** @brief    decisions of the voice governor, callable from any thread (restarts the peak load)
+    */
+    dsp_voice_statistics getVoiceStatistics()
+    {
+        return m_host.m_governor.getStatistics();
+    }
 } // namespace DSP_HOST
 } // namespace Nl
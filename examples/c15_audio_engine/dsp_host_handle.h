@@ -16,5 +16,12 @@ namespace DSP_HOST_HANDLE {
                                 unsigned int buffersize,
                                 unsigned int samplerate,
                                 unsigned int polyphony);
+
+    JobHandle dspHostJackControl(const AlsaAudioCardIdentifier &audioOutCard,
+                                 const AlsaMidiCardIdentifier &midiIn,
+                                 unsigned int buffersize,
+                                 unsigned int polyphony);
+
+    dsp_voice_statistics getVoiceStatistics();
 }   //namespace DSP_HOST
 }   //namespace NL
@@ -0,0 +1,45 @@
+/******************************************************************************/
+/** @file           dsp_shared_signal.h
+    @version        1.0
+    @brief          the shared signal array (m_paramsignaldata) in voice lanes:
+                    every signal is a row of dsp_simd_voices floats, so the
+                    voice bank loads it as vectors without transposing
+    @todo
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include "ae_simd.h"
+#include "pe_defines_config.h"
+#include "dsp_defines_signallabels.h"
+
+/* the signals of one voice (a column of the shared signal array), used like the former float array: _signal[OSC_A_FRQ] */
+struct voice_signal
+{
+    float *m_data;                                                      // points to signal 0 of the voice
+
+    inline float &operator[](const uint32_t _signalId) const
+    {
+        return m_data[_signalId * dsp_simd_voices];
+    }
+};
+
+/* shared signal array: [signal][voice], voice 0 carries the mono signals */
+struct alignas(64) shared_signal
+{
+    float m_data[sig_number_of_signal_items][dsp_simd_voices] = {};
+
+    inline voice_signal operator[](const uint32_t _voiceId)
+    {
+        return voice_signal{&m_data[0][_voiceId]};
+    }
+
+    inline void distribute(const uint32_t _signalId, const float _value)   // one value for all voices
+    {
+        for(uint32_t v = 0; v < dsp_simd_voices; v++)
+        {
+            m_data[_signalId][v] = _value;
+        }
+    }
+};
@@ -0,0 +1,110 @@
+/******************************************************************************/
+/** @file           dsp_voice_governor.cpp
+    @version        1.0
+    @brief          voice governor: adapts the allowed polyphony to the render
+                    load of the audio periods (losing a voice is better than
+                    a glitch of the whole output)
+    @todo
+*******************************************************************************/
+
+#include <algorithm>
+#include <ostream>
+#include "dsp_voice_governor.h"
+
+/******************************************************************************/
+/** @brief    starts with the full polyphony
+*******************************************************************************/
+
+void dsp_voice_governor::init(uint32_t _voices)
+{
+    m_voices = _voices;
+    m_minimum = std::min(_voices, static_cast<uint32_t>(dsp_governor_min_voices));
+    m_limit = _voices;
+    m_hold = 0;
+    m_calm = 0;
+    m_statLimit.store(_voices, std::memory_order_relaxed);
+}
+
+/******************************************************************************/
+/** @brief    evaluates the load of a period (render time / period time) -
+              a thin margin lowers the polyphony below the sounding voices at
+              once (the host steals the surplus), a long calm raises it again
+              voice by voice
+*******************************************************************************/
+
+uint32_t dsp_voice_governor::update(float _load, uint32_t _sounding)
+{
+    if(m_hold > 0)
+    {
+        m_hold--;
+    }
+
+    if(_load > dsp_governor_load_high)
+    {
+        m_calm = 0;
+        if(m_hold == 0)
+        {
+            /* a limit above the sounding voices would not lower the load */
+            const uint32_t sounding = std::min(m_limit, _sounding);
+            const uint32_t limit = std::max(sounding > 0 ? sounding - 1 : 0, m_minimum);
+            if(limit < m_limit)
+            {
+                m_limit = limit;
+                m_hold = dsp_governor_hold_periods;
+                m_statLowered.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    else if(_load < dsp_governor_load_low)
+    {
+        m_calm++;
+        if((m_calm >= dsp_governor_calm_periods) && (m_limit < m_voices))
+        {
+            m_limit++;
+            m_calm = 0;
+            m_statRaised.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        m_calm = 0;
+    }
+
+    m_statLimit.store(m_limit, std::memory_order_relaxed);
+    m_statLoad.store(_load, std::memory_order_relaxed);
+    if(_load > m_statPeakLoad.load(std::memory_order_relaxed))
+    {
+        m_statPeakLoad.store(_load, std::memory_order_relaxed);
+    }
+    return m_limit;
+}
+
+void dsp_voice_governor::countStolen()
+{
+    m_statStolen.fetch_add(1, std::memory_order_relaxed);
+}
+
+/******************************************************************************/
+/** @brief    the current decisions (callable from any thread)
+*******************************************************************************/
+
+dsp_voice_statistics dsp_voice_governor::getStatistics()
+{
+    dsp_voice_statistics stats;
+    stats.voices = m_voices;
+    stats.limit = m_statLimit.load(std::memory_order_relaxed);
+    stats.lowered = m_statLowered.load(std::memory_order_relaxed);
+    stats.raised = m_statRaised.load(std::memory_order_relaxed);
+    stats.stolen = m_statStolen.load(std::memory_order_relaxed);
+    stats.load = m_statLoad.load(std::memory_order_relaxed);
+    stats.peakLoad = m_statPeakLoad.exchange(0.f, std::memory_order_relaxed);
+    return stats;
+}
+
+std::ostream& operator<<(std::ostream& _lhs, const dsp_voice_statistics& _rhs)
+{
+    _lhs << "Voices: limit=" << _rhs.limit << "/" << _rhs.voices
+         << "  lowered=" << _rhs.lowered << "  raised=" << _rhs.raised << "  stolen=" << _rhs.stolen
+         << "  load=" << _rhs.load << "  peakLoad=" << _rhs.peakLoad;
+    return _lhs;
+}
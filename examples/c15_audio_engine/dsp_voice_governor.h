@@ -0,0 +1,60 @@
+/******************************************************************************/
+/** @file           dsp_voice_governor.h
+    @version        1.0
+    @brief          voice governor: adapts the allowed polyphony to the render
+                    load of the audio periods (losing a voice is better than
+                    a glitch of the whole output)
+    @todo
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <iosfwd>
+
+#define dsp_governor_load_high      0.8f            // a period rendered in more than this share of its time lowers the polyphony ...
+#define dsp_governor_load_low       0.5f            // ... which is raised again by one voice, once the load stayed below this share ...
+#define dsp_governor_calm_periods   2000            // ... for this many periods in a row
+#define dsp_governor_hold_periods   16              // periods after lowering, before the polyphony may be lowered again (stolen voices fade out meanwhile)
+#define dsp_governor_min_voices     4               // the polyphony is never lowered below this
+#define dsp_governor_fade_time      0.005f          // fade out time of a stolen voice (in seconds)
+
+/* the decisions of the governor, as reported */
+struct dsp_voice_statistics
+{
+    uint32_t voices;                                                    // polyphony of the host
+    uint32_t limit;                                                     // currently allowed polyphony
+    uint32_t lowered;                                                   // times the polyphony was lowered
+    uint32_t raised;                                                    // times the polyphony was raised
+    uint32_t stolen;                                                    // voices stolen (faded out) for the polyphony
+    float load;                                                         // load of the last period (render time / period time)
+    float peakLoad;                                                     // highest load since the last report
+};
+
+std::ostream& operator<<(std::ostream& _lhs, const dsp_voice_statistics& _rhs);
+
+/* dsp_voice_governor: update() is called by the audio thread once per period, getStatistics() by any other thread */
+class dsp_voice_governor
+{
+public:
+    void init(uint32_t _voices);
+    uint32_t update(float _load, uint32_t _sounding);                   // returns the allowed polyphony for the next period
+    void countStolen();                                                 // a voice was faded out for the polyphony
+    dsp_voice_statistics getStatistics();                               // restarts the peak load
+
+    uint32_t m_limit = 0;                                               // allowed polyphony (audio thread)
+
+private:
+    uint32_t m_voices = 0;
+    uint32_t m_minimum = 0;                                             // lowest allowed polyphony
+    uint32_t m_hold = 0;                                                // periods until lowering is possible again
+    uint32_t m_calm = 0;                                                // periods in a row below dsp_governor_load_low
+    /* reported values (written by the audio thread, the reader only restarts the peak load) */
+    std::atomic<uint32_t> m_statLimit{0};
+    std::atomic<uint32_t> m_statLowered{0};
+    std::atomic<uint32_t> m_statRaised{0};
+    std::atomic<uint32_t> m_statStolen{0};
+    std::atomic<float> m_statLoad{0.f};
+    std::atomic<float> m_statPeakLoad{0.f};
+};
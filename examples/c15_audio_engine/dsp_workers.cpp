@@ -0,0 +1,213 @@
+/******************************************************************************/
+/** @file           dsp_workers.cpp
+    @version        1.0
+    @brief          fork/join pool of pinned realtime worker threads, sharing
+                    the poly dsp phase of a sub-block with the audio thread
+    @todo
+*******************************************************************************/
+
+#include <climits>
+#include <string>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "dsp_workers.h"
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex words have to be plain 32 bit integers");
+
+/* tells the core that we are busy waiting (saves power and the sibling hyperthread) */
+static inline void cpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+/******************************************************************************/
+/** @brief    spins for dsp_worker_spin iterations, then sleeps until woken -
+              the sleeper count is raised before m_value is checked again and
+              wake() checks it after m_value was changed (both sequentially
+              consistent), so a wake up can not get lost
+*******************************************************************************/
+
+void dsp_futex::wait(uint32_t _old)
+{
+    for(uint32_t i = 0; i < dsp_worker_spin; i++)
+    {
+        if(m_value.load(std::memory_order_acquire) != _old)
+        {
+            return;
+        }
+        cpuRelax();
+    }
+
+    m_sleepers.fetch_add(1);
+
+    while(m_value.load() == _old)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_value), FUTEX_WAIT_PRIVATE, _old, nullptr, nullptr, 0);
+    }
+
+    m_sleepers.fetch_sub(1);
+}
+
+
+
+/******************************************************************************/
+/** @brief    wakes all sleeping threads - a single atomic load, if nobody sleeps
+*******************************************************************************/
+
+void dsp_futex::wake()
+{
+    if(m_sleepers.load() != 0)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_value), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+}
+
+
+
+/******************************************************************************/
+/** @brief    destructor, joins the workers
+*******************************************************************************/
+
+dsp_workers::~dsp_workers()
+{
+    stop();
+}
+
+
+
+/******************************************************************************/
+/** @brief    (re)starts the pool with _threads rendering threads, the caller of
+              run() counts as the first one - every worker applies _policy
+              to itself, worker n is pinned to _policy.cpus[n - 1] only
+              (not called from the audio thread, as it allocates)
+*******************************************************************************/
+
+void dsp_workers::start(uint32_t _threads, const Nl::RealtimePolicy &_policy)
+{
+    stop();
+
+    m_threads = _threads > 0 ? _threads : 1;
+    const uint32_t generation = m_generation.m_value.load();
+
+    for(uint32_t t = 1; t < m_threads; t++)
+    {
+        m_workers.emplace_back(workerLoop, this, t, generation, _policy);
+    }
+}
+
+
+
+/******************************************************************************/
+/** @brief    terminates and joins all workers, run() renders on the calling
+              thread only afterwards
+*******************************************************************************/
+
+void dsp_workers::stop()
+{
+    if(m_workers.empty())
+    {
+        return;
+    }
+
+    m_terminate.store(true);
+    m_generation.m_value.fetch_add(1);
+    m_generation.wake();
+
+    for(auto &worker : m_workers)
+    {
+        worker.join();
+    }
+
+    m_workers.clear();
+    m_terminate.store(false);
+    m_threads = 1;
+}
+
+
+
+/******************************************************************************/
+/** @brief    runs _job for the indices 0 .. (_count - 1), thread t takes the
+              indices t, t + threads, t + 2 * threads, ... - returns when all
+              jobs are done (lock free: no mutex, no allocation)
+*******************************************************************************/
+
+void dsp_workers::run(job _job, void *_context, uint32_t _count)
+{
+    m_job = _job;
+    m_context = _context;
+    m_count = _count;
+
+    if(m_threads == 1)
+    {
+        runShare(0);
+        return;
+    }
+
+    /* fork: publish the job, then release the workers */
+    m_pending.m_value.store(m_threads - 1, std::memory_order_relaxed);
+    m_generation.m_value.fetch_add(1);
+    m_generation.wake();
+
+    runShare(0);
+
+    /* join: the last worker wakes us, if we went to sleep */
+    uint32_t pending;
+
+    while((pending = m_pending.m_value.load(std::memory_order_acquire)) != 0)
+    {
+        m_pending.wait(pending);
+    }
+}
+
+
+
+/******************************************************************************/
+/** @brief    the jobs of one thread
+*******************************************************************************/
+
+void dsp_workers::runShare(uint32_t _thread)
+{
+    for(uint32_t i = _thread; i < m_count; i += m_threads)
+    {
+        m_job(m_context, i);
+    }
+}
+
+
+
+/******************************************************************************/
+/** @brief    worker thread: waits for a fork, runs its share and signals it
+*******************************************************************************/
+
+void dsp_workers::workerLoop(dsp_workers *_pool, uint32_t _thread, uint32_t _generation, Nl::RealtimePolicy _policy)
+{
+    if(!_policy.cpus.empty())
+    {
+        _policy.cpus = {_policy.cpus[(_thread - 1) % _policy.cpus.size()]};
+    }
+
+    Nl::applyRealtimePolicy(_policy, "c15_voices_" + std::to_string(_thread));
+
+    while(true)
+    {
+        _pool->m_generation.wait(_generation);
+        _generation = _pool->m_generation.m_value.load(std::memory_order_acquire);
+
+        if(_pool->m_terminate.load())
+        {
+            break;
+        }
+
+        _pool->runShare(_thread);
+
+        if(_pool->m_pending.m_value.fetch_sub(1) == 1)
+        {
+            _pool->m_pending.wake();
+        }
+    }
+}
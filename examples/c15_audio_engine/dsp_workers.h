@@ -0,0 +1,54 @@
+/******************************************************************************/
+/** @file           dsp_workers.h
+    @version        1.0
+    @brief          fork/join pool of pinned realtime worker threads, sharing
+                    the poly dsp phase of a sub-block with the audio thread
+    @todo
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <common/realtimepolicy.h>
+
+#define dsp_worker_spin             2000            // busy wait iterations before a waiting thread sleeps on the futex
+
+/* a 32 bit word, threads can wait on: spinning first, then sleeping in the kernel (only woken if somebody sleeps) */
+struct alignas(64) dsp_futex                                            // own cache line, the words are hammered by all threads
+{
+    std::atomic<uint32_t> m_value{0};
+    std::atomic<uint32_t> m_sleepers{0};
+
+    void wait(uint32_t _old);                                           // returns once m_value differs from _old
+    void wake();                                                        // call after m_value was changed
+};
+
+/* dsp_workers: the calling (audio) thread plus (threads - 1) workers, jobs are distributed round robin, run() returns when all are done */
+class dsp_workers
+{
+public:
+    typedef void (*job)(void *_context, uint32_t _index);
+
+    ~dsp_workers();
+
+    void start(uint32_t _threads, const Nl::RealtimePolicy &_policy);   // worker n is pinned to _policy.cpus[n - 1] (if given)
+    void stop();
+    void run(job _job, void *_context, uint32_t _count);                // fork, run the share of the calling thread, join
+
+    uint32_t m_threads = 1;                                             // rendering threads, including the calling thread
+
+private:
+    static void workerLoop(dsp_workers *_pool, uint32_t _thread, uint32_t _generation, Nl::RealtimePolicy _policy);
+    void runShare(uint32_t _thread);
+
+    std::vector<std::thread> m_workers;
+    dsp_futex m_generation;                                             // incremented per fork, workers wait on it
+    dsp_futex m_pending;                                                // workers still busy with the current fork
+    std::atomic<bool> m_terminate{false};
+    job m_job = nullptr;
+    void *m_context = nullptr;
+    uint32_t m_count = 0;
+};
@@ -23,6 +23,7 @@
 Echo::Echo()
 {
     mFlushFade = 1.f;
+    initFlush();
 
     //******************************* Outputs ********************************//
     mEchoOut_L = 0.f;
@@ -48,16 +49,14 @@ Echo::Echo()
     mChannelStateVar_R = 0.f;
 
     mSampleBufferIndx = 0;
-    mSampleBuffer_L = {0.f};
-    mSampleBuffer_R = {0.f};
 
     //******************************* Filters ********************************//
-    pLowpass_L = new OnePoleFilters(4700.f, 0.f, OnePoleFilterType::LOWPASS);
-    pLowpass_R = new OnePoleFilters(4700.f, 0.f, OnePoleFilterType::LOWPASS);
-    pHighpass_L = new OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
-    pHighpass_R = new OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
-    pLowpass2Hz_L = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
-    pLowpass2Hz_R = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass_L = OnePoleFilters(4700.f, 0.f, OnePoleFilterType::LOWPASS);
+    mLowpass_R = OnePoleFilters(4700.f, 0.f, OnePoleFilterType::LOWPASS);
+    mHighpass_L = OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass_R = OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mLowpass2Hz_L = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass2Hz_R = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
 
     //***************************** Smoothing ********************************//
     mSmootherMask = 0x0000;
@@ -83,6 +82,7 @@ Echo::Echo(float _delayTime,
            float _mix)
 {
     mFlushFade = 1.f;
+    initFlush();
 
     //******************************* Outputs ********************************//
     mEchoOut_L = 0.f;
@@ -108,16 +108,14 @@ Echo::Echo(float _delayTime,
     mChannelStateVar_R = 0.f;
 
     mSampleBufferIndx = 0;
-    mSampleBuffer_L = {0.f};
-    mSampleBuffer_R = {0.f};
 
     //******************************* Filters ********************************//
-    pLowpass_L = new OnePoleFilters(_hiCut, 0.f, OnePoleFilterType::LOWPASS);
-    pLowpass_R = new OnePoleFilters(_hiCut, 0.f, OnePoleFilterType::LOWPASS);
-    pHighpass_L = new OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
-    pHighpass_R = new OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
-    pLowpass2Hz_L = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
-    pLowpass2Hz_R = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass_L = OnePoleFilters(_hiCut, 0.f, OnePoleFilterType::LOWPASS);
+    mLowpass_R = OnePoleFilters(_hiCut, 0.f, OnePoleFilterType::LOWPASS);
+    mHighpass_L = OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass_R = OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mLowpass2Hz_L = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass2Hz_R = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
 
     //***************************** Smoothing ********************************//
     mSmootherMask = 0x0000;
@@ -129,23 +127,6 @@ Echo::Echo(float _delayTime,
 
 
 
-/******************************************************************************/
-/** Echo Destructor
- * @brief
-*******************************************************************************/
-
-Echo::~Echo()
-{
-    delete pLowpass_L;
-    delete pLowpass_R;
-    delete pHighpass_L;
-    delete pHighpass_R;
-    delete pLowpass2Hz_L;
-    delete pLowpass2Hz_R;
-}
-
-
-
 /*****************************************************************************/
 /** @brief    interface method which converts and scales the incoming midi
  *            values and passes these to the respective methods
@@ -162,8 +143,8 @@ void Echo::setEchoParams(unsigned char _ctrlTag, float _ctrlVal)
 #ifdef PRINT_PARAMVALUES
             printf("Echo - HiCut: %f\n", _ctrlVal);
 #endif
-            pLowpass_L->setCutFreq(NlToolbox::Conversion::pitch2freq(_ctrlVal));
-            pLowpass_R->setCutFreq(NlToolbox::Conversion::pitch2freq(_ctrlVal));
+            mLowpass_L.setCutFreq(NlToolbox::Conversion::pitch2freq(_ctrlVal));
+            mLowpass_R.setCutFreq(NlToolbox::Conversion::pitch2freq(_ctrlVal));
             break;
 
         case CtrlID::MIX:
@@ -241,7 +222,13 @@ void Echo::setEchoParams(unsigned char _ctrlTag, float _ctrlVal)
 #ifdef PRINT_PARAMVALUES
                 printf("Echo - Flush Buffer\n");
 #endif
-                resetBuffer();
+                if (mFlushNow && mFlushCounter > FLUSH_INDEX)   // fading in after a flush: fade out again from the same level
+                {
+                    mFlushCounter = FADE_SAMPLES - 1 - mFlushCounter;
+                    mFlush.restart();
+                }
+
+                mFlushNow = true;
             }
             break;
     }
@@ -263,12 +250,33 @@ void Echo::applyEcho(float _rawSample_L, float _rawSample_R)
     }
 
 
+    //********************************** Echo Flush *************************************//
+    float flushFade = mFlushFade;
+
+    if (mFlushNow)
+    {
+        flushFade *= mFlushTable[mFlushCounter];
+
+        if (mFlushCounter != FLUSH_INDEX || mFlush.done())     // muted point: the fade holds, until both buffers are clear
+        {
+            mFlushCounter++;
+
+            if (mFlushCounter == FADE_SAMPLES)
+            {
+                mFlushCounter = 0;
+                mFlushNow = false;
+                mFlush.restart();
+            }
+        }
+    }
+
+
     //********************************** Left Channel ***********************************//
     float processedSample = _rawSample_L + (mChannelStateVar_L * mLocalFeedback) + (mChannelStateVar_R * mCrossFeedback);
 
-    float delayTime = pLowpass2Hz_L->applyFilter(mDelayTime_L);                  // 2Hz Lowpass for delay time smoothing
+    float delayTime = mLowpass2Hz_L.applyFilter(mDelayTime_L);                  // 2Hz Lowpass for delay time smoothing
 
-    processedSample *= mFlushFade;
+    processedSample *= flushFade;
     mSampleBuffer_L[mSampleBufferIndx] = processedSample;                    // delay - write sample to Buffer
 
     float delaySamples = delayTime * SAMPLERATE;
@@ -286,10 +294,10 @@ void Echo::applyEcho(float _rawSample_L, float _rawSample_R)
     ind_tp1 = mSampleBufferIndx - ind_tp1;
     ind_tp2 = mSampleBufferIndx - ind_tp2;
 
-    ind_tm1 &= ECHO_BUFFERSIZE_M1;                                               // Wrap with a mask sampleBuffer.size()-1
-    ind_t0  &= ECHO_BUFFERSIZE_M1;
-    ind_tp1 &= ECHO_BUFFERSIZE_M1;
-    ind_tp2 &= ECHO_BUFFERSIZE_M1;
+    ind_tm1 &= mSampleBuffer_L.mMask;                                            // Wrap with a mask sampleBuffer.size()-1
+    ind_t0  &= mSampleBuffer_L.mMask;
+    ind_tp1 &= mSampleBuffer_L.mMask;
+    ind_tp2 &= mSampleBuffer_L.mMask;
 
 
     processedSample = NlToolbox::Math::interpolRT(delaySamples_fract,           // Interpolation
@@ -298,10 +306,10 @@ void Echo::applyEcho(float _rawSample_L, float _rawSample_R)
                                                   mSampleBuffer_L[ind_tp1],
                                                   mSampleBuffer_L[ind_tp2]);
 
-    processedSample *= mFlushFade;
-    processedSample = pLowpass_L->applyFilter(processedSample);               // 1-pole lowpass
+    processedSample *= flushFade;
+    processedSample = mLowpass_L.applyFilter(processedSample);               // 1-pole lowpass
 
-    mChannelStateVar_L = pHighpass_L->applyFilter(processedSample) + DNC_CONST;                // 1-pole highpass
+    mChannelStateVar_L = mHighpass_L.applyFilter(processedSample) + DNC_CONST;                // 1-pole highpass
 
     mEchoOut_L = NlToolbox::Crossfades::crossFade(_rawSample_L, processedSample, mDry, mWet);      // Crossfade
 
@@ -309,9 +317,9 @@ void Echo::applyEcho(float _rawSample_L, float _rawSample_R)
     //********************************* Right Channel ***********************************//
     processedSample = _rawSample_R + (mChannelStateVar_R * mLocalFeedback) + (mChannelStateVar_L * mCrossFeedback);
 
-    delayTime = pLowpass2Hz_R->applyFilter(mDelayTime_R);                    // 2Hz Lowpass for delay time smoothing
+    delayTime = mLowpass2Hz_R.applyFilter(mDelayTime_R);                    // 2Hz Lowpass for delay time smoothing
 
-    processedSample *= mFlushFade;
+    processedSample *= flushFade;
     mSampleBuffer_R[mSampleBufferIndx] = processedSample;                       // delay - Write sample to Buffer
 
     delaySamples = delayTime * SAMPLERATE;
@@ -329,10 +337,10 @@ void Echo::applyEcho(float _rawSample_L, float _rawSample_R)
     ind_tp1 = mSampleBufferIndx - ind_tp1;
     ind_tp2 = mSampleBufferIndx - ind_tp2;
 
-    ind_tm1 &= ECHO_BUFFERSIZE_M1;                                                   // Wrap with a mask sampleBuffer.size()-1
-    ind_t0  &= ECHO_BUFFERSIZE_M1;
-    ind_tp1 &= ECHO_BUFFERSIZE_M1;
-    ind_tp2 &= ECHO_BUFFERSIZE_M1;
+    ind_tm1 &= mSampleBuffer_L.mMask;                                                // Wrap with a mask sampleBuffer.size()-1
+    ind_t0  &= mSampleBuffer_L.mMask;
+    ind_tp1 &= mSampleBuffer_L.mMask;
+    ind_tp2 &= mSampleBuffer_L.mMask;
 
     processedSample = NlToolbox::Math::interpolRT(delaySamples_fract,               // Interpolation
                                                   mSampleBuffer_R[ind_tm1],
@@ -340,14 +348,14 @@ void Echo::applyEcho(float _rawSample_L, float _rawSample_R)
                                                   mSampleBuffer_R[ind_tp1],
                                                   mSampleBuffer_R[ind_tp2]);
 
-    processedSample *= mFlushFade;
-    processedSample = pLowpass_R->applyFilter(processedSample);                  // 1 pole lowpass
+    processedSample *= flushFade;
+    processedSample = mLowpass_R.applyFilter(processedSample);                  // 1 pole lowpass
 
-    mChannelStateVar_R = pHighpass_R->applyFilter(processedSample) + DNC_CONST;              // 1-pole highpass
+    mChannelStateVar_R = mHighpass_R.applyFilter(processedSample) + DNC_CONST;              // 1-pole highpass
 
     mEchoOut_R = NlToolbox::Crossfades::crossFade(_rawSample_R, processedSample, mDry, mWet);    // Crossfade
 
-    mSampleBufferIndx = (mSampleBufferIndx + 1) & ECHO_BUFFERSIZE_M1;      // increase SampleBufferindx and check index boundaries
+    mSampleBufferIndx = (mSampleBufferIndx + 1) & mSampleBuffer_L.mMask;   // increase SampleBufferindx and check index boundaries
 }
 
 
@@ -435,8 +443,41 @@ inline void Echo::applyEchoSmoother()
 
 void Echo::resetBuffer()
 {
-    mSampleBuffer_L.fill(0.f);
-    mSampleBuffer_R.fill(0.f);
+    mSampleBuffer_L.clear();
+    mSampleBuffer_R.clear();
+}
+
+
+
+/*****************************************************************************/
+/** @brief    clears the next chunk of both buffers, while the echo flush holds
+ *            at its muted point (once per period, see VoiceManager::periodLoop())
+******************************************************************************/
+
+void Echo::stepFlush()
+{
+    if (mFlushNow && mFlushCounter == FLUSH_INDEX)
+    {
+        mFlush.step();
+    }
+}
+
+
+
+/*****************************************************************************/
+/** @brief    echo flush: idle, raised cosine fade table
+******************************************************************************/
+
+void Echo::initFlush()
+{
+    mFlushNow = false;
+    mFlushCounter = 0;
+
+    for (uint32_t ind = 0; ind < mFlushTable.size(); ind++)
+    {
+        float x = CONST_HALF_PI * SAMPLE_INTERVAL * ind / FADE_TIME;
+        mFlushTable[ind] = pow(cos(x), 2);
+    }
 }
 
 
@@ -480,3 +521,37 @@ void Echo::initFeedbackSmoother()
     mCFeedback_ramp = 0.f;
 }
 
+
+
+/*****************************************************************************/
+/** @brief    sample buffers sized for the longest delay at the sample rate
+ *            (both channels share the buffer index and its mask)
+******************************************************************************/
+
+void Echo::initDelayLines(EngineArena& _arena, DelayFlush& _flush)
+{
+    const uint32_t size = DelayLine::sizeFor(ECHO_MAX_DELAYTIME * SAMPLERATE);
+
+    mSampleBuffer_L.init(_arena, size);
+    mSampleBuffer_R.init(_arena, size);
+
+    _flush.add(&mSampleBuffer_L);
+    _flush.add(&mSampleBuffer_R);
+
+    mFlush.add(&mSampleBuffer_L);
+    mFlush.add(&mSampleBuffer_R);
+}
+
+
+
+size_t Echo::delayFootprint()
+{
+    return 2 * DelayLine::footprint(DelayLine::sizeFor(ECHO_MAX_DELAYTIME * SAMPLERATE));
+}
+
+
+
+size_t Echo::footprint() const
+{
+    return sizeof(Echo) + mSampleBuffer_L.footprint() + mSampleBuffer_R.footprint();
+}
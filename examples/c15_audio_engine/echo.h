@@ -12,11 +12,11 @@
 #include "nltoolbox.h"
 #include "nlglobaldefines.h"
 #include "onepolefilters.h"
+#include "delay_line.h"
 #include <array>
 
-//******************************* Buffer Arrays ******************************//
-#define ECHO_BUFFERSIZE 131072
-#define ECHO_BUFFERSIZE_M1 131071
+//******************************* Delay Lines *******************************//
+#define ECHO_MAX_DELAYTIME 2.f                   // longest channel delay in seconds (1.5 s delay time, stretched by the stereo amount)
 
 class Echo
 {
@@ -30,7 +30,7 @@ public:
          float _hiCut,
          float _mix);
 
-    ~Echo();                            // reClass Destructor
+    ~Echo(){}                           // reClass Destructor
 
     float mEchoOut_L;
     float mEchoOut_R;
@@ -38,8 +38,13 @@ public:
     void applyEcho(float _rawSample_L, float _rawSample_R);
     void setEchoParams(unsigned char _ctrlId, float _ctrlVal);
 
-    float mFlushFade;
+    float mFlushFade;                   // fade point of the global flush (set by the VoiceManager)
     void resetBuffer();
+    void stepFlush();                   // once per period: clears the next chunk of the echo flush
+
+    void initDelayLines(EngineArena& _arena, DelayFlush& _flush);     // takes the sample buffers from the arena, both flushes clear them
+    static size_t delayFootprint();                                 // arena memory initDelayLines() will take
+    size_t footprint() const;                                       // memory of the module including its sample buffers
 
 private:
     //*************************** Control Variabels **************************//
@@ -61,17 +66,15 @@ private:
     float mChannelStateVar_R;
 
     uint32_t mSampleBufferIndx;                     // sample buffer index
-    std::array<float, ECHO_BUFFERSIZE> mSampleBuffer_L;      // sample buffer for writing and reading the samples
-    std::array<float, ECHO_BUFFERSIZE> mSampleBuffer_R;
 
-    OnePoleFilters* pLowpass_L;                     // lowpass filter
-    OnePoleFilters* pLowpass_R;
+    OnePoleFilters mLowpass_L;                      // lowpass filter
+    OnePoleFilters mLowpass_R;
 
-    OnePoleFilters* pHighpass_L;                    // highpass filter at 50Hz
-    OnePoleFilters* pHighpass_R;
+    OnePoleFilters mHighpass_L;                     // highpass filter at 50Hz
+    OnePoleFilters mHighpass_R;
 
-    NlToolbox::Filters::Lowpass2Hz* pLowpass2Hz_L;  // 2Hz lowpass filter for smoothing the delay time
-    NlToolbox::Filters::Lowpass2Hz* pLowpass2Hz_R;
+    NlToolbox::Filters::Lowpass2Hz mLowpass2Hz_L;   // 2Hz lowpass filter for smoothing the delay time
+    NlToolbox::Filters::Lowpass2Hz mLowpass2Hz_R;
 
     //************************** Smoothing Variables *************************//
     // Smoother Mask    ID 1: Dry
@@ -130,7 +133,20 @@ private:
     };
 
 
+    //****************************** Echo Flush *****************************//
+    // the flush trigger fades the echo out, clears its buffers in chunks
+    // (one per period) while it is muted, then fades it in again
+    bool mFlushNow;
+    uint32_t mFlushCounter;                         // position in the raised cosine fade, holds at FLUSH_INDEX
+    std::array<float, FADE_SAMPLES> mFlushTable;
+    DelayFlush mFlush;
+
     //**************************** Helper Functions ***************************//
+    void initFlush();
     void initFeedbackSmoother();
     inline void calcChannelDelayTime();
+
+    //**************************** Sample Buffers ****************************//
+    DelayLine mSampleBuffer_L;      // sample buffer for writing and reading the samples
+    DelayLine mSampleBuffer_R;
 };
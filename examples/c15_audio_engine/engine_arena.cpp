@@ -0,0 +1,149 @@
+/******************************************************************************/
+/** @file           engine_arena.cpp
+    @version        1.0
+    @brief          engine arena: one aligned (and, if possible, huge page
+                    backed) block of memory, in which the modules of the
+                    VoiceManager are constructed next to each other
+    @todo
+*******************************************************************************/
+
+#include <sys/mman.h>
+#include "engine_arena.h"
+
+/******************************************************************************/
+/** @brief    an arena without memory (for owners, which know the capacity
+ *            only at init time)
+*******************************************************************************/
+
+EngineArena::EngineArena()
+{
+    pMemory = nullptr;
+    mMappedSize = 0;
+    mCapacity = 0;
+    mUsed = 0;
+    mNumEntries = 0;
+    mHugePages = false;
+}
+
+
+
+EngineArena::EngineArena(size_t _capacity)
+    : EngineArena()
+{
+    init(_capacity);
+}
+
+
+
+EngineArena::~EngineArena()
+{
+    release();
+}
+
+
+
+/******************************************************************************/
+/** @brief    maps the whole arena at once: explicit huge pages first, then
+ *            ordinary pages with the advice to use transparent huge pages
+ *            (mapped memory is page aligned and zeroed)
+*******************************************************************************/
+
+void EngineArena::init(size_t _capacity)
+{
+    release();
+
+    mCapacity = _capacity;
+    mMappedSize = (_capacity + ENGINE_ARENA_HUGE_PAGE_SIZE - 1) & ~static_cast<size_t>(ENGINE_ARENA_HUGE_PAGE_SIZE - 1);
+
+    void* memory = MAP_FAILED;
+
+#if ENGINE_ARENA_HUGE_PAGES == 1
+#ifdef MAP_HUGETLB
+    memory = mmap(nullptr, mMappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    mHugePages = memory != MAP_FAILED;
+#endif
+#endif
+
+    if (memory == MAP_FAILED)
+    {
+        memory = mmap(nullptr, mMappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (memory == MAP_FAILED)
+        {
+            mCapacity = 0;
+            mMappedSize = 0;
+            throw std::bad_alloc();
+        }
+
+#if ENGINE_ARENA_HUGE_PAGES == 1
+#ifdef MADV_HUGEPAGE
+        mHugePages = madvise(memory, mMappedSize, MADV_HUGEPAGE) == 0;
+#endif
+#endif
+    }
+
+    pMemory = static_cast<uint8_t*>(memory);
+}
+
+
+
+/******************************************************************************/
+/** @brief    destroys the objects in reverse order of their creation and
+ *            unmaps the memory
+*******************************************************************************/
+
+void EngineArena::release()
+{
+    for (uint32_t i = mNumEntries; i > 0; i--)
+    {
+        mEntries[i - 1].pDestroy(mEntries[i - 1].pObjects, mEntries[i - 1].mCount);
+    }
+
+    if (pMemory != nullptr)
+    {
+        munmap(pMemory, mMappedSize);
+    }
+
+    pMemory = nullptr;
+    mMappedSize = 0;
+    mCapacity = 0;
+    mUsed = 0;
+    mNumEntries = 0;
+    mHugePages = false;
+}
+
+
+
+/******************************************************************************/
+/** @brief    hands out the next _size bytes (_size is a multiple of the
+ *            alignment, see footprint())
+*******************************************************************************/
+
+void* EngineArena::allocate(size_t _size)
+{
+    if (mUsed + _size > mCapacity)
+    {
+        throw std::bad_alloc();
+    }
+
+    void* memory = pMemory + mUsed;
+    mUsed += _size;
+    return memory;
+}
+
+
+
+/******************************************************************************/
+/** @brief    remembers how to destroy the created objects
+*******************************************************************************/
+
+void EngineArena::registerObjects(void* _objects, size_t _count, void (*_destroy)(void*, size_t))
+{
+    if (mNumEntries == ENGINE_ARENA_MAX_OBJECTS)
+    {
+        _destroy(_objects, _count);
+        throw std::bad_alloc();
+    }
+
+    mEntries[mNumEntries++] = {_objects, _count, _destroy};
+}
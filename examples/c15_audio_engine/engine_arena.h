@@ -0,0 +1,101 @@
+/******************************************************************************/
+/** @file           engine_arena.h
+    @version        1.0
+    @brief          engine arena: one aligned (and, if possible, huge page
+                    backed) block of memory, in which the modules of the
+                    VoiceManager are constructed next to each other
+    @todo
+*******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <utility>
+
+#define ENGINE_ARENA_ALIGNMENT      64              // every object starts on its own cache line
+#define ENGINE_ARENA_HUGE_PAGES     1               // try to back the arena by huge pages: off (0), on (1)
+#define ENGINE_ARENA_HUGE_PAGE_SIZE 2097152         // the arena is rounded up to whole huge pages (2 MB)
+#define ENGINE_ARENA_MAX_OBJECTS    32              // number of create() / createArray() calls one arena can destroy
+
+class EngineArena
+{
+public:
+    EngineArena();                                  // no memory yet, see init()
+    EngineArena(size_t _capacity);                  // _capacity: sum of footprint() of all objects to be created
+    ~EngineArena();                                 // destroys the created objects (in reverse order) and frees the memory
+
+    void init(size_t _capacity);                    // (re)maps the arena, previously created objects are destroyed
+
+    EngineArena(const EngineArena&) = delete;
+    EngineArena& operator=(const EngineArena&) = delete;
+
+    /* memory an object (or _count objects) will take in the arena */
+    template<typename T>
+    static constexpr size_t footprint(size_t _count = 1)
+    {
+        return (sizeof(T) * _count + ENGINE_ARENA_ALIGNMENT - 1) & ~static_cast<size_t>(ENGINE_ARENA_ALIGNMENT - 1);
+    }
+
+    /* constructs one object behind the previously created one */
+    template<typename T, typename... Args>
+    T* create(Args&&... _args)
+    {
+        T* object = new (allocate(footprint<T>())) T(std::forward<Args>(_args)...);
+        registerObjects(object, 1, &destroyObjects<T>);
+        return object;
+    }
+
+    /* constructs _count default objects in a row (an array, without padding in between) */
+    template<typename T>
+    T* createArray(size_t _count)
+    {
+        T* objects = static_cast<T*>(allocate(footprint<T>(_count)));
+        for (size_t i = 0; i < _count; i++)
+        {
+            new (&objects[i]) T();
+        }
+        registerObjects(objects, _count, &destroyObjects<T>);
+        return objects;
+    }
+
+    /* _count floats for sample buffers (zeroed, nothing to destroy) */
+    float* createBuffer(size_t _count)
+    {
+        return static_cast<float*>(allocate(footprint<float>(_count)));
+    }
+
+    size_t mappedSize() const { return mMappedSize; }  // memory the arena really takes (rounded up to whole huge pages)
+
+    bool mHugePages;                                // is the arena backed by huge pages (MAP_HUGETLB or transparent)?
+
+private:
+    void release();
+    void* allocate(size_t _size);
+    void registerObjects(void* _objects, size_t _count, void (*_destroy)(void*, size_t));
+
+    template<typename T>
+    static void destroyObjects(void* _objects, size_t _count)
+    {
+        for (size_t i = _count; i > 0; i--)
+        {
+            static_cast<T*>(_objects)[i - 1].~T();
+        }
+    }
+
+    uint8_t* pMemory;
+    size_t mMappedSize;                             // the size handed to mmap()
+    size_t mCapacity;
+    size_t mUsed;
+
+    struct ArenaEntry
+    {
+        void* pObjects;
+        size_t mCount;
+        void (*pDestroy)(void*, size_t);
+    };
+
+    ArenaEntry mEntries[ENGINE_ARENA_MAX_OBJECTS];
+    uint32_t mNumEntries;
+};
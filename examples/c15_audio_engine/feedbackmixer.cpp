@@ -45,7 +45,7 @@ FeedbackMixer::FeedbackMixer()
     mShaperStateVar = 0.f;
 
     //******************************** Filter ********************************//
-    pHighpass = new OnePoleFilters(20.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass = OnePoleFilters(20.f, 0.f, OnePoleFilterType::HIGHPASS);
 
     //****************************** Smoothing *******************************//
     mSmootherMask = 0x0000;
@@ -99,7 +99,7 @@ FeedbackMixer::FeedbackMixer(float _CombLevel,
     mShaperStateVar = 0.f;
 
     //******************************** Filter ********************************//
-    pHighpass = new OnePoleFilters(20.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass = OnePoleFilters(20.f, 0.f, OnePoleFilterType::HIGHPASS);
 
     //****************************** Smoothing *******************************//
     mSmootherMask = 0x0000;
@@ -116,17 +116,6 @@ FeedbackMixer::FeedbackMixer(float _CombLevel,
 
 
 
-/******************************************************************************/
-/** Feedback Mixer Destructor
- * @brief
-*******************************************************************************/
-
-FeedbackMixer::~FeedbackMixer()
-{
-    delete pHighpass;
-}
-
-
 /******************************************************************************/
 /** @brief  main function which calculates the Feedback Sample from the incoming
  *          CombFilter, SV Filter and Effects Samples, depending on the set
@@ -148,7 +137,7 @@ void FeedbackMixer::applyFeedbackMixer(float _CombSample, float _SVFilterSample,
 
 
     //******************************* Filter *********************************//
-    mainSample = pHighpass->applyFilter(mainSample);
+    mainSample = mHighpass.applyFilter(mainSample);
 
 
     //******************************* Shaper *********************************//
@@ -181,7 +170,7 @@ void FeedbackMixer::setPitchInfluence(float _keyPitch)
 
     mMainLevel = mLevel_current * mPitchInfluence;
 
-    pHighpass->setCutFreq(NlToolbox::Conversion::pitch2freq(_keyPitch + 12.f));
+    mHighpass.setCutFreq(NlToolbox::Conversion::pitch2freq(_keyPitch + 12.f));
 }
 
 
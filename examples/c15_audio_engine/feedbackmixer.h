@@ -31,7 +31,7 @@ public:
                   float _mainLevel,
                   float _keyTracking);
 
-    ~FeedbackMixer();                       // Destructor
+    ~FeedbackMixer(){}                      // Destructor
 
     float mFeedbackOut;                     // Resulting Sample
     float mReverbLevel;                     // Parameter for the Reverb
@@ -60,7 +60,7 @@ private:
 
 
     //************************** Filter **************************************//
-    OnePoleFilters* pHighpass;
+    OnePoleFilters mHighpass;
 
     //************************** Smoothing Variables *************************//
     // Smoother Mask    ID 1: Comb Level
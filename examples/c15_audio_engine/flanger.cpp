@@ -71,17 +71,15 @@ Flanger::Flanger()
     mChannelStateVar_L = 0.f;
     mChannelStateVar_R = 0.f;
 
-    mSampleBuffer_L = {0.f};
-    mSampleBuffer_R = {0.f};
 
     //****************************** Filters *******************************//
-    pLowpass_L = new OnePoleFilters(NlToolbox::Conversion::pitch2freq(120.f), 0.f, OnePoleFilterType::LOWPASS);
-    pLowpass_R = new OnePoleFilters(NlToolbox::Conversion::pitch2freq(120.f), 0.f, OnePoleFilterType::LOWPASS);
-    pHighpass_L = new OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
-    pHighpass_R = new OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
-    pLowpass2Hz_L = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
-    pLowpass2Hz_R = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
-    pLowpass2Hz_Depth = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass_L = OnePoleFilters(NlToolbox::Conversion::pitch2freq(120.f), 0.f, OnePoleFilterType::LOWPASS);
+    mLowpass_R = OnePoleFilters(NlToolbox::Conversion::pitch2freq(120.f), 0.f, OnePoleFilterType::LOWPASS);
+    mHighpass_L = OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass_R = OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mLowpass2Hz_L = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass2Hz_R = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass2Hz_Depth = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
 
     mAllpass_L.setCoeffs(NlToolbox::Conversion::pitch2freq(140.f));
     mAllpass_R.setCoeffs(NlToolbox::Conversion::pitch2freq(140.f));
@@ -181,17 +179,15 @@ Flanger::Flanger(float _rate,
     mChannelStateVar_L = 0.f;
     mChannelStateVar_R = 0.f;
 
-    mSampleBuffer_L = {0.f};
-    mSampleBuffer_R = {0.f};
 
     //****************************** Filters *******************************//
-    pLowpass_L = new OnePoleFilters(NlToolbox::Conversion::pitch2freq(_hiCut), 0.f, OnePoleFilterType::LOWPASS);
-    pLowpass_R = new OnePoleFilters(NlToolbox::Conversion::pitch2freq(_hiCut), 0.f, OnePoleFilterType::LOWPASS);
-    pHighpass_L = new OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
-    pHighpass_R = new OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
-    pLowpass2Hz_L = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
-    pLowpass2Hz_R = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
-    pLowpass2Hz_Depth = new NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass_L = OnePoleFilters(NlToolbox::Conversion::pitch2freq(_hiCut), 0.f, OnePoleFilterType::LOWPASS);
+    mLowpass_R = OnePoleFilters(NlToolbox::Conversion::pitch2freq(_hiCut), 0.f, OnePoleFilterType::LOWPASS);
+    mHighpass_L = OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass_R = OnePoleFilters(50.f, 0.f, OnePoleFilterType::HIGHPASS);
+    mLowpass2Hz_L = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass2Hz_R = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
+    mLowpass2Hz_Depth = NlToolbox::Filters::Lowpass2Hz(SAMPLERATE);
 
     mAllpass_L.setCoeffs(NlToolbox::Conversion::pitch2freq(_apTune));
     mAllpass_R.setCoeffs(NlToolbox::Conversion::pitch2freq(_apTune));
@@ -208,24 +204,6 @@ Flanger::Flanger(float _rate,
 
 
 
-/******************************************************************************/
-/** Flanger Destructor
- * @brief
-*******************************************************************************/
-
-Flanger::~Flanger()
-{
-    delete pLowpass_L;
-    delete pLowpass_R;
-    delete pHighpass_L;
-    delete pHighpass_R;
-    delete pLowpass2Hz_L;
-    delete pLowpass2Hz_R;
-    delete pLowpass2Hz_Depth;
-}
-
-
-
 /*****************************************************************************/
 /** @brief    processes the incoming samples of both channels
  *  @param    raw left Sample, raw right Sample
@@ -266,13 +244,13 @@ void Flanger::applyFlanger(float _rawSample_L, float _rawSample_R)
 
 
     //**************************** Left Channel *****************************//
-    float depth = pLowpass2Hz_Depth->applyFilter(mLFDepth);              // Depth for both channels
+    float depth = mLowpass2Hz_Depth.applyFilter(mLFDepth);              // Depth for both channels
 
     float processedSample = _rawSample_L + (mChannelStateVar_L * mLocalFeedback) + (mChannelStateVar_R * mCrossFeedback);
     processedSample *= mFlushFade;
-    processedSample = pLowpass_L->applyFilter(processedSample);
+    processedSample = mLowpass_L.applyFilter(processedSample);
 
-    float delayTime = pLowpass2Hz_L->applyFilter(mFlangerTime_L);
+    float delayTime = mLowpass2Hz_L.applyFilter(mFlangerTime_L);
     delayTime = delayTime + delayTime * depth * lfoOut_L;
 
     mSampleBuffer_L[mSampleBufferIndx] = processedSample;
@@ -292,10 +270,10 @@ void Flanger::applyFlanger(float _rawSample_L, float _rawSample_R)
     ind_tp1 = mSampleBufferIndx - ind_tp1;
     ind_tp2 = mSampleBufferIndx - ind_tp2;
 
-    ind_tm1 &= FLANGER_BUFFERSIZE_M1;                                               // Wrap with a mask sampleBuffer.size()-1
-    ind_t0  &= FLANGER_BUFFERSIZE_M1;
-    ind_tp1 &= FLANGER_BUFFERSIZE_M1;
-    ind_tp2 &= FLANGER_BUFFERSIZE_M1;
+    ind_tm1 &= mSampleBuffer_L.mMask;                                            // Wrap with a mask sampleBuffer.size()-1
+    ind_t0  &= mSampleBuffer_L.mMask;
+    ind_tp1 &= mSampleBuffer_L.mMask;
+    ind_tp2 &= mSampleBuffer_L.mMask;
 
     processedSample = NlToolbox::Math::interpolRT(delaySamples_fract,           // Interpolation
                                                   mSampleBuffer_L[ind_tm1],
@@ -306,7 +284,7 @@ void Flanger::applyFlanger(float _rawSample_L, float _rawSample_R)
     processedSample *= mFlushFade;
     processedSample = mAllpass_L.applyAllpass(processedSample);
 
-    mChannelStateVar_L = pHighpass_L->applyFilter(processedSample) + DNC_CONST;
+    mChannelStateVar_L = mHighpass_L.applyFilter(processedSample) + DNC_CONST;
 
     mFlangerOut_L = NlToolbox::Crossfades::crossFade(_rawSample_L, processedSample, mMixDry, mMixWet);
 
@@ -315,9 +293,9 @@ void Flanger::applyFlanger(float _rawSample_L, float _rawSample_R)
     processedSample = _rawSample_R + (mChannelStateVar_R * mLocalFeedback) + (mChannelStateVar_L * mCrossFeedback);
     processedSample *= mFlushFade;
 
-    processedSample = pLowpass_R->applyFilter(processedSample);
+    processedSample = mLowpass_R.applyFilter(processedSample);
 
-    delayTime = pLowpass2Hz_R->applyFilter(mFlangerTime_R);
+    delayTime = mLowpass2Hz_R.applyFilter(mFlangerTime_R);
     delayTime = delayTime + delayTime * depth * lfoOut_R;
 
     mSampleBuffer_R[mSampleBufferIndx] = processedSample;
@@ -337,10 +315,10 @@ void Flanger::applyFlanger(float _rawSample_L, float _rawSample_R)
     ind_tp1 = mSampleBufferIndx - ind_tp1;
     ind_tp2 = mSampleBufferIndx - ind_tp2;
 
-    ind_tm1 &= FLANGER_BUFFERSIZE_M1;                                               // Wrap with a mask sampleBuffer.size()-1
-    ind_t0  &= FLANGER_BUFFERSIZE_M1;
-    ind_tp1 &= FLANGER_BUFFERSIZE_M1;
-    ind_tp2 &= FLANGER_BUFFERSIZE_M1;
+    ind_tm1 &= mSampleBuffer_L.mMask;                                            // Wrap with a mask sampleBuffer.size()-1
+    ind_t0  &= mSampleBuffer_L.mMask;
+    ind_tp1 &= mSampleBuffer_L.mMask;
+    ind_tp2 &= mSampleBuffer_L.mMask;
 
     processedSample = NlToolbox::Math::interpolRT(delaySamples_fract,           // Interpolation
                                                   mSampleBuffer_R[ind_tm1],
@@ -351,11 +329,11 @@ void Flanger::applyFlanger(float _rawSample_L, float _rawSample_R)
     processedSample *= mFlushFade;
     processedSample = mAllpass_R.applyAllpass(processedSample);
 
-    mChannelStateVar_R = pHighpass_R->applyFilter(processedSample) + DNC_CONST;
+    mChannelStateVar_R = mHighpass_R.applyFilter(processedSample) + DNC_CONST;
 
     mFlangerOut_R = NlToolbox::Crossfades::crossFade(_rawSample_R, processedSample, mMixDry, mMixWet);
 
-    mSampleBufferIndx = (mSampleBufferIndx + 1) & FLANGER_BUFFERSIZE_M1;      // increase SampleBufferindx and check index boundaries
+    mSampleBufferIndx = (mSampleBufferIndx + 1) & mSampleBuffer_L.mMask;   // increase SampleBufferindx and check index boundaries
 }
 
 
@@ -490,8 +468,8 @@ void Flanger::setFlangerParams(unsigned char _ctrlID, float _ctrlVal)
 #ifdef PRINT_PARAMVALUES
             printf("Flanger - HI Cut: %f\n", _ctrlVal);
 #endif
-            pLowpass_L->setCutFreq(NlToolbox::Conversion::pitch2freq(_ctrlVal));
-            pLowpass_R->setCutFreq(NlToolbox::Conversion::pitch2freq(_ctrlVal));
+            mLowpass_L.setCutFreq(NlToolbox::Conversion::pitch2freq(_ctrlVal));
+            mLowpass_R.setCutFreq(NlToolbox::Conversion::pitch2freq(_ctrlVal));
             break;
 
         case CtrlID::FEEDBACK:
@@ -699,6 +677,38 @@ void Flanger::triggerLFO(float _velocity)
 
 void Flanger::resetBuffer()
 {
-    mSampleBuffer_L.fill(0.f);
-    mSampleBuffer_R.fill(0.f);
+    mSampleBuffer_L.clear();
+    mSampleBuffer_R.clear();
+}
+
+
+
+/*****************************************************************************/
+/** @brief    sample buffers sized for the longest delay at the sample rate
+ *            (both channels share the buffer index and its mask)
+******************************************************************************/
+
+void Flanger::initDelayLines(EngineArena& _arena, DelayFlush& _flush)
+{
+    const uint32_t size = DelayLine::sizeFor(FLANGER_MAX_DELAYTIME * SAMPLERATE);
+
+    mSampleBuffer_L.init(_arena, size);
+    mSampleBuffer_R.init(_arena, size);
+
+    _flush.add(&mSampleBuffer_L);
+    _flush.add(&mSampleBuffer_R);
+}
+
+
+
+size_t Flanger::delayFootprint()
+{
+    return 2 * DelayLine::footprint(DelayLine::sizeFor(FLANGER_MAX_DELAYTIME * SAMPLERATE));
+}
+
+
+
+size_t Flanger::footprint() const
+{
+    return sizeof(Flanger) + mSampleBuffer_L.footprint() + mSampleBuffer_R.footprint();
 }
@@ -14,11 +14,10 @@
 #include "nltoolbox.h"
 #include "nlglobaldefines.h"
 #include "onepolefilters.h"
-#include <array>
+#include "delay_line.h"
 
-//******************************* Buffer Arrays ******************************//
-#define FLANGER_BUFFERSIZE 8192
-#define FLANGER_BUFFERSIZE_M1 8191
+//******************************* Delay Lines *******************************//
+#define FLANGER_MAX_DELAYTIME 0.15f             // longest channel delay in seconds (50 ms time, stretched by stereo and modulation)
 
 class Flanger
 {
@@ -39,7 +38,7 @@ public:
             float _crossFeedback,
             float _mix);
 
-    ~Flanger();                     // Destructor
+    ~Flanger(){}                    // Destructor
 
     float mFlangerOut_L, mFlangerOut_R;
 
@@ -50,6 +49,10 @@ public:
     float mFlushFade;
     void resetBuffer();
 
+    void initDelayLines(EngineArena& _arena, DelayFlush& _flush);     // takes the sample buffers from the arena, the flush clears them
+    static size_t delayFootprint();                                 // arena memory initDelayLines() will take
+    size_t footprint() const;                                       // memory of the module including its sample buffers
+
 private:
     //*************************** Control Variables **************************//
     float mMixWet;
@@ -84,19 +87,17 @@ private:
     float mChannelStateVar_R;
 
     uint32_t mSampleBufferIndx;
-    std::array<float, FLANGER_BUFFERSIZE> mSampleBuffer_L;
-    std::array<float, FLANGER_BUFFERSIZE> mSampleBuffer_R;
 
-    OnePoleFilters* pLowpass_L;
-    OnePoleFilters* pLowpass_R;
+    OnePoleFilters mLowpass_L;
+    OnePoleFilters mLowpass_R;
 
-    OnePoleFilters* pHighpass_L;
-    OnePoleFilters* pHighpass_R;
+    OnePoleFilters mHighpass_L;
+    OnePoleFilters mHighpass_R;
 
-    NlToolbox::Filters::Lowpass2Hz* pLowpass2Hz_L;
-    NlToolbox::Filters::Lowpass2Hz* pLowpass2Hz_R;
+    NlToolbox::Filters::Lowpass2Hz mLowpass2Hz_L;
+    NlToolbox::Filters::Lowpass2Hz mLowpass2Hz_R;
 
-    NlToolbox::Filters::Lowpass2Hz* pLowpass2Hz_Depth;
+    NlToolbox::Filters::Lowpass2Hz mLowpass2Hz_Depth;
 
     //**************************** Allpass 4 Pole ****************************//
     struct Allpass
@@ -250,4 +251,8 @@ private:
         MIX                 =
 #endif
     };
+
+    //**************************** Sample Buffers ****************************//
+    DelayLine mSampleBuffer_L;
+    DelayLine mSampleBuffer_R;
 };
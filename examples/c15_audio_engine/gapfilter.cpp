@@ -46,15 +46,15 @@ GapFilter::GapFilter()
     calcFilterMix();
 
     //******************************* Filters ********************************//
-    pHighpass_L1 = new BiquadFilters(740.f, 0.f, 0.45f, BiquadFilterType::HIGHPASS);
-    pHighpass_L2 = new BiquadFilters(740.f * 0.75f, 0.f, 0.45f, BiquadFilterType::HIGHPASS);
-    pHighpass_R1 = new BiquadFilters(740.f, 0.f, 0.45f, BiquadFilterType::HIGHPASS);
-    pHighpass_R2 = new BiquadFilters(740.f * 0.75f, 0.f, 0.45f, BiquadFilterType::HIGHPASS);
+    mHighpass_L1 = BiquadFilters(740.f, 0.f, 0.45f, BiquadFilterType::HIGHPASS);
+    mHighpass_L2 = BiquadFilters(740.f * 0.75f, 0.f, 0.45f, BiquadFilterType::HIGHPASS);
+    mHighpass_R1 = BiquadFilters(740.f, 0.f, 0.45f, BiquadFilterType::HIGHPASS);
+    mHighpass_R2 = BiquadFilters(740.f * 0.75f, 0.f, 0.45f, BiquadFilterType::HIGHPASS);
 
-    pLowpass_L1 = new BiquadFilters(370.f, 0.f, 0.45f, BiquadFilterType::LOWPASS);
-    pLowpass_L2 = new BiquadFilters(370.f * 1.33f, 0.f, 0.45f, BiquadFilterType::LOWPASS);
-    pLowpass_R1 = new BiquadFilters(370.f, 0.f, 0.45f, BiquadFilterType::LOWPASS);
-    pLowpass_R2 = new BiquadFilters(370.f * 1.33f, 0.f, 0.45f, BiquadFilterType::LOWPASS);
+    mLowpass_L1 = BiquadFilters(370.f, 0.f, 0.45f, BiquadFilterType::LOWPASS);
+    mLowpass_L2 = BiquadFilters(370.f * 1.33f, 0.f, 0.45f, BiquadFilterType::LOWPASS);
+    mLowpass_R1 = BiquadFilters(370.f, 0.f, 0.45f, BiquadFilterType::LOWPASS);
+    mLowpass_R2 = BiquadFilters(370.f * 1.33f, 0.f, 0.45f, BiquadFilterType::LOWPASS);
 
     //***************************** Smoothing ********************************//
     while (mSmootherMask)
@@ -107,15 +107,15 @@ GapFilter::GapFilter(float _center,
     calcFilterMix();
 
     //******************************* Filters ********************************//
-    pHighpass_L1 = new BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::HIGHPASS);
-    pHighpass_L2 = new BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::HIGHPASS);
-    pHighpass_R1 = new BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::HIGHPASS);
-    pHighpass_R2 = new BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::HIGHPASS);
+    mHighpass_L1 = BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::HIGHPASS);
+    mHighpass_L2 = BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::HIGHPASS);
+    mHighpass_R1 = BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::HIGHPASS);
+    mHighpass_R2 = BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::HIGHPASS);
 
-    pLowpass_L1 = new BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::LOWPASS);
-    pLowpass_L2 = new BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::LOWPASS);
-    pLowpass_R1 = new BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::LOWPASS);
-    pLowpass_R2 = new BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::LOWPASS);
+    mLowpass_L1 = BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::LOWPASS);
+    mLowpass_L2 = BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::LOWPASS);
+    mLowpass_R1 = BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::LOWPASS);
+    mLowpass_R2 = BiquadFilters(0.f, 0.f, 0.f, BiquadFilterType::LOWPASS);
 
     //***************************** Smoothing ********************************//
     while (mSmootherMask)
@@ -131,25 +131,6 @@ GapFilter::GapFilter(float _center,
 
 
 
-/******************************************************************************/
-/** Gap Filter Destructor
- * @brief
-*******************************************************************************/
-
-GapFilter::~GapFilter()
-{
-    delete pHighpass_L1;
-    delete pHighpass_L2;
-    delete pHighpass_R1;
-    delete pHighpass_R2;
-    delete pLowpass_L1;
-    delete pLowpass_L2;
-    delete pLowpass_R1;
-    delete pLowpass_R2;
-}
-
-
-
 /*****************************************************************************/
 /** @brief    processes the incoming samples of both channels
  *  @param    raw left Sample, raw right Sample
@@ -165,27 +146,27 @@ void GapFilter::applyGapFilter(float _rawSample_L, float _rawSample_R)
 
 
     //*************************** Left Highpass *****************************//
-    float highpassSample = pHighpass_L1->applyFilter(_rawSample_L);
-    highpassSample = pHighpass_L2->applyFilter(highpassSample);
+    float highpassSample = mHighpass_L1.applyFilter(_rawSample_L);
+    highpassSample = mHighpass_L2.applyFilter(highpassSample);
     highpassSample *= mHpOutMix;
 
     //**************************** Left Lowpass *****************************//
-    float lowpassSample = pLowpass_L1->applyFilter(highpassSample * mHpLpMix + _rawSample_L * mInLpMix);
-    lowpassSample = pLowpass_L2->applyFilter(lowpassSample);
+    float lowpassSample = mLowpass_L1.applyFilter(highpassSample * mHpLpMix + _rawSample_L * mInLpMix);
+    lowpassSample = mLowpass_L2.applyFilter(lowpassSample);
     lowpassSample *= mLpOutMix;
 
     mGapFilterOut_L = highpassSample + lowpassSample + (_rawSample_L * mInOutMix);
 
 
     //*************************** Right Highpass ****************************//
-    highpassSample = pHighpass_R1->applyFilter(_rawSample_R);
-    highpassSample = pHighpass_R2->applyFilter(highpassSample);
+    highpassSample = mHighpass_R1.applyFilter(_rawSample_R);
+    highpassSample = mHighpass_R2.applyFilter(highpassSample);
 
     highpassSample *= mHpOutMix;
 
     //**************************** Right Lowpass ****************************//
-    lowpassSample = pLowpass_R1->applyFilter(highpassSample * mHpLpMix + _rawSample_R * mInLpMix);
-    lowpassSample = pLowpass_R2->applyFilter(lowpassSample);
+    lowpassSample = mLowpass_R1.applyFilter(highpassSample * mHpLpMix + _rawSample_R * mInLpMix);
+    lowpassSample = mLowpass_R2.applyFilter(lowpassSample);
 
     lowpassSample *= mLpOutMix;
 
@@ -450,8 +431,8 @@ void GapFilter::applySmoother()
             mLowpassFreq_R = mLowpassFreq_R_base + mLowpassFreq_R_diff * mFilterFreq_ramp;
         }
 
-        pHighpass_L1->setCutFreq(mHighpassFreq_L);
-        pHighpass_L2->setCutFreq(mHighpassFreq_L * 0.75f);
+        mHighpass_L1.setCutFreq(mHighpassFreq_L);
+        mHighpass_L2.setCutFreq(mHighpassFreq_L * 0.75f);
 
         mScaledFreqHP_L = (1.f / (FREQCLIP_MAX_2 - FREQCLIP_MAX_5)) * (mHighpassFreq_L - FREQCLIP_MAX_5);
 
@@ -465,12 +446,12 @@ void GapFilter::applySmoother()
         }
 
         float resonance = mResonance * mScaledFreqHP_L;
-        pHighpass_L1->setResonance(resonance);
-        pHighpass_L2->setResonance(resonance);
+        mHighpass_L1.setResonance(resonance);
+        mHighpass_L2.setResonance(resonance);
 
 
-        pHighpass_R1->setCutFreq(mHighpassFreq_R);
-        pHighpass_R2->setCutFreq(mHighpassFreq_R * 0.75f);
+        mHighpass_R1.setCutFreq(mHighpassFreq_R);
+        mHighpass_R2.setCutFreq(mHighpassFreq_R * 0.75f);
 
         mScaledFreqHP_R = (1.f / (FREQCLIP_MAX_2 - FREQCLIP_MAX_5)) * (mHighpassFreq_R - FREQCLIP_MAX_5);
 
@@ -484,12 +465,12 @@ void GapFilter::applySmoother()
         }
 
         resonance = mResonance * mScaledFreqHP_R;
-        pHighpass_R1->setResonance(resonance);
-        pHighpass_R2->setResonance(resonance);
+        mHighpass_R1.setResonance(resonance);
+        mHighpass_R2.setResonance(resonance);
 
 
-        pLowpass_L1->setCutFreq(mLowpassFreq_L);
-        pLowpass_L2->setCutFreq(mLowpassFreq_L * 1.33f);
+        mLowpass_L1.setCutFreq(mLowpassFreq_L);
+        mLowpass_L2.setCutFreq(mLowpassFreq_L * 1.33f);
 
         mScaledFreqLP_L = (1.f / (FREQCLIP_MAX_2 - FREQCLIP_MAX_5)) * (mLowpassFreq_L - FREQCLIP_MAX_5);
 
@@ -503,12 +484,12 @@ void GapFilter::applySmoother()
         }
 
         resonance = mResonance * mScaledFreqLP_L;
-        pLowpass_L1->setResonance(resonance);
-        pLowpass_L2->setResonance(resonance);
+        mLowpass_L1.setResonance(resonance);
+        mLowpass_L2.setResonance(resonance);
 
 
-        pLowpass_R1->setCutFreq(mLowpassFreq_R);
-        pLowpass_R2->setCutFreq(mLowpassFreq_R * 1.33f);
+        mLowpass_R1.setCutFreq(mLowpassFreq_R);
+        mLowpass_R2.setCutFreq(mLowpassFreq_R * 1.33f);
 
         mScaledFreqLP_R = (1.f / (FREQCLIP_MAX_2 - FREQCLIP_MAX_5)) * (mLowpassFreq_R - FREQCLIP_MAX_5);
 
@@ -522,8 +503,8 @@ void GapFilter::applySmoother()
         }
 
         resonance = mResonance * mScaledFreqLP_R;
-        pLowpass_R1->setResonance(resonance);
-        pLowpass_R2->setResonance(resonance);
+        mLowpass_R1.setResonance(resonance);
+        mLowpass_R2.setResonance(resonance);
 
     }
 
@@ -545,20 +526,20 @@ void GapFilter::applySmoother()
         }
 
         float resonance = mResonance * mScaledFreqHP_L;
-        pHighpass_L1->setResonance(resonance);
-        pHighpass_L2->setResonance(resonance);
+        mHighpass_L1.setResonance(resonance);
+        mHighpass_L2.setResonance(resonance);
 
         resonance = mResonance * mScaledFreqHP_R;
-        pHighpass_R1->setResonance(resonance);
-        pHighpass_R2->setResonance(resonance);
+        mHighpass_R1.setResonance(resonance);
+        mHighpass_R2.setResonance(resonance);
 
         resonance = mResonance * mScaledFreqLP_L;
-        pLowpass_L1->setResonance(resonance);
-        pLowpass_L2->setResonance(resonance);
+        mLowpass_L1.setResonance(resonance);
+        mLowpass_L2.setResonance(resonance);
 
         resonance = mResonance * mScaledFreqLP_R;
-        pLowpass_R1->setResonance(resonance);
-        pLowpass_R2->setResonance(resonance);
+        mLowpass_R1.setResonance(resonance);
+        mLowpass_R2.setResonance(resonance);
     }
 
     //**************************** ID 3: Filter Mix **********************************//
@@ -26,7 +26,7 @@ public:
               float _stereo,
               float _resonance);
 
-    ~GapFilter();                   // Destructor
+    ~GapFilter(){}                  // Destructor
 
     float mGapFilterOut_L, mGapFilterOut_R;     // public processed samples
 
@@ -60,15 +60,15 @@ private:
     float mLpOutMix;
     float mInOutMix;
 
-    BiquadFilters* pHighpass_L1;
-    BiquadFilters* pHighpass_L2;
-    BiquadFilters* pHighpass_R1;
-    BiquadFilters* pHighpass_R2;
+    BiquadFilters mHighpass_L1;
+    BiquadFilters mHighpass_L2;
+    BiquadFilters mHighpass_R1;
+    BiquadFilters mHighpass_R2;
 
-    BiquadFilters* pLowpass_L1;
-    BiquadFilters* pLowpass_L2;
-    BiquadFilters* pLowpass_R1;
-    BiquadFilters* pLowpass_R2;
+    BiquadFilters mLowpass_L1;
+    BiquadFilters mLowpass_L2;
+    BiquadFilters mLowpass_R1;
+    BiquadFilters mLowpass_R2;
 
 
     //************************** Smoothing Variables *************************//
@@ -13,18 +13,18 @@ namespace MINISYNTH {
 
 //--------------- Objects
 VoiceManager voiceManager;
+StopWatch::ScopeId m_stopWatchScope = 0;    // interned in miniSynthMidiControl()
 
 
 /** @brief    Callback function for Sine Generator and Audio Input - testing with ReMote 61
-        @param    Input Buffer
-        @param    Output Buffer
+        @param    Output Buffer, one float array per channel
+        @param    frames per channel
 
-        @param    buffer size
         @param    Sample Specs
     */
-void miniSynthCallback(uint8_t *out, const SampleSpecs &sampleSpecs __attribute__ ((unused)), SharedUserPtr ptr)
+void miniSynthCallback(float* const* out, unsigned int frames, const SampleSpecs &sampleSpecs, SharedUserPtr ptr)
 {
-    StopBlockTime(sw, "miniSynth");
+    StopBlockTime sbt(sw, m_stopWatchScope);
     auto midiBuffer = getBufferForName("MidiBuffer");
 
     //---------------- Retrieve Midi Information if midi values have changed
@@ -48,32 +48,26 @@ void miniSynthCallback(uint8_t *out, const SampleSpecs &sampleSpecs __attribute_
         }
     }
 
-    for (unsigned int frameIndex = 0; frameIndex < sampleSpecs.buffersizeInFramesPerPeriode; ++frameIndex)
+    // The working thread converts to the buffer format, we only deliver float samples
+    for (unsigned int frameIndex = 0; frameIndex < frames; ++frameIndex)
     {
         voiceManager.voiceLoop();                           // voice manager main loop
 
-        float outputSample;
+        const float outputSample_L = voiceManager.mainOut_L;
+        const float outputSample_R = voiceManager.mainOut_R;
+
+        if (outputSample_L > 1.f || outputSample_L < -1.f || outputSample_R > 1.f || outputSample_R < -1.f)     // Clipping
+        {
+            printf("WARNING!!! C15 CLIPPING!!!\n");
+        }
 
         for (unsigned int channelIndex = 0; channelIndex < sampleSpecs.channels; ++channelIndex)
         {
-            if (channelIndex)
-            {
-                outputSample = voiceManager.mainOut_R;
-            }
-            else if (!channelIndex)
-            {
-                outputSample = voiceManager.mainOut_L;
-            }
-
-
-            if (outputSample > 1.f || outputSample < -1.f)                  // Clipping
-            {
-                printf("WARNING!!! C15 CLIPPING!!!\n");
-            }
-
-            setSample(out, outputSample, frameIndex, channelIndex, sampleSpecs);
+            out[channelIndex][frameIndex] = channelIndex ? outputSample_R : outputSample_L;
         }
     }
+
+    voiceManager.periodLoop();                              // paced work: one chunk of a delay line flush
 }
 
 
@@ -83,15 +77,17 @@ JobHandle miniSynthMidiControl(const AlsaAudioCardIdentifier &audioOutCard,
                                unsigned int buffersize,
                                unsigned int samplerate)
 {
+    m_stopWatchScope = sw->scope("miniSynth");
     JobHandle ret;
 
     // No input here!
     ret.inBuffer = nullptr;
     ret.audioInput = nullptr;
 
-    ret.outBuffer = createBuffer("OutputBuffer");
+    ret.outBuffer = createNonBlockingBuffer("OutputBuffer");
     ret.audioOutput = createAlsaOutputDevice(audioOutCard, ret.outBuffer, buffersize);
     ret.audioOutput->setSamplerate(samplerate);
+    negotiateSampleFormat(ret.audioOutput);
 
     ret.inMidiBuffer = createBuffer("MidiBuffer");
     ret.midiInput = createRawMidiDevice(midiInCard, ret.inMidiBuffer);
@@ -65,8 +65,8 @@ Outputmixer::Outputmixer()
     mSVFilterMix_L = {0.f};
 
     //******************************* Filters ********************************//
-    pHighpass_L = new OnePoleFilters(NlToolbox::Conversion::pitch2freq(8.f), 0.f, OnePoleFilterType::HIGHPASS);
-    pHighpass_R = new OnePoleFilters(NlToolbox::Conversion::pitch2freq(8.f), 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass_L = OnePoleFilters(NlToolbox::Conversion::pitch2freq(8.f), 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass_R = OnePoleFilters(NlToolbox::Conversion::pitch2freq(8.f), 0.f, OnePoleFilterType::HIGHPASS);
 
     //****************************** Smoothing *******************************//
     mSmootherMask = 0x0000;
@@ -144,8 +144,8 @@ Outputmixer::Outputmixer(float _ALevel,
     mSVFilterMix_L = {0.f};
 
     //******************************* Filters ********************************//
-    pHighpass_L = new OnePoleFilters(NlToolbox::Conversion::pitch2freq(8.f), 0.f, OnePoleFilterType::HIGHPASS);
-    pHighpass_R = new OnePoleFilters(NlToolbox::Conversion::pitch2freq(8.f), 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass_L = OnePoleFilters(NlToolbox::Conversion::pitch2freq(8.f), 0.f, OnePoleFilterType::HIGHPASS);
+    mHighpass_R = OnePoleFilters(NlToolbox::Conversion::pitch2freq(8.f), 0.f, OnePoleFilterType::HIGHPASS);
 
     //****************************** Smoothing *******************************//
     mSmootherMask = 0x0000;
@@ -167,19 +167,6 @@ Outputmixer::Outputmixer(float _ALevel,
 
 
 
-/******************************************************************************/
-/** Output Mixer Destructor
- * @brief
-*******************************************************************************/
-
-Outputmixer::~Outputmixer()
-{
-    delete pHighpass_L;
-    delete pHighpass_R;
-}
-
-
-
 /******************************************************************************/
 /** @brief  main function which calculates a Mix of the incoming Samples from
  *          the Soundgenerator, Comb anfd SV Filters. the Signale can then be
@@ -246,8 +233,8 @@ void Outputmixer::applyOutputMixer(uint32_t _voiceNumber, float _sampleA, float
     if (_voiceNumber + 1 == NUM_VOICES)
     {
         //************************ 1-Pole Highpass ***************************//
-        mSample_L = pHighpass_L->applyFilter(mSample_L);
-        mSample_R = pHighpass_R->applyFilter(mSample_R);
+        mSample_L = mHighpass_L.applyFilter(mSample_L);
+        mSample_R = mHighpass_R.applyFilter(mSample_R);
 
 
         //************************** Main Level ******************************//
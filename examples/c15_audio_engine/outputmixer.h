@@ -39,7 +39,7 @@ public:
                 float _mainLevel,
                 float _keyPan);
 
-    ~Outputmixer();                 // Destructor
+    ~Outputmixer(){}                // Destructor
 
     float mSample_L, mSample_R;     // Resulting Samples for left and right channel
 
@@ -82,8 +82,8 @@ private:
     std::array<float, NUM_VOICES> mSVFilterMix_L;
 
     //*************************** Filters ************************************//
-    OnePoleFilters* pHighpass_L;
-    OnePoleFilters* pHighpass_R;
+    OnePoleFilters mHighpass_L;
+    OnePoleFilters mHighpass_R;
 
 
     //************************** Smoothing Variables *************************//
@@ -21,17 +21,21 @@ void paramengine::init(uint32_t _sampleRate, uint32_t _voices)
     m_timeFactors[2] = static_cast<float>(_sampleRate / dsp_clock_rates[0]);    // time convertsion factor (fast types)
     m_timeFactors[3] = static_cast<float>(_sampleRate / dsp_clock_rates[1]);    // time convertsion factor (slow types)
     std::cout << "Time Factors: (" << m_timeFactors[0] << ", " << m_timeFactors[1] << ", " << m_timeFactors[2] << ", " << m_timeFactors[3] << ")" << std::endl;
+    /* provide indices for further definitions */
+    uint32_t i, p;
     /* initialize components */
     m_clockIds.reset();
     m_postIds.reset();
-    m_convert.init();
+    for(i = 0; i < dsp_clock_types; i++)
+    {
+        m_monoRamps[i].reset();
+        m_polyRamps[i].reset();
+    }
     /* initialize control shapers */
     m_combDecayCurve.setCurve(0.f, 0.25, 1.f);                                  // initialize control shaper for the comb decay parameter
     m_svfLBH1Curve.setCurve(-1.f, -1.f, 1.f);                                   // initialize control shaper for the LBH parameter (upper crossmix)
     m_svfLBH2Curve.setCurve(-1.f, 1.f, 1.f);                                    // initialize control shaper for the LBH parameter (lower crossmix)
     m_svfResonanceCurve.setCurve(0.f, 0.49f, 0.79f, 0.94f);                     // initialize control shaper for the svf resonance parameter (later, test4)
-    /* provide indices for further definitions */
-    uint32_t i, p;
     /* initialize envelope events */
     for(i = 0; i < sig_number_of_env_events; i++)
     {
@@ -44,11 +48,15 @@ void paramengine::init(uint32_t _sampleRate, uint32_t _voices)
         /* provide parameter reference */
         param_head* obj = &m_head[p];
         /* declarations according to parameter definition */
-        obj->m_index = i;                                                       // index points to first voice/item in (rendering) array
         obj->m_id = static_cast<int32_t>(param_definition[p][0]);               // TCD id
         obj->m_clockType = static_cast<uint32_t>(param_definition[p][1]);       // clock type (sync/audio/fast/slow)
         obj->m_polyType = static_cast<uint32_t>(param_definition[p][2]);        // poly type (mono/poly)
         obj->m_size = m_routePolyphony[obj->m_polyType];                        // determine (rendering) size
+        if(obj->m_polyType == 1)
+        {
+            i = (i + dsp_simd_lanes - 1) & ~(dsp_simd_lanes - 1);               // poly items start at a lane boundary (one vector per voice group)
+        }
+        obj->m_index = i;                                                       // index points to first voice/item in (rendering) array
         obj->m_normalize = 1.f / param_definition[p][3];                        // TCD range
         obj->m_scaleId = static_cast<uint32_t>(param_definition[p][4]);         // TCD scale id
         obj->m_scaleArg = param_definition[p][5];                               // TCD scale argument
@@ -64,8 +72,8 @@ void paramengine::init(uint32_t _sampleRate, uint32_t _voices)
                 m_postIds.add(static_cast<uint32_t>(param_definition[p][7]), obj->m_clockType, obj->m_polyType, p);
             }
         }
-        /* update item pointer */
-        i += obj->m_size;
+        /* update item pointer (poly parameters occupy a full row of voice lanes) */
+        i += obj->m_polyType == 0 ? 1 : dsp_simd_voices;
     }
     /* initialize global utility parameters */
     for(i = 0; i < sig_number_of_utilities; i++)
@@ -171,26 +179,25 @@ void paramengine::setDx(const uint32_t _voiceId, const uint32_t _paramId, float
     /* handle by clock type and clip to fit [0 ... 1] range */
     _value = NlToolbox::Clipping::floatMin(_value * m_timeFactors[obj->m_clockType], 1.f);
     /* pass value to (rendering) item */
-    m_body[index].m_dx[0] = _value;
+    m_body.m_dx[0][index] = _value;
 }
 
 /* TCD mechanism - destination updates */
 void paramengine::setDest(const uint32_t _voiceId, const uint32_t _paramId, float _value)
 {
-    /* provide object and (rendering) item references */
+    /* provide object reference and (rendering) item index */
     param_head* obj = &m_head[_paramId];
     const uint32_t index = obj->m_index + _voiceId;
-    param_body* item = &m_body[index];
     /* normalize and scale destination argument, pass result to (rendering) item */
     _value *= obj->m_normalize;
-    item->m_dest = scale(obj->m_scaleId, obj->m_scaleArg, _value);
+    m_body.m_dest[index] = scale(obj->m_scaleId, obj->m_scaleArg, _value);
     /* apply according to preload and clock type */
     if(m_preload == 0)
     {
         /* sync type parameters apply directly, non-sync type parameters apply destinations */
         if(obj->m_clockType > 0)
         {
-            applyDest(index);
+            applyDest(_voiceId, _paramId);
         }
         else
         {
@@ -199,21 +206,20 @@ void paramengine::setDest(const uint32_t _voiceId, const uint32_t _paramId, floa
     }
     else
     {
-        item->m_preload++;
+        m_body.m_preload[index]++;
     }
 }
 
 /* TCD mechanism - preload functionality */
 void paramengine::applyPreloaded(const uint32_t _voiceId, const uint32_t _paramId)
 {
-    /* provide object and (rendering) item references */
+    /* provide object reference and (rendering) item index */
     param_head* obj = &m_head[_paramId];
     const uint32_t index = obj->m_index + _voiceId;
-    param_body* item = &m_body[index];
     /* apply according to preload status */
-    if(item->m_preload > 0)
+    if(m_body.m_preload[index] > 0)
     {
-        item->m_preload = 0;
+        m_body.m_preload[index] = 0;
         /* sync type parameters apply directly, non-sync type parameters apply destinations */
         if(obj->m_clockType == 0)
         {
@@ -221,47 +227,142 @@ void paramengine::applyPreloaded(const uint32_t _voiceId, const uint32_t _paramI
         }
         else
         {
-            applyDest(index);
+            applyDest(_voiceId, _paramId);
         }
     }
 }
 
 /* TCD mechanism - application (non-sync types performing transitions) */
-void paramengine::applyDest(const uint32_t _index)
+void paramengine::applyDest(const uint32_t _voiceId, const uint32_t _paramId)
 {
-    /* provide (rendering) item reference */
-    param_body* item = &m_body[_index];
-    /* construct segment and set rendering state */
-    item->m_start = item->m_signal;
-    item->m_diff = item->m_dest - item->m_start;
-    item->m_x = item->m_dx[1] = item->m_dx[0];
-    item->m_state = 1;
+    /* provide object reference and (rendering) item index */
+    param_head* obj = &m_head[_paramId];
+    const uint32_t index = obj->m_index + _voiceId;
+    /* construct segment */
+    m_body.m_start[index] = m_body.m_signal[index];
+    m_body.m_diff[index] = m_body.m_dest[index] - m_body.m_start[index];
+    m_body.m_x[index] = m_body.m_dx[1][index] = m_body.m_dx[0][index];
+    /* register a new ramp for rendering (a running ramp is listed already, poly parameters are listed by row) and set rendering state */
+    if(m_body.m_state[index] == 0)
+    {
+        if(obj->m_polyType == 0)
+        {
+            m_monoRamps[obj->m_clockType].add(index);
+        }
+        else if(!polyRowLive(obj->m_index))
+        {
+            m_polyRamps[obj->m_clockType].add(obj->m_index);
+        }
+    }
+    m_body.m_state[index] = 1;
 }
 
 /* TCD mechanism - application (sync types performing steps) */
 void paramengine::applySync(const uint32_t _index)
 {
     /* just update signal, no reference for one-liner */
-    m_body[_index].m_signal = m_body[_index].m_dest;
+    m_body.m_signal[_index] = m_body.m_dest[_index];
 }
 
 /* parameter rendering */
 void paramengine::tickItem(const uint32_t _index)
 {
-    /* provide (rendering) item reference */
-    param_body* item = &m_body[_index];
     /* render when state is true */
-    if(item->m_state == 1)
+    if(m_body.m_state[_index] == 1)
     {
         /* stop on final sample */
-        if(item->m_x >= 1)
+        if(m_body.m_x[_index] >= 1)
         {
-            item->m_x = 1;
-            item->m_state = 0;
+            m_body.m_x[_index] = 1;
+            m_body.m_state[_index] = 0;
         }
         /* update signal (and x) */
-        item->m_signal = item->m_start + (item->m_diff * item->m_x);
-        item->m_x += item->m_dx[1];
+        m_body.m_signal[_index] = m_body.m_start[_index] + (m_body.m_diff[_index] * m_body.m_x[_index]);
+        m_body.m_x[_index] += m_body.m_dx[1][_index];
+    }
+}
+
+/* parameter rendering - live mono ramps of a clock type */
+void paramengine::tickMonoRamps(const uint32_t _clockType)
+{
+    tickRamps(m_monoRamps[_clockType]);
+}
+
+/* parameter rendering - live poly rows of a clock type, the voices of a row are rendered lane by lane (same operations as tickItem()),
+   a row drops out once all of its voices finished */
+void paramengine::tickPolyRamps(const uint32_t _clockType)
+{
+    using namespace NlToolbox::Simd;
+    id_list &rows = m_polyRamps[_clockType];
+    uint32_t r = 0;
+    while(r < rows.m_length)
+    {
+        const uint32_t row = rows.m_data[r];
+        vint live = splat(0);
+        for(uint32_t index = row; index < row + dsp_simd_voices; index += dsp_simd_lanes)
+        {
+            vint state = load(&m_body.m_state[index]);
+            const vint active = state == 1;
+            if(!any(active))
+            {
+                continue;
+            }
+            /* stop on final sample */
+            vfloat x = load(&m_body.m_x[index]);
+            const vint finish = active & (x >= 1.f);
+            x = select(finish, splat(1.f), x);
+            state = select(finish, splat(0), state);
+            /* update signal (and x) of the rendering lanes */
+            const vfloat signal = load(&m_body.m_start[index]) + (load(&m_body.m_diff[index]) * x);
+            store(&m_body.m_signal[index], select(active, signal, load(&m_body.m_signal[index])));
+            store(&m_body.m_x[index], select(active, x + load(&m_body.m_dx[1][index]), x));
+            store(&m_body.m_state[index], state);
+            live |= state != 0;
+        }
+        if(any(live))
+        {
+            r++;
+        }
+        else
+        {
+            /* replace by the last row */
+            rows.m_length--;
+            rows.m_data[r] = rows.m_data[rows.m_length];
+        }
+    }
+}
+
+/* parameter rendering - is any voice of a poly row in transition? */
+bool paramengine::polyRowLive(const uint32_t _row)
+{
+    for(uint32_t index = _row; index < _row + dsp_simd_voices; index++)
+    {
+        if(m_body.m_state[index] == 1)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* parameter rendering - only items in transition are visited, finished ramps drop out (order within a list is irrelevant) */
+void paramengine::tickRamps(id_list &_ramps)
+{
+    uint32_t r = 0;
+    while(r < _ramps.m_length)
+    {
+        const uint32_t index = _ramps.m_data[r];
+        tickItem(index);
+        if(m_body.m_state[index] == 0)
+        {
+            /* replace by the last ramp */
+            _ramps.m_length--;
+            _ramps.m_data[r] = _ramps.m_data[_ramps.m_length];
+        }
+        else
+        {
+            r++;
+        }
     }
 }
 
@@ -293,7 +394,7 @@ void paramengine::keyUp(const uint32_t _voiceId, float _velocity)
 void paramengine::keyApply(const uint32_t _voiceId)
 {
     /* apply key event (update envelopes according to event type) */
-    const float pitch = m_body[m_head[P_KEY_NP].m_index + _voiceId].m_signal;
+    const float pitch = m_body.m_signal[m_head[P_KEY_NP].m_index + _voiceId];
     const float velocity = m_event.m_poly[_voiceId].m_velocity;
     if(m_event.m_poly[_voiceId].m_type == 0)
     {
@@ -335,6 +436,26 @@ void paramengine::keyApply(const uint32_t _voiceId)
     }
 }
 
+/* Voice Activity - true, if every poly envelope of the voice has finished its release (idle state) */
+bool paramengine::polyEnvelopesIdle(const uint32_t _voiceId)
+{
+#if dsp_take_envelope == 0
+    /* "OLD" ENVELOPES: */
+    for(uint32_t e = 0; e < m_envelopes.m_polyIds.m_data[1].m_length; e++)
+    {
+        if(m_envelopes.m_body[m_envelopes.m_head[m_envelopes.m_polyIds.m_data[1].m_data[e]].m_index + _voiceId].m_state != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+#elif dsp_take_envelope == 1
+    /* "NEW" ENVELOPES: */
+    return (m_new_envelopes.m_env_a.m_body.m_state[_voiceId] == 0) && (m_new_envelopes.m_env_b.m_body.m_state[_voiceId] == 0)
+        && (m_new_envelopes.m_env_c.m_body.m_state[_voiceId] == 0) && (m_new_envelopes.m_env_g.m_body.m_state[_voiceId] == 0);
+#endif
+}
+
 /* TCD Key Events - mono key mechanism */
 void paramengine::keyApplyMono()
 {
@@ -371,10 +492,10 @@ void paramengine::envUpdateStart(const uint32_t _voiceId, const uint32_t _envId,
     const uint32_t envIndex = m_envIds[_envId];
     float time, dest;
     /* determine envelope event parameters */
-    float timeKT = -m_body[m_head[envIndex + E_TKT].m_index].m_signal * _pitch;
-    float levelVel = -m_body[m_head[envIndex + E_LV].m_index].m_signal;
-    float attackVel = -m_body[m_head[envIndex + E_AV].m_index].m_signal * _velocity;
-    float levelKT = m_body[m_head[envIndex + E_LKT].m_index].m_signal * _pitch;
+    float timeKT = -m_body.m_signal[m_head[envIndex + E_TKT].m_index] * _pitch;
+    float levelVel = -m_body.m_signal[m_head[envIndex + E_LV].m_index];
+    float attackVel = -m_body.m_signal[m_head[envIndex + E_AV].m_index] * _velocity;
+    float levelKT = m_body.m_signal[m_head[envIndex + E_LKT].m_index] * _pitch;
     /* determine envelope peak level - clipped to max. +3dB (candidate) */
     float peak = NlToolbox::Clipping::floatMin(m_convert.eval_level(((1 - _velocity) * levelVel) + levelKT), env_clip_peak);
     /* envelope event updates */
@@ -383,21 +504,21 @@ void paramengine::envUpdateStart(const uint32_t _voiceId, const uint32_t _envId,
     m_event.m_env[_envId].m_timeFactor[_voiceId][1] = m_convert.eval_level(timeKT) * m_millisecond;
     m_event.m_env[_envId].m_timeFactor[_voiceId][2] = m_event.m_env[_envId].m_timeFactor[_voiceId][1];
     /* envelope segment updates (Attack - Time, Peak) */
-    time = m_body[m_head[envIndex + E_ATT].m_index].m_signal * m_event.m_env[_envId].m_timeFactor[_voiceId][0];
+    time = m_body.m_signal[m_head[envIndex + E_ATT].m_index] * m_event.m_env[_envId].m_timeFactor[_voiceId][0];
     m_envelopes.setSegmentDx(_voiceId, _envId, 1, 1 / (time + 1));
     m_envelopes.setSegmentDest(_voiceId, _envId, 1, peak);
     /* envelope segment updates (Decay1 - Time, Breakpoint Level) */
-    time = m_body[m_head[envIndex + E_DEC1].m_index].m_signal * m_event.m_env[_envId].m_timeFactor[_voiceId][1];
+    time = m_body.m_signal[m_head[envIndex + E_DEC1].m_index] * m_event.m_env[_envId].m_timeFactor[_voiceId][1];
     m_envelopes.setSegmentDx(_voiceId, _envId, 2, 1 / (time + 1));
-    dest = peak * m_body[m_head[envIndex + E_BP].m_index].m_signal;
+    dest = peak * m_body.m_signal[m_head[envIndex + E_BP].m_index];
     m_envelopes.setSegmentDest(_voiceId, _envId, 2, dest);
     /* envelope segment updates (Decay2 - Time, Sustain Level) */
-    time = m_body[m_head[envIndex + E_DEC2].m_index].m_signal * m_event.m_env[_envId].m_timeFactor[_voiceId][2];
+    time = m_body.m_signal[m_head[envIndex + E_DEC2].m_index] * m_event.m_env[_envId].m_timeFactor[_voiceId][2];
     m_envelopes.setSegmentDx(_voiceId, _envId, 3, 1 / (time + 1));
-    dest = peak * m_body[m_head[envIndex + E_SUS].m_index].m_signal;
+    dest = peak * m_body.m_signal[m_head[envIndex + E_SUS].m_index];
     m_envelopes.setSegmentDest(_voiceId, _envId, 3, dest);
     /* trigger envelope start (passing envelope curvature) */
-    m_envelopes.startEnvelope(_voiceId, _envId, m_body[m_head[envIndex + E_AC].m_index].m_signal, _retriggerHardness);
+    m_envelopes.startEnvelope(_voiceId, _envId, m_body.m_signal[m_head[envIndex + E_AC].m_index], _retriggerHardness);
 }
 
 /* envelope updates - stop procedure */
@@ -407,15 +528,15 @@ void paramengine::envUpdateStop(const uint32_t _voiceId, const uint32_t _envId,
     const uint32_t envIndex = m_envIds[_envId];
     float time;
     /* determine envelope event parameters */
-    float timeKT = -m_body[m_head[envIndex + E_TKT].m_index].m_signal * _pitch;
-    float releaseVel = -m_body[m_head[envIndex + E_RV].m_index].m_signal * _velocity;
+    float timeKT = -m_body.m_signal[m_head[envIndex + E_TKT].m_index] * _pitch;
+    float releaseVel = -m_body.m_signal[m_head[envIndex + E_RV].m_index] * _velocity;
     /* envelope event updates */
     m_event.m_env[_envId].m_timeFactor[_voiceId][3] = m_convert.eval_level(timeKT + releaseVel) * m_millisecond;
     /* envelope segment updates (Release - Time) - distinguish finite and infinite times */
-    if(m_body[m_head[envIndex + E_REL].m_index].m_signal <= env_highest_finite_time)
+    if(m_body.m_signal[m_head[envIndex + E_REL].m_index] <= env_highest_finite_time)
     {
         /* finite release time */
-        time = m_body[m_head[envIndex + E_REL].m_index].m_signal * m_event.m_env[_envId].m_timeFactor[_voiceId][3];
+        time = m_body.m_signal[m_head[envIndex + E_REL].m_index] * m_event.m_env[_envId].m_timeFactor[_voiceId][3];
         m_envelopes.setSegmentDx(_voiceId, _envId, 4, 1 / (time + 1));
     }
     else
@@ -434,19 +555,19 @@ void paramengine::envUpdateTimes(const uint32_t _voiceId, const uint32_t _envId)
     const uint32_t envIndex = m_envIds[_envId];
     float time;
     /* envelope segment updates (Attack - Time) */
-    time = m_body[m_head[envIndex + E_ATT].m_index].m_signal * m_event.m_env[_envId].m_timeFactor[_voiceId][0];
+    time = m_body.m_signal[m_head[envIndex + E_ATT].m_index] * m_event.m_env[_envId].m_timeFactor[_voiceId][0];
     m_envelopes.setSegmentDx(_voiceId, _envId, 1, 1 / (time + 1));
     /* envelope segment updates (Decay1 - Time) */
-    time = m_body[m_head[envIndex + E_DEC1].m_index].m_signal * m_event.m_env[_envId].m_timeFactor[_voiceId][1];
+    time = m_body.m_signal[m_head[envIndex + E_DEC1].m_index] * m_event.m_env[_envId].m_timeFactor[_voiceId][1];
     m_envelopes.setSegmentDx(_voiceId, _envId, 2, 1 / (time + 1));
     /* envelope segment updates (Decay2 - Time) */
-    time = m_body[m_head[envIndex + E_DEC2].m_index].m_signal * m_event.m_env[_envId].m_timeFactor[_voiceId][2];
+    time = m_body.m_signal[m_head[envIndex + E_DEC2].m_index] * m_event.m_env[_envId].m_timeFactor[_voiceId][2];
     m_envelopes.setSegmentDx(_voiceId, _envId, 3, 1 / (time + 1));
     /* envelope segment updates (Release  Time) - distinguish finite and infinite times */
-    if(m_body[m_head[envIndex + E_REL].m_index].m_signal <= env_highest_finite_time)
+    if(m_body.m_signal[m_head[envIndex + E_REL].m_index] <= env_highest_finite_time)
     {
         /* finite release time */
-        time = m_body[m_head[envIndex + E_REL].m_index].m_signal * m_event.m_env[_envId].m_timeFactor[_voiceId][3];
+        time = m_body.m_signal[m_head[envIndex + E_REL].m_index] * m_event.m_env[_envId].m_timeFactor[_voiceId][3];
         m_envelopes.setSegmentDx(_voiceId, _envId, 4, 1 / (time + 1));
     }
     else
@@ -463,9 +584,9 @@ void paramengine::envUpdateLevels(const uint32_t _voiceId, const uint32_t _envId
     const uint32_t envIndex = m_envIds[_envId];
     float peak = m_event.m_env[_envId].m_levelFactor[_voiceId];
     /* envelope segment updates (Decay1 - Breakpoint Level) */
-    m_envelopes.setSegmentDest(_voiceId, _envId, 2, peak * m_body[m_head[envIndex + E_BP].m_index].m_signal);
+    m_envelopes.setSegmentDest(_voiceId, _envId, 2, peak * m_body.m_signal[m_head[envIndex + E_BP].m_index]);
     /* envelope segment updates (Decay2 - Sustain Level) */
-    m_envelopes.setSegmentDest(_voiceId, _envId, 3, peak * m_body[m_head[envIndex + E_SUS].m_index].m_signal);
+    m_envelopes.setSegmentDest(_voiceId, _envId, 3, peak * m_body.m_signal[m_head[envIndex + E_SUS].m_index]);
 }
 #elif dsp_take_envelope == 1
 /*
@@ -485,10 +606,10 @@ void paramengine::newEnvUpdateStart(const uint32_t _voiceId, const float _pitch,
     envId = 0;                                                                                                          // setting the focus on envelope a
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
 
-    timeKT = -m_body[m_head[envIndex + E_TKT].m_index].m_signal * _pitch;                                               // determine time key tracking according to pitch and parameter
-    levelVel = -m_body[m_head[envIndex + E_LV].m_index].m_signal;                                                       // get level velocity parameter
-    attackVel = -m_body[m_head[envIndex + E_AV].m_index].m_signal * _velocity;                                          // determine attack velocity accorindg to velocity and parameter
-    levelKT = m_body[m_head[envIndex + E_LKT].m_index].m_signal * _pitch;                                               // determine level key tracking according to pitch and parameter
+    timeKT = -m_body.m_signal[m_head[envIndex + E_TKT].m_index] * _pitch;                                               // determine time key tracking according to pitch and parameter
+    levelVel = -m_body.m_signal[m_head[envIndex + E_LV].m_index];                                                       // get level velocity parameter
+    attackVel = -m_body.m_signal[m_head[envIndex + E_AV].m_index] * _velocity;                                          // determine attack velocity accorindg to velocity and parameter
+    levelKT = m_body.m_signal[m_head[envIndex + E_LKT].m_index] * _pitch;                                               // determine level key tracking according to pitch and parameter
     peak = NlToolbox::Clipping::floatMin(m_convert.eval_level(((1.f - _velocity) * levelVel) + levelKT), env_clip_peak);// determine peak level according to velocity and level parameters (max +3dB)
 
     m_event.m_env[envId].m_levelFactor[_voiceId] = peak;                                                                // remember peak level
@@ -496,22 +617,22 @@ void paramengine::newEnvUpdateStart(const uint32_t _voiceId, const float _pitch,
     m_event.m_env[envId].m_timeFactor[_voiceId][1] = m_convert.eval_level(timeKT) * m_millisecond;                      // determine time factor for decay1 segment (without actual decay1 time)
     m_event.m_env[envId].m_timeFactor[_voiceId][2] = m_event.m_env[envId].m_timeFactor[_voiceId][1];                    // determine time factor for decay2 segment (without actual decay2 time)
 
-    m_new_envelopes.m_env_a.setSplitValue(m_body[m_head[envIndex + E_SPL].m_index].m_signal);                           // update the split behavior by corresponding parameter
-    m_new_envelopes.m_env_a.setAttackCurve(m_body[m_head[envIndex + E_AC].m_index].m_signal);                           // update the attack curve by corresponding parameter
+    m_new_envelopes.m_env_a.setSplitValue(m_body.m_signal[m_head[envIndex + E_SPL].m_index]);                           // update the split behavior by corresponding parameter
+    m_new_envelopes.m_env_a.setAttackCurve(m_body.m_signal[m_head[envIndex + E_AC].m_index]);                           // update the attack curve by corresponding parameter
     m_new_envelopes.m_env_a.setPeakLevel(_voiceId, peak);                                                               // update the current peak level (for magnitude/timbre crossfades)
 
-    time = m_body[m_head[envIndex + E_ATT].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_ATT].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
     m_new_envelopes.m_env_a.setSegmentDx(_voiceId, 1, 1.f / (time + 1.f));                                              // update attack segment time
     m_new_envelopes.m_env_a.setSegmentDest(_voiceId, 1, false, peak);                                                   // update attack segment destination (peak level) (no split behavior)
 
-    time = m_body[m_head[envIndex + E_DEC1].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC1].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
     m_new_envelopes.m_env_a.setSegmentDx(_voiceId, 2, 1.f / (time + 1.f));                                              // update decay1 segment time
-    dest = peak * m_body[m_head[envIndex + E_BP].m_index].m_signal;                                                     // determine decay1 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_BP].m_index];                                                     // determine decay1 segment destination according to peak level and parameter
     m_new_envelopes.m_env_a.setSegmentDest(_voiceId, 2, true, dest);                                                    // update decay1 segment destination (split behavior)
 
-    time = m_body[m_head[envIndex + E_DEC2].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC2].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
     m_new_envelopes.m_env_a.setSegmentDx(_voiceId, 3, 1.f / (time + 1.f));                                              // update decay2 segment time
-    dest = peak * m_body[m_head[envIndex + E_SUS].m_index].m_signal;                                                    // determine decay2 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_SUS].m_index];                                                    // determine decay2 segment destination according to peak level and parameter
     m_new_envelopes.m_env_a.setSegmentDest(_voiceId, 3, true, dest);                                                    // update decay2 segment destination (split behavior)
 
     /* envelope b update */
@@ -519,10 +640,10 @@ void paramengine::newEnvUpdateStart(const uint32_t _voiceId, const float _pitch,
     envId = 1;                                                                                                          // setting the focus on envelope b
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
 
-    timeKT = -m_body[m_head[envIndex + E_TKT].m_index].m_signal * _pitch;                                               // determine time key tracking according to pitch and parameter
-    levelVel = -m_body[m_head[envIndex + E_LV].m_index].m_signal;                                                       // get level velocity parameter
-    attackVel = -m_body[m_head[envIndex + E_AV].m_index].m_signal * _velocity;                                          // determine attack velocity accorindg to velocity and parameter
-    levelKT = m_body[m_head[envIndex + E_LKT].m_index].m_signal * _pitch;                                               // determine level key tracking according to pitch and parameter
+    timeKT = -m_body.m_signal[m_head[envIndex + E_TKT].m_index] * _pitch;                                               // determine time key tracking according to pitch and parameter
+    levelVel = -m_body.m_signal[m_head[envIndex + E_LV].m_index];                                                       // get level velocity parameter
+    attackVel = -m_body.m_signal[m_head[envIndex + E_AV].m_index] * _velocity;                                          // determine attack velocity accorindg to velocity and parameter
+    levelKT = m_body.m_signal[m_head[envIndex + E_LKT].m_index] * _pitch;                                               // determine level key tracking according to pitch and parameter
     peak = NlToolbox::Clipping::floatMin(m_convert.eval_level(((1.f - _velocity) * levelVel) + levelKT), env_clip_peak);// determine peak level according to velocity and level parameters (max +3dB)
 
     m_event.m_env[envId].m_levelFactor[_voiceId] = peak;                                                                // remember peak level
@@ -530,22 +651,22 @@ void paramengine::newEnvUpdateStart(const uint32_t _voiceId, const float _pitch,
     m_event.m_env[envId].m_timeFactor[_voiceId][1] = m_convert.eval_level(timeKT) * m_millisecond;                      // determine time factor for decay1 segment (without actual decay1 time)
     m_event.m_env[envId].m_timeFactor[_voiceId][2] = m_event.m_env[envId].m_timeFactor[_voiceId][1];                    // determine time factor for decay2 segment (without actual decay2 time)
 
-    m_new_envelopes.m_env_b.setSplitValue(m_body[m_head[envIndex + E_SPL].m_index].m_signal);                           // update the split behavior by corresponding parameter
-    m_new_envelopes.m_env_b.setAttackCurve(m_body[m_head[envIndex + E_AC].m_index].m_signal);                           // update the attack curve by corresponding parameter
+    m_new_envelopes.m_env_b.setSplitValue(m_body.m_signal[m_head[envIndex + E_SPL].m_index]);                           // update the split behavior by corresponding parameter
+    m_new_envelopes.m_env_b.setAttackCurve(m_body.m_signal[m_head[envIndex + E_AC].m_index]);                           // update the attack curve by corresponding parameter
     m_new_envelopes.m_env_b.setPeakLevel(_voiceId, peak);                                                               // update the current peak level (for magnitude/timbre crossfades)
 
-    time = m_body[m_head[envIndex + E_ATT].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_ATT].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
     m_new_envelopes.m_env_b.setSegmentDx(_voiceId, 1, 1.f / (time + 1.f));                                              // update attack segment time
     m_new_envelopes.m_env_b.setSegmentDest(_voiceId, 1, false, peak);                                                   // update attack segment destination (peak level) (no split behavior)
 
-    time = m_body[m_head[envIndex + E_DEC1].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC1].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
     m_new_envelopes.m_env_b.setSegmentDx(_voiceId, 2, 1.f / (time + 1.f));                                              // update decay1 segment time
-    dest = peak * m_body[m_head[envIndex + E_BP].m_index].m_signal;                                                     // determine decay1 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_BP].m_index];                                                     // determine decay1 segment destination according to peak level and parameter
     m_new_envelopes.m_env_b.setSegmentDest(_voiceId, 2, true, dest);                                                    // update decay1 segment destination (split behavior)
 
-    time = m_body[m_head[envIndex + E_DEC2].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC2].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
     m_new_envelopes.m_env_b.setSegmentDx(_voiceId, 3, 1.f / (time + 1.f));                                              // update decay2 segment time
-    dest = peak * m_body[m_head[envIndex + E_SUS].m_index].m_signal;                                                    // determine decay2 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_SUS].m_index];                                                    // determine decay2 segment destination according to peak level and parameter
     m_new_envelopes.m_env_b.setSegmentDest(_voiceId, 3, true, dest);                                                    // update decay2 segment destination (split behavior)
 
     /* envelope c update */
@@ -553,10 +674,10 @@ void paramengine::newEnvUpdateStart(const uint32_t _voiceId, const float _pitch,
     envId = 2;                                                                                                          // setting the focus on envelope c
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
 
-    timeKT = -m_body[m_head[envIndex + E_TKT].m_index].m_signal * _pitch;                                               // determine time key tracking according to pitch and parameter
-    levelVel = -m_body[m_head[envIndex + E_LV].m_index].m_signal;                                                       // get level velocity parameter
-    attackVel = -m_body[m_head[envIndex + E_AV].m_index].m_signal * _velocity;                                          // determine attack velocity accorindg to velocity and parameter
-    levelKT = m_body[m_head[envIndex + E_LKT].m_index].m_signal * _pitch;                                               // determine level key tracking according to pitch and parameter
+    timeKT = -m_body.m_signal[m_head[envIndex + E_TKT].m_index] * _pitch;                                               // determine time key tracking according to pitch and parameter
+    levelVel = -m_body.m_signal[m_head[envIndex + E_LV].m_index];                                                       // get level velocity parameter
+    attackVel = -m_body.m_signal[m_head[envIndex + E_AV].m_index] * _velocity;                                          // determine attack velocity accorindg to velocity and parameter
+    levelKT = m_body.m_signal[m_head[envIndex + E_LKT].m_index] * _pitch;                                               // determine level key tracking according to pitch and parameter
     peak = NlToolbox::Clipping::floatMin(m_convert.eval_level(((1.f - _velocity) * levelVel) + levelKT), env_clip_peak);// determine peak level according to velocity and level parameters (max +3dB)
 
     m_event.m_env[envId].m_levelFactor[_voiceId] = peak;                                                                // remember peak level
@@ -564,21 +685,21 @@ void paramengine::newEnvUpdateStart(const uint32_t _voiceId, const float _pitch,
     m_event.m_env[envId].m_timeFactor[_voiceId][1] = m_convert.eval_level(timeKT) * m_millisecond;                      // determine time factor for decay1 segment (without actual decay1 time)
     m_event.m_env[envId].m_timeFactor[_voiceId][2] = m_event.m_env[envId].m_timeFactor[_voiceId][1];                    // determine time factor for decay2 segment (without actual decay2 time)
 
-    m_new_envelopes.m_env_c.setAttackCurve(m_body[m_head[envIndex + E_AC].m_index].m_signal);                           // update the attack curve by corresponding parameter
-    m_new_envelopes.m_env_c.setRetriggerHardness(m_body[m_head[envIndex + E_RH].m_index].m_signal);                     // update the retrigger hardness by corresponding parameter
+    m_new_envelopes.m_env_c.setAttackCurve(m_body.m_signal[m_head[envIndex + E_AC].m_index]);                           // update the attack curve by corresponding parameter
+    m_new_envelopes.m_env_c.setRetriggerHardness(m_body.m_signal[m_head[envIndex + E_RH].m_index]);                     // update the retrigger hardness by corresponding parameter
 
-    time = m_body[m_head[envIndex + E_ATT].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_ATT].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
     m_new_envelopes.m_env_c.setSegmentDx(_voiceId, 1, 1.f / (time + 1.f));                                              // update attack segment time
     m_new_envelopes.m_env_c.setSegmentDest(_voiceId, 1, peak);                                                          // update attack segment destination (peak level) (no split behavior)
 
-    time = m_body[m_head[envIndex + E_DEC1].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC1].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
     m_new_envelopes.m_env_c.setSegmentDx(_voiceId, 2, 1.f / (time + 1.f));                                              // update decay1 segment time
-    dest = peak * m_body[m_head[envIndex + E_BP].m_index].m_signal;                                                     // determine decay1 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_BP].m_index];                                                     // determine decay1 segment destination according to peak level and parameter
     m_new_envelopes.m_env_c.setSegmentDest(_voiceId, 2, dest);                                                          // update decay1 segment destination (no split behavior)
 
-    time = m_body[m_head[envIndex + E_DEC2].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC2].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
     m_new_envelopes.m_env_c.setSegmentDx(_voiceId, 3, 1.f / (time + 1.f));                                              // update decay2 segment time
-    dest = peak * m_body[m_head[envIndex + E_SUS].m_index].m_signal;                                                    // determine decay2 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_SUS].m_index];                                                    // determine decay2 segment destination according to peak level and parameter
     m_new_envelopes.m_env_c.setSegmentDest(_voiceId, 3, dest);                                                          // update decay2 segment destination (no split behavior)
 
     /* start envelopes */
@@ -602,15 +723,15 @@ void paramengine::newEnvUpdateStop(const uint32_t _voiceId, const float _pitch,
     envId = 0;                                                                                                          // setting the focus on envelope a
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
 
-    timeKT = -m_body[m_head[envIndex + E_TKT].m_index].m_signal * _pitch;                                               // determine time key tracking according to pitch and parameter
-    releaseVel = -m_body[m_head[envIndex + E_RV].m_index].m_signal * _velocity;                                         // determine release velocity according to velocity and parameter
+    timeKT = -m_body.m_signal[m_head[envIndex + E_TKT].m_index] * _pitch;                                               // determine time key tracking according to pitch and parameter
+    releaseVel = -m_body.m_signal[m_head[envIndex + E_RV].m_index] * _velocity;                                         // determine release velocity according to velocity and parameter
 
     m_event.m_env[envId].m_timeFactor[_voiceId][3] = m_convert.eval_level(timeKT + releaseVel) * m_millisecond;         // determine time factor for release segment (without actual release time)
 
-    if(m_body[m_head[envIndex + E_REL].m_index].m_signal <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
+    if(m_body.m_signal[m_head[envIndex + E_REL].m_index] <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
     {
         /* finite release time */
-        time = m_body[m_head[envIndex + E_REL].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
+        time = m_body.m_signal[m_head[envIndex + E_REL].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
         m_new_envelopes.m_env_a.setSegmentDx(_voiceId, 4, 1.f / (time + 1.f));                                          //      update release segment time
     }
     else                                                                                                                // if the release time is meant to be infinite (tcd: [16001 ... 16160]):
@@ -624,15 +745,15 @@ void paramengine::newEnvUpdateStop(const uint32_t _voiceId, const float _pitch,
     envId = 1;                                                                                                          // setting the focus on envelope b
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
 
-    timeKT = -m_body[m_head[envIndex + E_TKT].m_index].m_signal * _pitch;                                               // determine time key tracking according to pitch and parameter
-    releaseVel = -m_body[m_head[envIndex + E_RV].m_index].m_signal * _velocity;                                         // determine release velocity according to velocity and parameter
+    timeKT = -m_body.m_signal[m_head[envIndex + E_TKT].m_index] * _pitch;                                               // determine time key tracking according to pitch and parameter
+    releaseVel = -m_body.m_signal[m_head[envIndex + E_RV].m_index] * _velocity;                                         // determine release velocity according to velocity and parameter
 
     m_event.m_env[envId].m_timeFactor[_voiceId][3] = m_convert.eval_level(timeKT + releaseVel) * m_millisecond;         // determine time factor for release segment (without actual release time)
 
-    if(m_body[m_head[envIndex + E_REL].m_index].m_signal <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
+    if(m_body.m_signal[m_head[envIndex + E_REL].m_index] <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
     {
         /* finite release time */
-        time = m_body[m_head[envIndex + E_REL].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
+        time = m_body.m_signal[m_head[envIndex + E_REL].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
         m_new_envelopes.m_env_b.setSegmentDx(_voiceId, 4, 1.f / (time + 1.f));                                          //      update release segment time
     }
     else                                                                                                                // if the release time is meant to be infinite (tcd: [16001 ... 16160]):
@@ -646,15 +767,15 @@ void paramengine::newEnvUpdateStop(const uint32_t _voiceId, const float _pitch,
     envId = 2;                                                                                                          // setting the focus on envelope c
     envIndex = m_envIds[envId];                                                                                         // update indexy accordingly
 
-    timeKT = -m_body[m_head[envIndex + E_TKT].m_index].m_signal * _pitch;                                               // determine time key tracking according to pitch and parameter
-    releaseVel = -m_body[m_head[envIndex + E_RV].m_index].m_signal * _velocity;                                         // determine release velocity according to velocity and parameter
+    timeKT = -m_body.m_signal[m_head[envIndex + E_TKT].m_index] * _pitch;                                               // determine time key tracking according to pitch and parameter
+    releaseVel = -m_body.m_signal[m_head[envIndex + E_RV].m_index] * _velocity;                                         // determine release velocity according to velocity and parameter
 
     m_event.m_env[envId].m_timeFactor[_voiceId][3] = m_convert.eval_level(timeKT + releaseVel) * m_millisecond;         // determine time factor for release segment (without actual release time)
 
-    if(m_body[m_head[envIndex + E_REL].m_index].m_signal <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
+    if(m_body.m_signal[m_head[envIndex + E_REL].m_index] <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
     {
         /* finite release time */
-        time = m_body[m_head[envIndex + E_REL].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
+        time = m_body.m_signal[m_head[envIndex + E_REL].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
         m_new_envelopes.m_env_c.setSegmentDx(_voiceId, 4, 1.f / (time + 1.f));                                          //      update release segment time
     }
     else                                                                                                                // if the release time is meant to be infinite (tcd: [16001 ... 16160]):
@@ -684,19 +805,19 @@ void paramengine::newEnvUpdateTimes(const uint32_t _voiceId)
     envId = 0;                                                                                                          // setting the focus on envelope a
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
 
-    time = m_body[m_head[envIndex + E_ATT].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_ATT].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
     m_new_envelopes.m_env_a.setSegmentDx(_voiceId, 1, 1.f / (time + 1.f));                                              // update attack segment time
 
-    time = m_body[m_head[envIndex + E_DEC1].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC1].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
     m_new_envelopes.m_env_a.setSegmentDx(_voiceId, 2, 1.f / (time + 1.f));                                              // update decay1 segment time
 
-    time = m_body[m_head[envIndex + E_DEC2].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC2].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
     m_new_envelopes.m_env_a.setSegmentDx(_voiceId, 3, 1.f / (time + 1.f));                                              // update decay2 segment time
 
-    if(m_body[m_head[envIndex + E_REL].m_index].m_signal <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
+    if(m_body.m_signal[m_head[envIndex + E_REL].m_index] <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
     {
         /* finite release time */
-        time = m_body[m_head[envIndex + E_REL].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
+        time = m_body.m_signal[m_head[envIndex + E_REL].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
         m_new_envelopes.m_env_a.setSegmentDx(_voiceId, 4, 1.f / (time + 1.f));                                          //      update release segment time
     }
     else                                                                                                                // if the release time is meant to be infinite (tcd: [16001 ... 16160])
@@ -710,19 +831,19 @@ void paramengine::newEnvUpdateTimes(const uint32_t _voiceId)
     envId = 1;                                                                                                          // setting the focus on envelope b
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
 
-    time = m_body[m_head[envIndex + E_ATT].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_ATT].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
     m_new_envelopes.m_env_b.setSegmentDx(_voiceId, 1, 1.f / (time + 1.f));                                              // update attack segment time
 
-    time = m_body[m_head[envIndex + E_DEC1].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC1].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
     m_new_envelopes.m_env_b.setSegmentDx(_voiceId, 2, 1.f / (time + 1.f));                                              // update decay1 segment time
 
-    time = m_body[m_head[envIndex + E_DEC2].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC2].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
     m_new_envelopes.m_env_b.setSegmentDx(_voiceId, 3, 1.f / (time + 1.f));                                              // update decay2 segment time
 
-    if(m_body[m_head[envIndex + E_REL].m_index].m_signal <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
+    if(m_body.m_signal[m_head[envIndex + E_REL].m_index] <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
     {
         /* finite release time */
-        time = m_body[m_head[envIndex + E_REL].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
+        time = m_body.m_signal[m_head[envIndex + E_REL].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
         m_new_envelopes.m_env_b.setSegmentDx(_voiceId, 4, 1.f / (time + 1.f));                                          //      update release segment time
     }
     else                                                                                                                // if the release time is meant to be infinite (tcd: [16001 ... 16160])
@@ -736,19 +857,19 @@ void paramengine::newEnvUpdateTimes(const uint32_t _voiceId)
     envId = 2;                                                                                                          // setting the focus on envelope c
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
 
-    time = m_body[m_head[envIndex + E_ATT].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_ATT].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][0];          // determine attack segment time according to time factor and parameter
     m_new_envelopes.m_env_c.setSegmentDx(_voiceId, 1, 1.f / (time + 1.f));                                              // update attack segment time
 
-    time = m_body[m_head[envIndex + E_DEC1].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC1].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][1];         // determine decay1 segment time according to time factor and parameter
     m_new_envelopes.m_env_c.setSegmentDx(_voiceId, 2, 1.f / (time + 1.f));                                              // update decay1 segment time
 
-    time = m_body[m_head[envIndex + E_DEC2].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
+    time = m_body.m_signal[m_head[envIndex + E_DEC2].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][2];         // determine decay2 segment time according to time factor and parameter
     m_new_envelopes.m_env_c.setSegmentDx(_voiceId, 3, 1.f / (time + 1.f));                                              // update decay2 segment time
 
-    if(m_body[m_head[envIndex + E_REL].m_index].m_signal <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
+    if(m_body.m_signal[m_head[envIndex + E_REL].m_index] <= env_highest_finite_time)                                    // if the release time is meant to be finite (tcd: [0 ... 16000]):
     {
         /* finite release time */
-        time = m_body[m_head[envIndex + E_REL].m_index].m_signal * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
+        time = m_body.m_signal[m_head[envIndex + E_REL].m_index] * m_event.m_env[envId].m_timeFactor[_voiceId][3];      //      determine release segment time according to time factor and parameter
         m_new_envelopes.m_env_c.setSegmentDx(_voiceId, 4, 1.f / (time + 1.f));                                          //      update release segment time
     }
     else                                                                                                                // if the release time is meant to be infinite (tcd: [16001 ... 16160])
@@ -772,10 +893,10 @@ void paramengine::newEnvUpdateLevels(const uint32_t _voiceId)
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
     peak = m_event.m_env[envId].m_levelFactor[_voiceId];                                                                // get envelope peak level (was determined by last key down)
 
-    dest = peak * m_body[m_head[envIndex + E_BP].m_index].m_signal;                                                     // determine decay1 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_BP].m_index];                                                     // determine decay1 segment destination according to peak level and parameter
     m_new_envelopes.m_env_a.setSegmentDest(_voiceId, 2, true, dest);                                                    // update decay1 segment destination (split behavior)
 
-    dest = peak * m_body[m_head[envIndex + E_SUS].m_index].m_signal;                                                    // determine decay2 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_SUS].m_index];                                                    // determine decay2 segment destination according to peak level and parameter
     m_new_envelopes.m_env_a.setSegmentDest(_voiceId, 3, true, dest);                                                    // update decay2 segment destinatino (split behavior)
 
     /* envelope b update */
@@ -784,10 +905,10 @@ void paramengine::newEnvUpdateLevels(const uint32_t _voiceId)
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
     peak = m_event.m_env[envId].m_levelFactor[_voiceId];                                                                // get envelope peak level (was determined by last key down)
 
-    dest = peak * m_body[m_head[envIndex + E_BP].m_index].m_signal;                                                     // determine decay1 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_BP].m_index];                                                     // determine decay1 segment destination according to peak level and parameter
     m_new_envelopes.m_env_b.setSegmentDest(_voiceId, 2, true, dest);                                                    // update decay1 segment destination (split behavior)
 
-    dest = peak * m_body[m_head[envIndex + E_SUS].m_index].m_signal;                                                    // determine decay2 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_SUS].m_index];                                                    // determine decay2 segment destination according to peak level and parameter
     m_new_envelopes.m_env_b.setSegmentDest(_voiceId, 3, true, dest);                                                    // update decay2 segment destinatino (split behavior)
 
     /* envelope c update */
@@ -796,39 +917,24 @@ void paramengine::newEnvUpdateLevels(const uint32_t _voiceId)
     envIndex = m_envIds[envId];                                                                                         // update index accordingly
     peak = m_event.m_env[envId].m_levelFactor[_voiceId];                                                                // get envelope peak level (was determined by last key down)
 
-    dest = peak * m_body[m_head[envIndex + E_BP].m_index].m_signal;                                                     // determine decay1 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_BP].m_index];                                                     // determine decay1 segment destination according to peak level and parameter
     m_new_envelopes.m_env_c.setSegmentDest(_voiceId, 2, dest);                                                          // update decay1 segment destination (no split behavior)
 
-    dest = peak * m_body[m_head[envIndex + E_SUS].m_index].m_signal;                                                    // determine decay2 segment destination according to peak level and parameter
+    dest = peak * m_body.m_signal[m_head[envIndex + E_SUS].m_index];                                                    // determine decay2 segment destination according to peak level and parameter
     m_new_envelopes.m_env_c.setSegmentDest(_voiceId, 3, dest);                                                          // update decay2 segment destinatino (no split behavior)
 }
 #endif
 
 /* Poly Post Processing - slow parameters */
-void paramengine::postProcessPoly_slow(float *_signal, const uint32_t _voiceId)
+void paramengine::postProcessPoly_slow(voice_signal _signal, const uint32_t _voiceId)
 {
-    /* provide indices for distributions */
-    uint32_t i, p;
-    /* automatic mono to poly distribution */
-    for(i = 0; i < m_postIds.m_data[1].m_data[3].m_data[0].m_length; i++)
-    {
-        /* spread values of mono parameters to all voices of shared signal array */
-        p = m_head[m_postIds.m_data[1].m_data[3].m_data[0].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[1].m_data[3].m_data[0].m_data[i]].m_index].m_signal;
-    }
-    /* automatic poly to poly copy - each voice */
-    for(i = 0; i < m_postIds.m_data[0].m_data[3].m_data[1].m_length; i++)
-    {
-        p = m_head[m_postIds.m_data[0].m_data[3].m_data[1].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[3].m_data[1].m_data[i]].m_index + _voiceId].m_signal;
-    }
     /* automatic mono to mono copy (effect parameters) - only for voice 0 */
     //if(_voiceId == 0)
     //{
         //for(i = 0; i < m_postIds.m_data[0].m_data[3].m_data[0].m_length; i++)
         //{
             //p = m_head[m_postIds.m_data[0].m_data[3].m_data[0].m_data[i]].m_postId;
-            //_signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[3].m_data[0].m_data[i]].m_index].m_signal;
+            //_signal[p] = m_body.m_signal[m_head[m_postIds.m_data[0].m_data[3].m_data[0].m_data[i]].m_index];
         //}
     //}
 #if dsp_take_envelope == 0
@@ -847,100 +953,95 @@ void paramengine::postProcessPoly_slow(float *_signal, const uint32_t _voiceId)
     newEnvUpdateTimes(_voiceId);
 #endif
     /* Pitch Updates */
-    const float basePitch = m_body[m_head[P_KEY_NP].m_index + _voiceId].m_signal + m_body[m_head[P_MA_T].m_index].m_signal;
+    const float basePitch = m_body.m_signal[m_head[P_KEY_NP].m_index + _voiceId] + m_body.m_signal[m_head[P_MA_T].m_index];
     float keyTracking, unitPitch, envMod, unitSign, unitSpread, unitMod;
+    /* - linear pitches of all units (Base Pitch, Master Tune, Key Tracking, Envelope C), converted into frequency factors in one pass */
+    float pitch[7];
+    keyTracking = m_body.m_signal[m_head[P_OA_PKT].m_index];
+    envMod = _signal[ENV_C_SIG] * m_body.m_signal[m_head[P_OA_PEC].m_index];
+    pitch[0] = 69.f + (basePitch * keyTracking) + envMod;                           // Oscillator A
+    keyTracking = m_body.m_signal[m_head[P_OB_PKT].m_index];
+    envMod = _signal[ENV_C_SIG] * m_body.m_signal[m_head[P_OB_PEC].m_index];
+    pitch[1] = 69.f + (basePitch * keyTracking) + envMod;                           // Oscillator B
+    keyTracking = m_body.m_signal[m_head[P_CMB_PKT].m_index];
+    pitch[2] = 69.f + (basePitch * keyTracking);                                    // Comb Filter
+    keyTracking = m_body.m_signal[m_head[P_CMB_APKT].m_index];
+    envMod = _signal[ENV_C_SIG] * m_body.m_signal[m_head[P_CMB_APEC].m_index];
+    pitch[3] = 69.f + (basePitch * keyTracking) + envMod;                           // Comb Filter Allpass
+    keyTracking = m_body.m_signal[m_head[P_CMB_LPKT].m_index];
+    envMod = _signal[ENV_C_SIG] * m_body.m_signal[m_head[P_CMB_LPEC].m_index];
+    pitch[4] = 69.f + (basePitch * keyTracking) + envMod;                           // Comb Filter Lowpass
+    keyTracking = m_body.m_signal[m_head[P_SVF_CKT].m_index];                       // get Key Tracking
+    envMod = _signal[ENV_C_SIG] * m_body.m_signal[m_head[P_SVF_CEC].m_index];       // get Envelope C Modulation (amount * envelope_c_signal)
+    unitSpread = m_body.m_signal[m_head[P_SVF_SPR].m_index];                        // get the Spread parameter (already scaled to 50%)
+    pitch[5] = 69.f + (basePitch * keyTracking) + envMod + unitSpread;              // State Variable Filter (upper 2PF)
+    pitch[6] = 69.f + (basePitch * keyTracking) + envMod - unitSpread;              // State Variable Filter (lower 2PF)
+    m_convert.eval_lin_pitch(pitch, pitch, 7);
     /* Oscillator A */
     /* - Oscillator A Frequency in Hz (Base Pitch, Master Tune, Key Tracking, Osc Pitch, Envelope C) */
-    keyTracking = m_body[m_head[P_OA_PKT].m_index].m_signal;
-    unitPitch = m_body[m_head[P_OA_P].m_index].m_signal;
-    envMod = _signal[ENV_C_SIG] * m_body[m_head[P_OA_PEC].m_index].m_signal;
-    _signal[OSC_A_FRQ] = evalNyquist(m_pitch_reference * unitPitch * m_convert.eval_lin_pitch(69.f + (basePitch * keyTracking) + envMod));
+    unitPitch = m_body.m_signal[m_head[P_OA_P].m_index];
+    _signal[OSC_A_FRQ] = evalNyquist(m_pitch_reference * unitPitch * pitch[0]);
     /* - Oscillator A Fluctuation (Envelope C) */
-    envMod = m_body[m_head[P_OA_FEC].m_index].m_signal;
-    _signal[OSC_A_FLUEC] = m_body[m_head[P_OA_F].m_index].m_signal * NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_C_SIG], envMod);
+    envMod = m_body.m_signal[m_head[P_OA_FEC].m_index];
+    _signal[OSC_A_FLUEC] = m_body.m_signal[m_head[P_OA_F].m_index] * NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_C_SIG], envMod);
     /* - Oscillator A Chirp Frequency in Hz */
-    _signal[OSC_A_CHI] = evalNyquist(m_body[m_head[P_OA_CHI].m_index].m_signal * 440.f);
+    _signal[OSC_A_CHI] = evalNyquist(m_body.m_signal[m_head[P_OA_CHI].m_index] * 440.f);
     /* Oscillator B */
     /* - Oscillator B Frequency in Hz (Base Pitch, Master Tune, Key Tracking, Osc Pitch, Envelope C) */
-    keyTracking = m_body[m_head[P_OB_PKT].m_index].m_signal;
-    unitPitch = m_body[m_head[P_OB_P].m_index].m_signal;
-    envMod = _signal[ENV_C_SIG] * m_body[m_head[P_OB_PEC].m_index].m_signal;
-    _signal[OSC_B_FRQ] = evalNyquist(m_pitch_reference * unitPitch * m_convert.eval_lin_pitch(69.f + (basePitch * keyTracking) + envMod));
+    unitPitch = m_body.m_signal[m_head[P_OB_P].m_index];
+    _signal[OSC_B_FRQ] = evalNyquist(m_pitch_reference * unitPitch * pitch[1]);
     /* - Oscillator B Fluctuation (Envelope C) */
-    envMod = m_body[m_head[P_OB_FEC].m_index].m_signal;
-    _signal[OSC_B_FLUEC] = m_body[m_head[P_OB_F].m_index].m_signal * NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_C_SIG], envMod);
+    envMod = m_body.m_signal[m_head[P_OB_FEC].m_index];
+    _signal[OSC_B_FLUEC] = m_body.m_signal[m_head[P_OB_F].m_index] * NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_C_SIG], envMod);
     /* - Oscillator B Chirp Frequency in Hz */
-    _signal[OSC_B_CHI] = evalNyquist(m_body[m_head[P_OB_CHI].m_index].m_signal * 440.f);
+    _signal[OSC_B_CHI] = evalNyquist(m_body.m_signal[m_head[P_OB_CHI].m_index] * 440.f);
     /* Comb Filter */
     /* - Comb Filter Pitch as Frequency in Hz (Base Pitch, Master Tune, Key Tracking, Comb Pitch) */
-    keyTracking = m_body[m_head[P_CMB_PKT].m_index].m_signal;
-    unitPitch = m_body[m_head[P_CMB_P].m_index].m_signal;
+    unitPitch = m_body.m_signal[m_head[P_CMB_P].m_index];
     // as a tonal component, the reference tone frequency is applied (instead of const 440 Hz)
-    _signal[CMB_FRQ] = evalNyquist(m_pitch_reference * unitPitch * m_convert.eval_lin_pitch(69.f + (basePitch * keyTracking)));
+    _signal[CMB_FRQ] = evalNyquist(m_pitch_reference * unitPitch * pitch[2]);
     /* - Comb Filter Bypass (according to Pitch parameter - without key tracking or reference freq) */
     _signal[CMB_BYP] = unitPitch > dsp_comb_max_freqFactor ? 1.f : 0.f; // check for bypassing comb filter, max_freqFactor corresponds to Pitch of 119.99 ST
     /* - Comb Filter Decay Time (Base Pitch, Master Tune, Gate Env, Dec Time, Key Tracking, Gate Amount) */
-    keyTracking = m_body[m_head[P_CMB_DKT].m_index].m_signal;
-    envMod = 1.f - ((1.f - _signal[ENV_G_SIG]) * m_combDecayCurve.applyCurve(m_body[m_head[P_CMB_DG].m_index].m_signal));
-    unitPitch = (-0.5 * basePitch * keyTracking) + (fabs(m_body[m_head[P_CMB_D].m_index].m_signal) * envMod);
-    unitSign = m_body[m_head[P_CMB_D].m_index].m_signal < 0 ? -1.f : 1.f;
+    keyTracking = m_body.m_signal[m_head[P_CMB_DKT].m_index];
+    envMod = 1.f - ((1.f - _signal[ENV_G_SIG]) * m_combDecayCurve.applyCurve(m_body.m_signal[m_head[P_CMB_DG].m_index]));
+    unitPitch = (-0.5 * basePitch * keyTracking) + (fabs(m_body.m_signal[m_head[P_CMB_D].m_index]) * envMod);
+    unitSign = m_body.m_signal[m_head[P_CMB_D].m_index] < 0 ? -1.f : 1.f;
     _signal[CMB_DEC] = 0.001 * m_convert.eval_level(unitPitch) * unitSign;
     /* - Comb Filter Allpass Frequency (Base Pitch, Master Tune, Key Tracking, AP Tune, Env C) */
-    keyTracking = m_body[m_head[P_CMB_APKT].m_index].m_signal;
-    unitPitch = m_body[m_head[P_CMB_APT].m_index].m_signal;
-    envMod = _signal[ENV_C_SIG] * m_body[m_head[P_CMB_APEC].m_index].m_signal;
-    _signal[CMB_APF] = evalNyquist(440.f * unitPitch * m_convert.eval_lin_pitch(69 + (basePitch * keyTracking) + envMod));      // not sure if APF needs Nyquist Clipping?
-    //_signal[CMB_APF] = 440.f * unitPitch * m_convert.eval_lin_pitch(69.f + (basePitch * keyTracking) + envMod);                   // currently APF without Nyquist Clipping
+    unitPitch = m_body.m_signal[m_head[P_CMB_APT].m_index];
+    _signal[CMB_APF] = evalNyquist(440.f * unitPitch * pitch[3]);                   // not sure if APF needs Nyquist Clipping?
+    //_signal[CMB_APF] = 440.f * unitPitch * pitch[3];                              // currently APF without Nyquist Clipping
     /* - Comb Filter Lowpass ('Hi Cut') Frequency (Base Pitch, Master Tune, Key Tracking, Hi Cut, Env C) */
-    keyTracking = m_body[m_head[P_CMB_LPKT].m_index].m_signal;
-    unitPitch = m_body[m_head[P_CMB_LP].m_index].m_signal;
-    envMod = _signal[ENV_C_SIG] * m_body[m_head[P_CMB_LPEC].m_index].m_signal;
-    _signal[CMB_LPF] = evalNyquist(440.f * unitPitch * m_convert.eval_lin_pitch(69 + (basePitch * keyTracking) + envMod));      // not sure if LPF needs Nyquist Clipping?
-    //_signal[CMB_LPF] = 440.f * unitPitch * m_convert.eval_lin_pitch(69.f + (basePitch * keyTracking) + envMod);                   // currently LPF without Nyquist Clipping
+    unitPitch = m_body.m_signal[m_head[P_CMB_LP].m_index];
+    _signal[CMB_LPF] = evalNyquist(440.f * unitPitch * pitch[4]);                   // not sure if LPF needs Nyquist Clipping?
+    //_signal[CMB_LPF] = 440.f * unitPitch * pitch[4];                              // currently LPF without Nyquist Clipping
     /* State Variable Filter */
     /* - Cutoff Frequencies */
-    keyTracking = m_body[m_head[P_SVF_CKT].m_index].m_signal;                       // get Key Tracking
-    envMod = _signal[ENV_C_SIG] * m_body[m_head[P_SVF_CEC].m_index].m_signal;       // get Envelope C Modulation (amount * envelope_c_signal)
-    unitPitch = m_pitch_reference * m_body[m_head[P_SVF_CUT].m_index].m_signal;     // as a tonal component, the Reference Tone frequency is applied (instead of const 440 Hz)
-    unitSpread = m_body[m_head[P_SVF_SPR].m_index].m_signal;                        // get the Spread parameter (already scaled to 50%)
-    unitMod = m_body[m_head[P_SVF_FM].m_index].m_signal;                            // get the FM parameter
+    unitPitch = m_pitch_reference * m_body.m_signal[m_head[P_SVF_CUT].m_index];     // as a tonal component, the Reference Tone frequency is applied (instead of const 440 Hz)
+    unitMod = m_body.m_signal[m_head[P_SVF_FM].m_index];                            // get the FM parameter
     // now, calculate the actual filter frequencies and put them in the shared signal array
-    _signal[SVF_F1_CUT] = evalNyquist(unitPitch * m_convert.eval_lin_pitch(69.f + (basePitch * keyTracking) + envMod + unitSpread));    // SVF upper 2PF Cutoff Frequency
-    _signal[SVF_F2_CUT] = evalNyquist(unitPitch * m_convert.eval_lin_pitch(69.f + (basePitch * keyTracking) + envMod - unitSpread));    // SVF lower 2PF Cutoff Frequency
+    _signal[SVF_F1_CUT] = evalNyquist(unitPitch * pitch[5]);                                                                            // SVF upper 2PF Cutoff Frequency
+    _signal[SVF_F2_CUT] = evalNyquist(unitPitch * pitch[6]);                                                                            // SVF lower 2PF Cutoff Frequency
     _signal[SVF_F1_FM] = _signal[SVF_F1_CUT] * unitMod;                                                                                 // SVF upper 2PF FM Amount (Frequency)
     _signal[SVF_F2_FM] = _signal[SVF_F2_CUT] * unitMod;                                                                                 // SVF lower 2PF FM Amount (Frequency)
     /* - Resonance */
-    keyTracking = m_body[m_head[P_SVF_RKT].m_index].m_signal * m_svfResFactor;
-    envMod = _signal[ENV_C_SIG] * m_body[m_head[P_SVF_REC].m_index].m_signal;
-    unitPitch = m_body[m_head[P_SVF_RES].m_index].m_signal + envMod + (basePitch * keyTracking);
+    keyTracking = m_body.m_signal[m_head[P_SVF_RKT].m_index] * m_svfResFactor;
+    envMod = _signal[ENV_C_SIG] * m_body.m_signal[m_head[P_SVF_REC].m_index];
+    unitPitch = m_body.m_signal[m_head[P_SVF_RES].m_index] + envMod + (basePitch * keyTracking);
     _signal[SVF_RES] = m_svfResonanceCurve.applyCurve(NlToolbox::Clipping::uniNorm(unitPitch));
 }
 
 /* Poly Post Processing - fast parameters */
-void paramengine::postProcessPoly_fast(float *_signal, const uint32_t _voiceId)
+void paramengine::postProcessPoly_fast(voice_signal _signal, const uint32_t _voiceId)
 {
-    /* provide indices for distributions */
-    uint32_t i, p;
-    /* automatic mono to poly distribution */
-    for(i = 0; i < m_postIds.m_data[1].m_data[2].m_data[0].m_length; i++)
-    {
-        /* spread values of mono parameters to all voices of shared signal array */
-        p = m_head[m_postIds.m_data[1].m_data[2].m_data[0].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[1].m_data[2].m_data[0].m_data[i]].m_index].m_signal;
-    }
-    /* automatic poly to poly copy - each voice */
-    for(i = 0; i < m_postIds.m_data[0].m_data[2].m_data[1].m_length; i++)
-    {
-        p = m_head[m_postIds.m_data[0].m_data[2].m_data[1].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[2].m_data[1].m_data[i]].m_index + _voiceId].m_signal;
-    }
     /* automatic mono to mono copy (effect parameters) - only for voice 0 */
     //if(_voiceId == 0)
     //{
         //for(i = 0; i < m_postIds.m_data[0].m_data[2].m_data[0].m_length; i++)
         //{
             //p = m_head[m_postIds.m_data[0].m_data[2].m_data[0].m_data[i]].m_postId;
-            //_signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[2].m_data[0].m_data[i]].m_index].m_signal;
+            //_signal[p] = m_body.m_signal[m_head[m_postIds.m_data[0].m_data[2].m_data[0].m_data[i]].m_index];
         //}
     //}
 #if dsp_take_envelope == 0
@@ -961,65 +1062,68 @@ void paramengine::postProcessPoly_fast(float *_signal, const uint32_t _voiceId)
     float tmp_lvl, tmp_pan, tmp_abs;
     /* State Variable Filter */
     /* - LBH */
-    tmp_lvl = m_body[m_head[P_SVF_LBH].m_index].m_signal;
+    tmp_lvl = m_body.m_signal[m_head[P_SVF_LBH].m_index];
     _signal[SVF_LBH_1] = m_svfLBH1Curve.applyCurve(tmp_lvl);
     _signal[SVF_LBH_2] = m_svfLBH2Curve.applyCurve(tmp_lvl);
     /* - Parallel */
-    tmp_lvl = m_body[m_head[P_SVF_PAR].m_index].m_signal;
+    tmp_lvl = m_body.m_signal[m_head[P_SVF_PAR].m_index];
     tmp_abs = fabs(tmp_lvl);
     _signal[SVF_PAR_1] = 0.7f * tmp_abs;
     _signal[SVF_PAR_2] = (0.7f * tmp_lvl) + (1.f - tmp_abs);
     _signal[SVF_PAR_3] = 1.f - tmp_abs;
     _signal[SVF_PAR_4] = tmp_abs;
     /* Output Mixer */
-    const float key_pan = m_body[m_head[P_KEY_VP].m_index + _voiceId].m_signal;
+    const float key_pan = m_body.m_signal[m_head[P_KEY_VP].m_index + _voiceId];
     /* - Branch A */
-    tmp_lvl = m_body[m_head[P_OM_AL].m_index].m_signal;
-    tmp_pan = NlToolbox::Clipping::uniNorm(m_body[m_head[P_OM_AP].m_index].m_signal + key_pan);
+    tmp_lvl = m_body.m_signal[m_head[P_OM_AL].m_index];
+    tmp_pan = NlToolbox::Clipping::uniNorm(m_body.m_signal[m_head[P_OM_AP].m_index] + key_pan);
     _signal[OUT_A_L] = tmp_lvl * (1.f - tmp_pan);
     _signal[OUT_A_R] = tmp_lvl * tmp_pan;
     /* - Branch B */
-    tmp_lvl = m_body[m_head[P_OM_BL].m_index].m_signal;
-    tmp_pan = NlToolbox::Clipping::uniNorm(m_body[m_head[P_OM_BP].m_index].m_signal + key_pan);
+    tmp_lvl = m_body.m_signal[m_head[P_OM_BL].m_index];
+    tmp_pan = NlToolbox::Clipping::uniNorm(m_body.m_signal[m_head[P_OM_BP].m_index] + key_pan);
     _signal[OUT_B_L] = tmp_lvl * (1.f - tmp_pan);
     _signal[OUT_B_R] = tmp_lvl * tmp_pan;
     /* - Comb Filter */
-    tmp_lvl = m_body[m_head[P_OM_CL].m_index].m_signal;
-    tmp_pan = NlToolbox::Clipping::uniNorm(m_body[m_head[P_OM_CP].m_index].m_signal + key_pan);
+    tmp_lvl = m_body.m_signal[m_head[P_OM_CL].m_index];
+    tmp_pan = NlToolbox::Clipping::uniNorm(m_body.m_signal[m_head[P_OM_CP].m_index] + key_pan);
     _signal[OUT_CMB_L] = tmp_lvl * (1.f - tmp_pan);
     _signal[OUT_CMB_R] = tmp_lvl * tmp_pan;
     /* - State Variable Filter */
-    tmp_lvl = m_body[m_head[P_OM_SL].m_index].m_signal;
-    tmp_pan = NlToolbox::Clipping::uniNorm(m_body[m_head[P_OM_SP].m_index].m_signal + key_pan);
+    tmp_lvl = m_body.m_signal[m_head[P_OM_SL].m_index];
+    tmp_pan = NlToolbox::Clipping::uniNorm(m_body.m_signal[m_head[P_OM_SP].m_index] + key_pan);
     _signal[OUT_SVF_L] = tmp_lvl * (1.f - tmp_pan);
     _signal[OUT_SVF_R] = tmp_lvl * tmp_pan;
 }
 
-/* Poly Post Processing - audio parameters */
-void paramengine::postProcessPoly_audio(float *_signal, const uint32_t _voiceId)
+/* Poly Envelope Rendering - all voices of the mask (before their audio post processing) */
+void paramengine::tickPolyEnvelopes(const uint32_t _voiceMask)
 {
-    /* provide indices for distributions */
-    uint32_t i, p;
-    /* automatic mono to poly distribution */
-    for(i = 0; i < m_postIds.m_data[1].m_data[1].m_data[0].m_length; i++)
-    {
-        /* spread values of mono parameters to all voices of shared signal array */
-        p = m_head[m_postIds.m_data[1].m_data[1].m_data[0].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[1].m_data[1].m_data[0].m_data[i]].m_index].m_signal;
-    }
-    /* automatic poly to poly copy - each voice */
-    for(i = 0; i < m_postIds.m_data[0].m_data[1].m_data[1].m_length; i++)
+#if dsp_take_envelope == 0
+    /* "OLD" ENVELOPES: */
+    for(uint32_t v = 0; v < dsp_number_of_voices; v++)
     {
-        p = m_head[m_postIds.m_data[0].m_data[1].m_data[1].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[1].m_data[1].m_data[i]].m_index + _voiceId].m_signal;
+        if(_voiceMask & (1u << v))
+        {
+            m_envelopes.tickPoly(v);
+        }
     }
+#elif dsp_take_envelope == 1
+    /* "NEW" ENVELOPES: voice parallel */
+    m_new_envelopes.tickPolyAll(_voiceMask);
+#endif
+}
+
+/* Poly Post Processing - audio parameters */
+void paramengine::postProcessPoly_audio(voice_signal _signal, const uint32_t _voiceId)
+{
     /* automatic mono to mono copy (effect parameters) and mono envelope ticking - only for voice 0 */
     //if(_voiceId == 0)
     //{
         //for(i = 0; i < m_postIds.m_data[0].m_data[1].m_data[0].m_length; i++)
         //{
             //p = m_head[m_postIds.m_data[0].m_data[1].m_data[0].m_data[i]].m_postId;
-            //_signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[1].m_data[0].m_data[i]].m_index].m_signal;
+            //_signal[p] = m_body.m_signal[m_head[m_postIds.m_data[0].m_data[1].m_data[0].m_data[i]].m_index];
         //}
 #if dsp_take_envelope == 0
         /* "OLD" ENVELOPES: */
@@ -1031,79 +1135,75 @@ void paramengine::postProcessPoly_audio(float *_signal, const uint32_t _voiceId)
     //}
 #if dsp_take_envelope == 0
     /* "OLD" ENVELOPES: */
-    /* poly envelope ticking */
-    m_envelopes.tickPoly(_voiceId);
-    /* poly envelope distribution */
-    _signal[ENV_A_MAG] = m_envelopes.m_body[m_envelopes.m_head[0].m_index + _voiceId].m_signal * m_body[m_head[P_EA_GAIN].m_index].m_signal;        // Envelope A Magnitude post Gain
+    /* poly envelope distribution (ticked by tickPolyEnvelopes()) */
+    _signal[ENV_A_MAG] = m_envelopes.m_body[m_envelopes.m_head[0].m_index + _voiceId].m_signal * m_body.m_signal[m_head[P_EA_GAIN].m_index];        // Envelope A Magnitude post Gain
     _signal[ENV_A_TMB] = _signal[ENV_A_MAG];                                                                                                        // Envelope A Timbre (== Magnitude)
-    _signal[ENV_B_MAG] = m_envelopes.m_body[m_envelopes.m_head[1].m_index + _voiceId].m_signal * m_body[m_head[P_EB_GAIN].m_index].m_signal;        // Envelope B Magnitude post Gain
+    _signal[ENV_B_MAG] = m_envelopes.m_body[m_envelopes.m_head[1].m_index + _voiceId].m_signal * m_body.m_signal[m_head[P_EB_GAIN].m_index];        // Envelope B Magnitude post Gain
     _signal[ENV_B_TMB] = _signal[ENV_B_MAG];                                                                                                        // Envelope B Timbre (== Magnitude)
     _signal[ENV_C_SIG] = m_envelopes.m_body[m_envelopes.m_head[2].m_index + _voiceId].m_signal;                                                     // Envelope C
     _signal[ENV_G_SIG] = m_envelopes.m_body[m_envelopes.m_head[3].m_index + _voiceId].m_signal;                                                     // Gate
 #elif dsp_take_envelope == 1
     /* "NEW" ENVELOPES: */
-    /* poly envelope ticking */
-    m_new_envelopes.tickPoly(_voiceId);
-    /* poly envelope distribution */
-    _signal[ENV_A_MAG] = m_new_envelopes.m_env_a.m_body[_voiceId].m_signal_magnitude * m_body[m_head[P_EA_GAIN].m_index].m_signal;        // Envelope A Magnitude post Gain
-    _signal[ENV_A_TMB] = m_new_envelopes.m_env_a.m_body[_voiceId].m_signal_timbre * m_body[m_head[P_EA_GAIN].m_index].m_signal;           // Envelope A Timbre post Gain
-    _signal[ENV_B_MAG] = m_new_envelopes.m_env_b.m_body[_voiceId].m_signal_magnitude * m_body[m_head[P_EB_GAIN].m_index].m_signal;        // Envelope B Magnitude post Gain
-    _signal[ENV_B_TMB] = m_new_envelopes.m_env_b.m_body[_voiceId].m_signal_timbre * m_body[m_head[P_EB_GAIN].m_index].m_signal;           // Envelope B Timbre post Gain
-    _signal[ENV_C_SIG] = m_new_envelopes.m_env_c.m_body[_voiceId].m_signal_magnitude;                                                     // Envelope C
-    _signal[ENV_G_SIG] = m_new_envelopes.m_env_g.m_body[_voiceId].m_signal_magnitude;                                                     // Gate
+    /* poly envelope distribution (ticked by tickPolyEnvelopes()) */
+    _signal[ENV_A_MAG] = m_new_envelopes.m_env_a.m_body.m_signal_magnitude[_voiceId] * m_body.m_signal[m_head[P_EA_GAIN].m_index];        // Envelope A Magnitude post Gain
+    _signal[ENV_A_TMB] = m_new_envelopes.m_env_a.m_body.m_signal_timbre[_voiceId] * m_body.m_signal[m_head[P_EA_GAIN].m_index];           // Envelope A Timbre post Gain
+    _signal[ENV_B_MAG] = m_new_envelopes.m_env_b.m_body.m_signal_magnitude[_voiceId] * m_body.m_signal[m_head[P_EB_GAIN].m_index];        // Envelope B Magnitude post Gain
+    _signal[ENV_B_TMB] = m_new_envelopes.m_env_b.m_body.m_signal_timbre[_voiceId] * m_body.m_signal[m_head[P_EB_GAIN].m_index];           // Envelope B Timbre post Gain
+    _signal[ENV_C_SIG] = m_new_envelopes.m_env_c.m_body.m_signal_magnitude[_voiceId];                                                     // Envelope C
+    _signal[ENV_G_SIG] = m_new_envelopes.m_env_g.m_body.m_signal_magnitude[_voiceId];                                                     // Gate
 #endif
     /* Oscillator parameter post processing */
     float tmp_amt, tmp_env;
     /* Oscillator A */
     /* - Oscillator A - PM Self */
-    tmp_amt = m_body[m_head[P_OA_PMS].m_index].m_signal;
-    tmp_env = m_body[m_head[P_OA_PMSEA].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_OA_PMS].m_index];
+    tmp_env = m_body.m_signal[m_head[P_OA_PMSEA].m_index];
     _signal[OSC_A_PMSEA] = NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_A_TMB], tmp_env) * tmp_amt;  // Osc A PM Self (Env A)
     /* - Oscillator A - PM B */
-    tmp_amt = m_body[m_head[P_OA_PMB].m_index].m_signal;
-    tmp_env = m_body[m_head[P_OA_PMBEB].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_OA_PMB].m_index];
+    tmp_env = m_body.m_signal[m_head[P_OA_PMBEB].m_index];
     _signal[OSC_A_PMBEB] = NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_B_TMB], tmp_env) * tmp_amt;  // Osc A PM B (Env B)
     /* - Oscillator A - PM FB */
-    tmp_amt = m_body[m_head[P_OA_PMF].m_index].m_signal;
-    tmp_env = m_body[m_head[P_OA_PMFEC].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_OA_PMF].m_index];
+    tmp_env = m_body.m_signal[m_head[P_OA_PMFEC].m_index];
     _signal[OSC_A_PMFEC] = NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_C_SIG], tmp_env) * tmp_amt;  // Osc A PM FB (Env C)
     /* Shaper A */
     /* - Shaper A Drive (Envelope A) */
-    tmp_amt = m_body[m_head[P_SA_D].m_index].m_signal;
-    tmp_env = m_body[m_head[P_SA_DEA].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_SA_D].m_index];
+    tmp_env = m_body.m_signal[m_head[P_SA_DEA].m_index];
     _signal[SHP_A_DRVEA] = (NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_A_TMB], tmp_env) * tmp_amt) + 0.18f;
     /* - Shaper A Feedback Mix (Envelope C) */
-    tmp_env = m_body[m_head[P_SA_FBEC].m_index].m_signal;
+    tmp_env = m_body.m_signal[m_head[P_SA_FBEC].m_index];
     _signal[SHP_A_FBEC] = NlToolbox::Crossfades::unipolarCrossFade(_signal[ENV_G_SIG], _signal[ENV_C_SIG], tmp_env);
     /* Oscillator B */
     /* - Oscillator B - PM Self */
-    tmp_amt = m_body[m_head[P_OB_PMS].m_index].m_signal;
-    tmp_env = m_body[m_head[P_OB_PMSEB].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_OB_PMS].m_index];
+    tmp_env = m_body.m_signal[m_head[P_OB_PMSEB].m_index];
     _signal[OSC_B_PMSEB] = NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_B_TMB], tmp_env) * tmp_amt;  // Osc B PM Self (Env B)
     /* - Oscillator B - PM A */
-    tmp_amt = m_body[m_head[P_OB_PMA].m_index].m_signal;
-    tmp_env = m_body[m_head[P_OB_PMAEA].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_OB_PMA].m_index];
+    tmp_env = m_body.m_signal[m_head[P_OB_PMAEA].m_index];
     _signal[OSC_B_PMAEA] = NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_A_TMB], tmp_env) * tmp_amt;  // Osc B PM A (Env A)
     /* - Oscillator B - PM FB */
-    tmp_amt = m_body[m_head[P_OB_PMF].m_index].m_signal;
-    tmp_env = m_body[m_head[P_OB_PMFEC].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_OB_PMF].m_index];
+    tmp_env = m_body.m_signal[m_head[P_OB_PMFEC].m_index];
     _signal[OSC_B_PMFEC] = NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_C_SIG], tmp_env) * tmp_amt;  // Osc B PM FB (Env C)
     /* Shaper B */
     /* - Shaper B Drive (Envelope B) */
-    tmp_amt = m_body[m_head[P_SB_D].m_index].m_signal;
-    tmp_env = m_body[m_head[P_SB_DEB].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_SB_D].m_index];
+    tmp_env = m_body.m_signal[m_head[P_SB_DEB].m_index];
     _signal[SHP_B_DRVEB] = (NlToolbox::Crossfades::unipolarCrossFade(1.f, _signal[ENV_B_TMB], tmp_env) * tmp_amt) + 0.18f;
     /* - Shaper B Feedback Mix (Envelope C) */
-    tmp_env = m_body[m_head[P_SB_FBEC].m_index].m_signal;
+    tmp_env = m_body.m_signal[m_head[P_SB_FBEC].m_index];
     _signal[SHP_B_FBEC] = NlToolbox::Crossfades::unipolarCrossFade(_signal[ENV_G_SIG], _signal[ENV_C_SIG], tmp_env);
     /* Comb Filter */
     /* - Comb Filter Pitch Envelope C, converted into Frequency Factor */
-    tmp_amt = m_body[m_head[P_CMB_PEC].m_index].m_signal;
+    tmp_amt = m_body.m_signal[m_head[P_CMB_PEC].m_index];
     _signal[CMB_FEC] = m_convert.eval_lin_pitch(69.f - (tmp_amt * _signal[ENV_C_SIG]));
 }
 
 /* Mono Post Processing - slow parameters */
-void paramengine::postProcessMono_slow(float *_signal)
+void paramengine::postProcessMono_slow(voice_signal _signal)
 {
     /* provide indices for distributions */
     uint32_t i, p;
@@ -1111,20 +1211,20 @@ void paramengine::postProcessMono_slow(float *_signal)
     for(i = 0; i < m_postIds.m_data[0].m_data[3].m_data[0].m_length; i++)
     {
         p = m_head[m_postIds.m_data[0].m_data[3].m_data[0].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[3].m_data[0].m_data[i]].m_index].m_signal;
+        _signal[p] = m_body.m_signal[m_head[m_postIds.m_data[0].m_data[3].m_data[0].m_data[i]].m_index];
     }
     /* Effect Parameter Post Processing */
     /* - Cabinet */
     /*   - Hi Cut Frequency in Hz (Hi Cut == Lowpass) */
-    _signal[CAB_LPF] = evalNyquist(m_body[m_head[P_CAB_LPF].m_index].m_signal * 440.f);
+    _signal[CAB_LPF] = evalNyquist(m_body.m_signal[m_head[P_CAB_LPF].m_index] * 440.f);
     /*   - Lo Cut Frequency in Hz (Lo Cut == Highpass) */
-    _signal[CAB_HPF] = evalNyquist(m_body[m_head[P_CAB_HPF].m_index].m_signal * 440.f);     // nyquist clipping not necessary...
+    _signal[CAB_HPF] = evalNyquist(m_body.m_signal[m_head[P_CAB_HPF].m_index] * 440.f);     // nyquist clipping not necessary...
     /*   - Tilt to Shelving EQs */
-    _signal[CAB_TILT] = m_body[m_head[P_CAB_TILT].m_index].m_signal;
+    _signal[CAB_TILT] = m_body.m_signal[m_head[P_CAB_TILT].m_index];
 }
 
 /* Mono Post Processing - fast parameters */
-void paramengine::postProcessMono_fast(float *_signal)
+void paramengine::postProcessMono_fast(voice_signal _signal)
 {
     /* provide indices for distributions */
     uint32_t i, p;
@@ -1132,7 +1232,7 @@ void paramengine::postProcessMono_fast(float *_signal)
     for(i = 0; i < m_postIds.m_data[0].m_data[2].m_data[0].m_length; i++)
     {
         p = m_head[m_postIds.m_data[0].m_data[2].m_data[0].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[2].m_data[0].m_data[i]].m_index].m_signal;
+        _signal[p] = m_body.m_signal[m_head[m_postIds.m_data[0].m_data[2].m_data[0].m_data[i]].m_index];
     }
     /* Explicit Post Processing */
     /* provide temporary variables */
@@ -1140,16 +1240,16 @@ void paramengine::postProcessMono_fast(float *_signal)
     /* Effect Parameter Post Processing */
     /* - Cabinet */
     /*   - Tilt to Saturation Levels (pre, post Shaper) */
-    tmp_val = NlToolbox::Clipping::floatMax(2e-20, m_convert.eval_level(0.5f * m_body[m_head[P_CAB_TILT].m_index].m_signal));
+    tmp_val = NlToolbox::Clipping::floatMax(2e-20, m_convert.eval_level(0.5f * m_body.m_signal[m_head[P_CAB_TILT].m_index]));
     _signal[CAB_PRESAT] = 0.1588f / tmp_val;
     _signal[CAB_SAT] = tmp_val;
     /*   - Cab Level and Dry/Wet Mix Levels */
-    _signal[CAB_DRY] = 1.f - m_body[m_head[P_CAB_MIX].m_index].m_signal;
-    _signal[CAB_WET] = m_body[m_head[P_CAB_LVL].m_index].m_signal * m_body[m_head[P_CAB_MIX].m_index].m_signal;
+    _signal[CAB_DRY] = 1.f - m_body.m_signal[m_head[P_CAB_MIX].m_index];
+    _signal[CAB_WET] = m_body.m_signal[m_head[P_CAB_LVL].m_index] * m_body.m_signal[m_head[P_CAB_MIX].m_index];
 }
 
 /* Mono Post Processing - audio parameters */
-void paramengine::postProcessMono_audio(float *_signal)
+void paramengine::postProcessMono_audio(voice_signal _signal)
 {
     /* provide indices for distributions */
     uint32_t i, p;
@@ -1157,7 +1257,7 @@ void paramengine::postProcessMono_audio(float *_signal)
     for(i = 0; i < m_postIds.m_data[0].m_data[1].m_data[0].m_length; i++)
     {
         p = m_head[m_postIds.m_data[0].m_data[1].m_data[0].m_data[i]].m_postId;
-        _signal[p] = m_body[m_head[m_postIds.m_data[0].m_data[1].m_data[0].m_data[i]].m_index].m_signal;
+        _signal[p] = m_body.m_signal[m_head[m_postIds.m_data[0].m_data[1].m_data[0].m_data[i]].m_index];
     }
     /* mono envelope rendering */
 #if dsp_take_envelope == 0
@@ -1168,3 +1268,29 @@ void paramengine::postProcessMono_audio(float *_signal)
         m_new_envelopes.tickMono();
 #endif
 }
+
+/* Automatic Post Processing - mono to poly distribution and poly to poly copy of a clock type, for all voices at once
+   (performed before the poly post processing of the clock, poly items and signal rows share the voice lane layout) */
+void paramengine::postProcessDistribution(shared_signal &_signal, const uint32_t _clockType)
+{
+    /* provide indices for distributions */
+    uint32_t i, p, v;
+    /* automatic mono to poly distribution */
+    for(i = 0; i < m_postIds.m_data[1].m_data[_clockType].m_data[0].m_length; i++)
+    {
+        /* spread values of mono parameters to all voices of shared signal array */
+        p = m_postIds.m_data[1].m_data[_clockType].m_data[0].m_data[i];
+        _signal.distribute(static_cast<uint32_t>(m_head[p].m_postId), m_body.m_signal[m_head[p].m_index]);
+    }
+    /* automatic poly to poly copy - a row of voice lanes */
+    for(i = 0; i < m_postIds.m_data[0].m_data[_clockType].m_data[1].m_length; i++)
+    {
+        p = m_postIds.m_data[0].m_data[_clockType].m_data[1].m_data[i];
+        const float *source = &m_body.m_signal[m_head[p].m_index];
+        float *destination = _signal.m_data[m_head[p].m_postId];
+        for(v = 0; v < dsp_simd_voices; v++)
+        {
+            destination[v] = source[v];
+        }
+    }
+}
@@ -25,8 +25,13 @@
 #include "pe_utilities.h"
 #include "pe_defines_labels.h"
 #include "dsp_defines_signallabels.h"
+#include "dsp_shared_signal.h"
 #include "nltoolbox.h"
 
+/* item count of the parameter rendering arrays: mono parameters take one item, poly parameters a row of dsp_simd_voices items starting
+   at a lane boundary (the worst case padding is included, the count is rounded up to full cache lines) */
+#define dsp_param_items     ((((sig_number_of_params - sig_number_of_poly_params) + (sig_number_of_poly_params * (dsp_simd_voices + dsp_simd_lanes - 1))) + 15) & ~15)
+
 /* */
 struct param_head
 {
@@ -42,18 +47,18 @@ struct param_head
     float m_scaleArg;
 };
 
-/* */
-struct param_body
+/* parameter rendering items (structure of arrays) - a poly parameter owns a lane aligned row of dsp_simd_voices items */
+struct alignas(64) param_body
 {
     /* */
-    uint32_t m_state = 0;
-    uint32_t m_preload = 0;
-    float m_signal = 0.f;
-    float m_dx[2] = {0.f, 0.f};
-    float m_x = 0.f;
-    float m_start = 0.f;
-    float m_diff = 0.f;
-    float m_dest = 0.f;
+    uint32_t m_state[dsp_param_items] = {};
+    uint32_t m_preload[dsp_param_items] = {};
+    float m_signal[dsp_param_items] = {};
+    float m_dx[2][dsp_param_items] = {};
+    float m_x[dsp_param_items] = {};
+    float m_start[dsp_param_items] = {};
+    float m_diff[dsp_param_items] = {};
+    float m_dest[dsp_param_items] = {};
 };
 
 /* */
@@ -82,9 +87,11 @@ struct paramengine
     const uint32_t m_envIds[sig_number_of_env_events] = {par_envelopeA, par_envelopeB, par_envelopeC};
     /* local data structures */
     clock_id_list m_clockIds;
+    id_list m_monoRamps[dsp_clock_types];                           // live ramps (items in transition) of mono parameters, per clock type
+    id_list m_polyRamps[dsp_clock_types];                           // live rows (first item) of poly parameters with a voice in transition, per clock type
     dual_clock_id_list m_postIds;
     param_head m_head[sig_number_of_params];
-    param_body m_body[sig_number_of_param_items];
+    param_body m_body;
     exponentiator m_convert;
     param_utility m_utilities[sig_number_of_utilities];
 #if dsp_take_envelope == 0
@@ -107,15 +114,20 @@ struct paramengine
     void setDx(const uint32_t _voiceId, const uint32_t _paramId, float _value);             // param dx update
     void setDest(const uint32_t _voiceId, const uint32_t _paramId, float _value);           // param dest update
     void applyPreloaded(const uint32_t _voiceId, const uint32_t _paramId);                  // param apply preloaded
-    void applyDest(const uint32_t _index);                                                  // param apply dest (non-sync types)
+    void applyDest(const uint32_t _voiceId, const uint32_t _paramId);                       // param apply dest (non-sync types, registers the ramp)
     void applySync(const uint32_t _index);                                                  // param apply dest (sync types)
     /* rendering */
     void tickItem(const uint32_t _index);                                                   // parameter rendering
+    void tickMonoRamps(const uint32_t _clockType);                                          // parameter rendering: live mono ramps of a clock type
+    void tickPolyRamps(const uint32_t _clockType);                                          // parameter rendering: live poly rows of a clock type (all voices, lane by lane)
+    void tickRamps(id_list &_ramps);                                                        // parameter rendering: renders a ramp list, finished ramps drop out
+    bool polyRowLive(const uint32_t _row);                                                  // parameter rendering: is a voice of the poly row in transition?
     /* key events */
     void keyDown(const uint32_t _voiceId, float _velocity);                                 // key events: key down (note on) mechanism
     void keyUp(const uint32_t _voiceId, float _velocity);                                   // key events: key up (note off) mechanism
     void keyApply(const uint32_t _voiceId);                                                 // key events: apply key event
     void keyApplyMono();                                                                    // key events: apply mono event
+    bool polyEnvelopesIdle(const uint32_t _voiceId);                                        // voice activity: all poly envelopes of the voice have finished
 #if dsp_take_envelope == 0
     /* OLD envelope updates */
     void envUpdateStart(const uint32_t _voiceId, const uint32_t _envId, const float _pitch, const float _velocity, const float _retriggerHardness);
@@ -130,10 +142,12 @@ struct paramengine
     void newEnvUpdateLevels(const uint32_t _voiceId);
 #endif
     /* simplified polyphonic post processing approach (one function per clock) */
-    void postProcessPoly_slow(float *_signal, const uint32_t _voiceId);                         // poly slow post processing (distribution, copy, env c event signal!)
-    void postProcessPoly_fast(float *_signal, const uint32_t _voiceId);                         // poly fast post processing (distribution, copy)
-    void postProcessPoly_audio(float *_signal, const uint32_t _voiceId);                        // poly audio post processing (distribution, copy, envelopes, param combination)
-    void postProcessMono_slow(float *_signal);                                                  // mono slow post processing
-    void postProcessMono_fast(float *_signal);                                                  // mono fast post processing
-    void postProcessMono_audio(float *_signal);                                                 // mono audio post processing
+    void postProcessPoly_slow(voice_signal _signal, const uint32_t _voiceId);                   // poly slow post processing (env c event signal!)
+    void postProcessPoly_fast(voice_signal _signal, const uint32_t _voiceId);                   // poly fast post processing
+    void tickPolyEnvelopes(const uint32_t _voiceMask);                                          // poly envelope rendering (all voices of the mask at once)
+    void postProcessPoly_audio(voice_signal _signal, const uint32_t _voiceId);                  // poly audio post processing (envelopes, param combination)
+    void postProcessMono_slow(voice_signal _signal);                                            // mono slow post processing
+    void postProcessMono_fast(voice_signal _signal);                                            // mono fast post processing
+    void postProcessMono_audio(voice_signal _signal);                                           // mono audio post processing
+    void postProcessDistribution(shared_signal &_signal, const uint32_t _clockType);            // automatic distribution and copy of a clock type, all voices at once
 };
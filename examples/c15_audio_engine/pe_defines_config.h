@@ -12,12 +12,21 @@
 
 #include <stdint.h>
 
-/* Main Configuration                               (prepared for maximal 20 Voices) */
+/* Main Configuration                               (prepared for maximal 20 Voices, smaller builds define dsp_number_of_voices) */
 
 #define dsp_poly_types              2               // two polyphony types (mono, poly) - (later, a dual type needs to be implemented)
 #define dsp_clock_types             4               // four different parameter types (sync, audio, fast, slow)
-#define dsp_number_of_voices        20              // maximum allowed number of voices
+#ifndef dsp_number_of_voices
+#define dsp_number_of_voices        20              // maximum allowed number of voices (sizes all voice arrays, set per build: -Ddsp_number_of_voices=8)
+#endif
 #define dsp_take_envelope           1               // specify which env engine should be used: old (0) or new (1)
+#define dsp_block_max_frames        20              // maximal sub-block length of block rendering (one fast clock period at 192000 Hz)
+#ifndef dsp_poly_simd
+#define dsp_poly_simd               1               // specify how tickBlock() renders the poly chain: per voice reference (0) or voice parallel SIMD bank (1), set per build
+#endif
+#define dsp_voice_idle_threshold    1e-5f           // voice activity: a released voice goes idle, once its mixer inputs stay below -100 dB ...
+#define dsp_voice_idle_hold         8192            // ... for this many samples (one comb filter delay buffer)
+#define dsp_render_threads          0               // threads sharing the voice groups of the SIMD bank: the audio thread plus (n - 1) pinned workers (0: one worker per idle core, 1: audio thread only)
 
 const uint32_t dsp_clock_rates[2] = {               // sub-audio clocks are defined in rates (Hz) now
 
@@ -30,7 +39,8 @@ const uint32_t dsp_clock_rates[2] = {               // sub-audio clocks are defi
 
 #define sig_number_of_params        184             // 3 * (15 ENV params) + 2 * (14 OSC + 8 SHP params) + (16 CMB params) + (13 SVF params) + (9 FB Mix params) + (12 OUT params)
                                                     // + (8 CABINET params) + (6 GAP params) + (12 FLANGER params) (6 ECHO params) + (5 REVERB params) + (2 MASTER params) + (6 KEY params)
-#define sig_number_of_param_items   298             // (45 + 44 + 16 + 13 + 9 + 12 + 8 + 6 + 12 + 6 + 5 + 2 (* 1 Voice) MONO params) + (6 (* 20 Voices) POLY params)
+#define sig_number_of_param_items   (178 + (6 * dsp_number_of_voices))  // (45 + 44 + 16 + 13 + 9 + 12 + 8 + 6 + 12 + 6 + 5 + 2 (* 1 Voice) MONO params) + (6 (* n Voices) POLY params)
+#define sig_number_of_poly_params   6               // 6 KEY params
 #define sig_number_of_signal_items  83              // 73 (+ 10 Cabinet signals) shared signals
 
 /* TCD List Handling */
@@ -43,7 +53,7 @@ const uint32_t dsp_clock_rates[2] = {               // sub-audio clocks are defi
 
 #define sig_number_of_utilities     2               // two Utility Parameters: Velocity, Reference Tone
 #define sig_number_of_envelopes     5               // five Envelope Units: A, B, C, Gate, Flanger
-#define sig_number_of_env_items     81              // 4 POLY Envelopes (A..Gate) = 4 * 20 = 80 items, 1 MONO (Flanger Decay), total: 81 items
+#define sig_number_of_env_items     (4 * dsp_number_of_voices + 1)  // 4 POLY Envelopes (A..Gate) = 4 * n Voices items, 1 MONO (Flanger Decay), total: 81 items for 20 voices
 #define sig_number_of_env_segments  4               // four segments for ADBDSR-type Envelopes (A, B, C): Attack, Decay 1, Decay 2, Release
 #define sig_number_of_env_types     3               // three Envelope types: ADBDSR (A, B, C), Gate (Gate), Decay (Flanger)
 #define sig_number_of_env_events    3               // three Envelope Event objects for Envelopes A, B, C (managing Velocity and KeyPos responses)
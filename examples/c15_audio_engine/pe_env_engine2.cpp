@@ -7,8 +7,127 @@
  *              the main env_engine2 object.
 ******************************************************************************/
 
+#include <type_traits>
 #include "pe_env_engine2.h"
 
+/********************************************** Voice Parallel Rendering **********************************************/
+
+/*****************************************************************************/
+/** @brief      voice parallel version of the tick() and nextSegment() functions
+ *
+ * renders all voices of the mask, dsp_simd_lanes voices at once - the segment
+ * data is gathered by the segment index of each lane, the states are handled
+ * by masks (same operations and order as tick(), so every lane renders the
+ * scalar result)
+ *
+ *  @param      body, segment: the body and segments of the envelope object
+ *  @param      voiceMask, one bit per voice to render
+ *  @param      infiniteState, finiteState: state numbers of the exponential
+ *              curves, which stay or finish (-1: not used by the type)
+******************************************************************************/
+
+template<typename Body, typename Segment>
+static void tickLanes(Body &_body, const Segment *_segment, const uint32_t _voiceMask, const int32_t _infiniteState, const int32_t _finiteState)
+{
+    using namespace NlToolbox::Simd;
+    constexpr bool split = std::is_same<Body, env_body_split>::value;
+    const int32_t stride = sizeof(Segment) / sizeof(float);             // distance of two segments in floats
+
+    for(uint32_t v = 0; v < dsp_simd_voices; v += dsp_simd_lanes)
+    {
+        /* only lanes of the mask in a rendering state */
+
+        vint state = load(&_body.m_state[v]);
+        const vint render = laneMask(_voiceMask >> v) & (state != 0);
+
+        if(!any(render))
+        {
+            continue;
+        }
+
+        /* gather the current segment data of each lane */
+
+        vint index = load(&_body.m_index[v]);
+        vint next = load(&_body.m_next[v]);
+        const vint offset = (index * stride) + laneIndex();
+        const vfloat dx = gather(&_segment[0].m_dx[v], offset);
+        const vfloat dest_magnitude = gather(&_segment[0].m_dest_magnitude[v], offset);
+        const vfloat curve = gather(&_segment[0].m_curve, index * stride);
+
+        vfloat x = load(&_body.m_x[v]);
+        vfloat y = load(&_body.m_y[v]);
+        vfloat start_magnitude = load(&_body.m_start_magnitude[v]);
+        vfloat signal_magnitude = load(&_body.m_signal_magnitude[v]);
+        const vfloat diff_magnitude = dest_magnitude - start_magnitude;
+
+        /* curve types and transition progress */
+
+        const vint linear = state == 1;
+        const vint polynomial = state == 4;
+        const vint exponential = (state == _infiniteState) | (state == _finiteState);
+        const vint xRunning = (linear | polynomial) & (x < 1.f);
+        const vint yRunning = exponential & __builtin_convertvector(__builtin_convertvector(y, vdouble) > dsp_render_min, vint);
+        const vint finished = render & ((((linear | polynomial) & ~xRunning)) | ((state == _finiteState) & ~yRunning));
+
+        vfloat progress = squaredCurvature(x, curve);
+        progress = squaredCurvature(progress, curve);
+        progress = squaredCurvature(progress, curve);
+        progress = squaredCurvature(progress, curve);
+        progress = select(polynomial, progress, select(linear, x, select(yRunning, 1.f - y, splat(1.f))));
+
+        /* render signals (finished transitions end on their destinations) and update the transition progress */
+
+        signal_magnitude = select(render, select(finished, dest_magnitude, start_magnitude + (diff_magnitude * progress)), signal_magnitude);
+        x = select(render & xRunning, x + dx, x);
+        y = select(render & yRunning, y * (1.f - dx), y);
+
+        vfloat start_timbre, signal_timbre;
+
+        if constexpr(split)
+        {
+            start_timbre = load(&_body.m_start_timbre[v]);
+            signal_timbre = load(&_body.m_signal_timbre[v]);
+            const vfloat dest_timbre = gather(&_segment[0].m_dest_timbre[v], offset);
+            signal_timbre = select(render, select(finished, dest_timbre, start_timbre + ((dest_timbre - start_timbre) * progress)), signal_timbre);
+        }
+
+        /* issue subsequent segments (nextSegment()) */
+
+        if(any(finished))
+        {
+            const vint nextOffset = (next * stride) + laneIndex();
+            const vfloat nextDx = gather(&_segment[0].m_dx[v], nextOffset);
+
+            x = select(finished, nextDx, x);
+            y = select(finished, 1.f - nextDx, y);
+            start_magnitude = select(finished, signal_magnitude, start_magnitude);
+            state = select(finished, gather(&_segment[0].m_state, next * stride), state);
+            index = select(finished, next, index);
+            next = select(finished, gather(&_segment[0].m_next, next * stride), next);
+
+            if constexpr(split)
+            {
+                start_timbre = select(finished, signal_timbre, start_timbre);
+            }
+
+            store(&_body.m_state[v], state);
+            store(&_body.m_index[v], index);
+            store(&_body.m_next[v], next);
+            store(&_body.m_start_magnitude[v], start_magnitude);
+        }
+
+        store(&_body.m_x[v], x);
+        store(&_body.m_y[v], y);
+        store(&_body.m_signal_magnitude[v], signal_magnitude);
+
+        if constexpr(split)
+        {
+            store(&_body.m_start_timbre[v], start_timbre);
+            store(&_body.m_signal_timbre[v], signal_timbre);
+        }
+    }
+}
+
 /********************************************** Split Envelope Object Functionality **********************************************/
 
 /*****************************************************************************/
@@ -21,22 +140,18 @@
 
 void env_object_adbdsr_split::start(const uint32_t _voiceId)
 {
-    /* set the body reference according to the current voice */
-
-    env_body_split* body = &m_body[_voiceId];                           // a temporary body variable is declared
-
     /* prepare rendering variables for the imminent transition */
 
-    body->m_x = m_segment[m_startIndex].m_dx[_voiceId];                 // x represents the transition progress [0 ... 1] for linear and polynomial transitions (x = dx)
-    body->m_y = 1.f - m_segment[m_startIndex].m_dx[_voiceId];           // y represents the transition progress [1 ... 0] for exponential transitions (y = 1 - dx)
-    body->m_start_magnitude = body->m_signal_magnitude;                 // the signal startpoint is updated for the magnitude signal (startpoint = signal)
-    body->m_start_timbre = body->m_signal_timbre;                       // the signal startpoint is updated for the timbre signal (startpoint = signal)
+    m_body.m_x[_voiceId] = m_segment[m_startIndex].m_dx[_voiceId];              // x represents the transition progress [0 ... 1] for linear and polynomial transitions (x = dx)
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_startIndex].m_dx[_voiceId];        // y represents the transition progress [1 ... 0] for exponential transitions (y = 1 - dx)
+    m_body.m_start_magnitude[_voiceId] = m_body.m_signal_magnitude[_voiceId];   // the signal startpoint is updated for the magnitude signal (startpoint = signal)
+    m_body.m_start_timbre[_voiceId] = m_body.m_signal_timbre[_voiceId];         // the signal startpoint is updated for the timbre signal (startpoint = signal)
 
     /* prepare state variables for the imminent transition */
 
-    body->m_state = m_segment[m_startIndex].m_state;                    // the rendering state is updated according to the first segment (state = polynomial)
-    body->m_index = m_startIndex;                                       // the segment index is updated to the first segment (index = 1)
-    body->m_next = m_segment[m_startIndex].m_next;                      // the subsequent segment index is updated according to the first segment (next = linear)
+    m_body.m_state[_voiceId] = m_segment[m_startIndex].m_state;                 // the rendering state is updated according to the first segment (state = polynomial)
+    m_body.m_index[_voiceId] = m_startIndex;                                    // the segment index is updated to the first segment (index = 1)
+    m_body.m_next[_voiceId] = m_segment[m_startIndex].m_next;                   // the subsequent segment index is updated according to the first segment (next = linear)
 }
 
 /*****************************************************************************/
@@ -49,22 +164,18 @@ void env_object_adbdsr_split::start(const uint32_t _voiceId)
 
 void env_object_adbdsr_split::stop(const uint32_t _voiceId)
 {
-    /* set the body reference according to the current voice */
-
-    env_body_split* body = &m_body[_voiceId];                           // a temporary body variable is declared
-
     /* prepare rendering variables for the imminent transition */
 
-    body->m_x = m_segment[m_stopIndex].m_dx[_voiceId];                  // x represents the transition progress [0 ... 1] for linear and polynomial transitions (x = dx)
-    body->m_y = 1.f - m_segment[m_stopIndex].m_dx[_voiceId];            // y represents the transition progress [1 ... 0] for exponential transitions (y = 1 - dx)
-    body->m_start_magnitude = body->m_signal_magnitude;                 // the signal startpoint is updated for the magnitude signal (startpoint = signal)
-    body->m_start_timbre = body->m_signal_timbre;                       // the signal startpoint is updated for the timbre signal (startpoint = signal)
+    m_body.m_x[_voiceId] = m_segment[m_stopIndex].m_dx[_voiceId];               // x represents the transition progress [0 ... 1] for linear and polynomial transitions (x = dx)
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_stopIndex].m_dx[_voiceId];         // y represents the transition progress [1 ... 0] for exponential transitions (y = 1 - dx)
+    m_body.m_start_magnitude[_voiceId] = m_body.m_signal_magnitude[_voiceId];   // the signal startpoint is updated for the magnitude signal (startpoint = signal)
+    m_body.m_start_timbre[_voiceId] = m_body.m_signal_timbre[_voiceId];         // the signal startpoint is updated for the timbre signal (startpoint = signal)
 
     /* prepare state variables for the imminent transition */
 
-    body->m_state = m_segment[m_stopIndex].m_state;                     // the rendering state is updated according to the final segment (state = exponential)
-    body->m_index = m_stopIndex;                                        // the segment index is updated to the final segment (index = 4)
-    body->m_next = m_segment[m_stopIndex].m_next;                       // the subsequent segment index is updated according to the final segment (next = idle)
+    m_body.m_state[_voiceId] = m_segment[m_stopIndex].m_state;                  // the rendering state is updated according to the final segment (state = exponential)
+    m_body.m_index[_voiceId] = m_stopIndex;                                     // the segment index is updated to the final segment (index = 4)
+    m_body.m_next[_voiceId] = m_segment[m_stopIndex].m_next;                    // the subsequent segment index is updated according to the final segment (next = idle)
 }
 
 /*****************************************************************************/
@@ -77,20 +188,19 @@ void env_object_adbdsr_split::stop(const uint32_t _voiceId)
 
 void env_object_adbdsr_split::tick(const uint32_t _voiceId)
 {
-    /* set the body and segment reference according to the current voice and body state */
+    /* set the segment reference according to the current body state */
 
-    env_body_split* body = &m_body[_voiceId];                                                               // a temporary body variable is declared
-    const uint32_t segment = body->m_index;                                                                 // a temporary segment index variable is declared
+    const uint32_t segment = m_body.m_index[_voiceId];                                                                                  // a temporary segment index variable is declared
 
     /* calculate the current differences (signal to destination) */
 
-    const float diff_magnitude = m_segment[segment].m_dest_magnitude[_voiceId] - body->m_start_magnitude;   // current transition difference for the magnitude signal
-    const float diff_timbre = m_segment[segment].m_dest_timbre[_voiceId] - body->m_start_timbre;            // current transition difference for the timbre signal
-                                                                                                            // (difference = destination - startpoint) (magnitude, timbre)
+    const float diff_magnitude = m_segment[segment].m_dest_magnitude[_voiceId] - m_body.m_start_magnitude[_voiceId];                    // current transition difference for the magnitude signal
+    const float diff_timbre = m_segment[segment].m_dest_timbre[_voiceId] - m_body.m_start_timbre[_voiceId];                             // current transition difference for the timbre signal
+                                                                                                                                        // (difference = destination - startpoint) (magnitude, timbre)
 
     /* render according to the current state */
 
-    switch(body->m_state)                                                                                   // (basic rendering instructions)
+    switch(m_body.m_state[_voiceId])                                                                                                    // (basic rendering instructions)
     {
 
     case 0:     /* idle - no rendering */
@@ -99,23 +209,23 @@ void env_object_adbdsr_split::tick(const uint32_t _voiceId)
 
     case 1:     /* linear rendering (decay1 phase) - until transition is finished */
 
-        if(body->m_x < 1.f)                                                                                 // (if(x < 1))
+        if(m_body.m_x[_voiceId] < 1.f)                                                                                                  // (if(x < 1))
         {
             /* while transition is unfinished, the signals are formed by the current transition progress */
 
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * body->m_x);              // (signal = startpoint + (difference * x)) (magnitude)
-            body->m_signal_timbre = body->m_start_timbre + (diff_timbre * body->m_x);                       // (signal = startpoint + (difference * x)) (timbre)
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * m_body.m_x[_voiceId]);         // (signal = startpoint + (difference * x)) (magnitude)
+            m_body.m_signal_timbre[_voiceId] = m_body.m_start_timbre[_voiceId] + (diff_timbre * m_body.m_x[_voiceId]);                  // (signal = startpoint + (difference * x)) (timbre)
 
             /* update the transition progress for the next clock tick */
 
-            body->m_x += m_segment[segment].m_dx[_voiceId];                                                 // (x += dx)
+            m_body.m_x[_voiceId] += m_segment[segment].m_dx[_voiceId];                                                                  // (x += dx)
         }
         else
         {
             /* when transition is finished, the signals are set to the corresponding segment destinations */
 
-            body->m_signal_magnitude = m_segment[segment].m_dest_magnitude[_voiceId];                       // (signal = destination) (magnitude)
-            body->m_signal_timbre = m_segment[segment].m_dest_timbre[_voiceId];                             // (signal = destination) (timbre)
+            m_body.m_signal_magnitude[_voiceId] = m_segment[segment].m_dest_magnitude[_voiceId];                                        // (signal = destination) (magnitude)
+            m_body.m_signal_timbre[_voiceId] = m_segment[segment].m_dest_timbre[_voiceId];                                              // (signal = destination) (timbre)
 
             /* issue subsequent segment */
 
@@ -125,23 +235,23 @@ void env_object_adbdsr_split::tick(const uint32_t _voiceId)
 
     case 2:     /* exponential, quasi-infinite rendering (decay2 phase) - until transition is finished */
 
-        if(body->m_y > dsp_render_min)                                                                      // (if(y > 1e-9))
+        if(m_body.m_y[_voiceId] > dsp_render_min)                                                                                       // (if(y > 1e-9))
         {
             /* while transition is unfinished, the signals are formed by the current transition progress */
 
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * (1.f - body->m_y));      // (signal = startpoint + (difference * (1 - y))) (magnitude)
-            body->m_signal_timbre = body->m_start_timbre + (diff_timbre * (1.f - body->m_y));               // (signal = startpoint + (difference * (1 - y))) (timbre)
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * (1.f - m_body.m_y[_voiceId])); // (signal = startpoint + (difference * (1 - y))) (magnitude)
+            m_body.m_signal_timbre[_voiceId] = m_body.m_start_timbre[_voiceId] + (diff_timbre * (1.f - m_body.m_y[_voiceId]));          // (signal = startpoint + (difference * (1 - y))) (timbre)
 
             /* update the transition progress for the next clock tick */
 
-            body->m_y *= 1.f - m_segment[segment].m_dx[_voiceId];                                           // (y *= 1 - dx)
+            m_body.m_y[_voiceId] *= 1.f - m_segment[segment].m_dx[_voiceId];                                                            // (y *= 1 - dx)
         }
         else
         {
             /* when transition is finished, the signals are formed without the transition progress (but still according to the segment destinations) */
 
-            body->m_signal_magnitude = body->m_start_magnitude + diff_magnitude;                            // (signal = startpoint + difference) (magnitude)
-            body->m_signal_timbre = body->m_start_timbre + diff_timbre;                                     // (signal = startpoint + difference) (timbre)
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + diff_magnitude;                                  // (signal = startpoint + difference) (magnitude)
+            m_body.m_signal_timbre[_voiceId] = m_body.m_start_timbre[_voiceId] + diff_timbre;                                           // (signal = startpoint + difference) (timbre)
 
             /* no subsequent segment will be issued (until a key down happens and triggers the final segment) */
         }
@@ -149,23 +259,23 @@ void env_object_adbdsr_split::tick(const uint32_t _voiceId)
 
     case 3:     /* exponential, quasi-finite rendering (release phase) - until transition is finished */
 
-        if(body->m_y > dsp_render_min)                                                                      // (if(y > 1e-9))
+        if(m_body.m_y[_voiceId] > dsp_render_min)                                                                                       // (if(y > 1e-9))
         {
             /* while transition is unfinished, the signals are formed by the current transition progress */
 
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * (1.f - body->m_y));      // (signal = startpoint + (difference * (1 - y))) (magnitude)
-            body->m_signal_timbre = body->m_start_timbre + (diff_timbre * (1.f - body->m_y));               // (signal = startpoint + (difference * (1 - y))) (timbre)
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * (1.f - m_body.m_y[_voiceId])); // (signal = startpoint + (difference * (1 - y))) (magnitude)
+            m_body.m_signal_timbre[_voiceId] = m_body.m_start_timbre[_voiceId] + (diff_timbre * (1.f - m_body.m_y[_voiceId]));          // (signal = startpoint + (difference * (1 - y))) (timbre)
 
             /* update the transition progress for the next clock tick */
 
-            body->m_y *= 1.f - m_segment[segment].m_dx[_voiceId];                                           // (y *= 1 - dx)
+            m_body.m_y[_voiceId] *= 1.f - m_segment[segment].m_dx[_voiceId];                                                            // (y *= 1 - dx)
         }
         else
         {
             /* when transition is finished, the signals are set to the corresponding segment destinations */
 
-            body->m_signal_magnitude = m_segment[segment].m_dest_magnitude[_voiceId];                       // (signal = destination) (magnitude)
-            body->m_signal_timbre = m_segment[segment].m_dest_timbre[_voiceId];                             // (signal = destination) (timbre)
+            m_body.m_signal_magnitude[_voiceId] = m_segment[segment].m_dest_magnitude[_voiceId];                                        // (signal = destination) (magnitude)
+            m_body.m_signal_timbre[_voiceId] = m_segment[segment].m_dest_timbre[_voiceId];                                              // (signal = destination) (timbre)
 
             /* issue subsequent segment */
 
@@ -175,30 +285,30 @@ void env_object_adbdsr_split::tick(const uint32_t _voiceId)
 
     case 4:     /* polynomial rendering (attack phase) - until transition is finished */
 
-        if(body->m_x < 1.f)                                                                                 // (if(x < 1))
+        if(m_body.m_x[_voiceId] < 1.f)                                                                                                  // (if(x < 1))
         {
             /* while transition is unfinished, the transition polynomial is formed according to the curvature */
 
-            float x = NlToolbox::Curves::SquaredCurvature(body->m_x, m_segment[segment].m_curve);           // (polynomical curvature, 2nd degree)
-            x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);                         // (polynomical curvature, 4th degree)
-            x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);                         // (polynomical curvature, 8th degree)
-            x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);                         // (polynomical curvature, 16th degree)
+            float x = NlToolbox::Curves::SquaredCurvature(m_body.m_x[_voiceId], m_segment[segment].m_curve);                            // (polynomical curvature, 2nd degree)
+            x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);                                                     // (polynomical curvature, 4th degree)
+            x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);                                                     // (polynomical curvature, 8th degree)
+            x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);                                                     // (polynomical curvature, 16th degree)
 
             /* the signals are formed by the current transition progress (more precise: the polynomial formed by the progress) */
 
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * x);                      // (signal = startpoint + (difference * f(x))) (magnitude)
-            body->m_signal_timbre = body->m_start_timbre + (diff_timbre * x);                               // (signal = startpoint + (difference * f(x))) (timbre)
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * x);                            // (signal = startpoint + (difference * f(x))) (magnitude)
+            m_body.m_signal_timbre[_voiceId] = m_body.m_start_timbre[_voiceId] + (diff_timbre * x);                                     // (signal = startpoint + (difference * f(x))) (timbre)
 
             /* update the transition progress for the next clock tick */
 
-            body->m_x += m_segment[segment].m_dx[_voiceId];                                                 // (x += dx)
+            m_body.m_x[_voiceId] += m_segment[segment].m_dx[_voiceId];                                                                  // (x += dx)
         }
         else
         {
             /* when transition is finished, the signals are set to the corresponding segment destinations */
 
-            body->m_signal_magnitude = m_segment[segment].m_dest_magnitude[_voiceId];                       // (signal = destination) (magnitude)
-            body->m_signal_timbre = m_segment[segment].m_dest_timbre[_voiceId];                             // (signal = destination) (timbre)
+            m_body.m_signal_magnitude[_voiceId] = m_segment[segment].m_dest_magnitude[_voiceId];                                        // (signal = destination) (magnitude)
+            m_body.m_signal_timbre[_voiceId] = m_segment[segment].m_dest_timbre[_voiceId];                                              // (signal = destination) (timbre)
 
             /* issue subsequent segment */
 
@@ -208,6 +318,19 @@ void env_object_adbdsr_split::tick(const uint32_t _voiceId)
     }
 }
 
+/*****************************************************************************/
+/** @brief      sampling function for clock ticks, all voices at once
+ *
+ * performing the transition rendering of the current segments
+ *
+ *  @param      voiceMask, one bit per voice to render
+******************************************************************************/
+
+void env_object_adbdsr_split::tickAll(const uint32_t _voiceMask)
+{
+    tickLanes(m_body, m_segment, _voiceMask, 2, 3);                     // decay2 (2) stays, release (3) finishes
+}
+
 /*****************************************************************************/
 /** @brief      trigger function for finished transitions
  *
@@ -219,22 +342,18 @@ void env_object_adbdsr_split::tick(const uint32_t _voiceId)
 
 void env_object_adbdsr_split::nextSegment(const uint32_t _voiceId)
 {
-    /* set the body reference according to the current voice */
-
-    env_body_split* body = &m_body[_voiceId];                           // a temporary body variable is declared
-
     /* prepare rendering variables for the imminent transition */
 
-    body->m_x = m_segment[body->m_next].m_dx[_voiceId];                 // x represents the transition progress [0 ... 1] for linear and polynomial transitions
-    body->m_y = 1.f - m_segment[body->m_next].m_dx[_voiceId];           // y represents the transition progress [1 ... 0] for exponential transitions
-    body->m_start_magnitude = body->m_signal_magnitude;                 // the signal startpoint is updated for the magnitude signal
-    body->m_start_timbre = body->m_signal_timbre;                       // the signal startpoint is updated for the timbre signal
+    m_body.m_x[_voiceId] = m_segment[m_body.m_next[_voiceId]].m_dx[_voiceId];       // x represents the transition progress [0 ... 1] for linear and polynomial transitions
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_body.m_next[_voiceId]].m_dx[_voiceId]; // y represents the transition progress [1 ... 0] for exponential transitions
+    m_body.m_start_magnitude[_voiceId] = m_body.m_signal_magnitude[_voiceId];       // the signal startpoint is updated for the magnitude signal
+    m_body.m_start_timbre[_voiceId] = m_body.m_signal_timbre[_voiceId];             // the signal startpoint is updated for the timbre signal
 
     /* prepare state variables for the imminent transition */
 
-    body->m_state = m_segment[body->m_next].m_state;                    // the rendering state is updated according to the first segment
-    body->m_index = body->m_next;                                       // the segment index is updated to the first segment
-    body->m_next = m_segment[body->m_index].m_next;                     // the subsequent segment index is updated according to the first segment
+    m_body.m_state[_voiceId] = m_segment[m_body.m_next[_voiceId]].m_state;          // the rendering state is updated according to the first segment
+    m_body.m_index[_voiceId] = m_body.m_next[_voiceId];                             // the segment index is updated to the first segment
+    m_body.m_next[_voiceId] = m_segment[m_body.m_index[_voiceId]].m_next;           // the subsequent segment index is updated according to the first segment
 }
 
 /*****************************************************************************/
@@ -251,7 +370,7 @@ void env_object_adbdsr_split::setSegmentDx(const uint32_t _voiceId, const uint32
 {
     /* access desired segment by segmentId, access dx in desired voice by voiceId, update by value */
 
-    m_segment[_segmentId].m_dx[_voiceId] = _value;                      // dx [0 ... 1] represents the transition time (infinite ... zero)
+    m_segment[_segmentId].m_dx[_voiceId] = _value;  // dx [0 ... 1] represents the transition time (infinite ... zero)
 }
 
 /*****************************************************************************/
@@ -297,8 +416,8 @@ void env_object_adbdsr_split::setSplitValue(const float _value)
 {
     /* two separate crossfade values are determined */
 
-    m_splitValues[0] = NlToolbox::Clipping::floatMax(0.f, _value);      // magnitude xfade (param, 1)
-    m_splitValues[1] = NlToolbox::Clipping::floatMax(0.f, -_value);     // timbre xfade (param, 1)
+    m_splitValues[0] = NlToolbox::Clipping::floatMax(0.f, _value);  // magnitude xfade (param, 1)
+    m_splitValues[1] = NlToolbox::Clipping::floatMax(0.f, -_value); // timbre xfade (param, 1)
 }
 
 /*****************************************************************************/
@@ -339,41 +458,36 @@ void env_object_adbdsr_split::setPeakLevel(const uint32_t _voiceId, const float
 void env_object_adbdsr_retrig::start(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
+    m_body.m_x[_voiceId] = m_segment[m_startIndex].m_dx[_voiceId];
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_startIndex].m_dx[_voiceId];
+    m_body.m_start_magnitude[_voiceId] = (1.f - m_retriggerHardness) * m_body.m_signal_magnitude[_voiceId];
     /* */
-    body->m_x = m_segment[m_startIndex].m_dx[_voiceId];
-    body->m_y = 1.f - m_segment[m_startIndex].m_dx[_voiceId];
-    body->m_start_magnitude = (1.f - m_retriggerHardness) * body->m_signal_magnitude;
-    /* */
-    body->m_state = m_segment[m_startIndex].m_state;
-    body->m_index = m_startIndex;
-    body->m_next = m_segment[m_startIndex].m_next;
+    m_body.m_state[_voiceId] = m_segment[m_startIndex].m_state;
+    m_body.m_index[_voiceId] = m_startIndex;
+    m_body.m_next[_voiceId] = m_segment[m_startIndex].m_next;
 }
 
 /* */
 void env_object_adbdsr_retrig::stop(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
-    /* */
-    body->m_x = m_segment[m_stopIndex].m_dx[_voiceId];
-    body->m_y = 1.f - m_segment[m_stopIndex].m_dx[_voiceId];
-    body->m_start_magnitude = body->m_signal_magnitude;
+    m_body.m_x[_voiceId] = m_segment[m_stopIndex].m_dx[_voiceId];
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_stopIndex].m_dx[_voiceId];
+    m_body.m_start_magnitude[_voiceId] = m_body.m_signal_magnitude[_voiceId];
     /* */
-    body->m_state = m_segment[m_stopIndex].m_state;
-    body->m_index = m_stopIndex;
-    body->m_next = m_segment[m_stopIndex].m_next;
+    m_body.m_state[_voiceId] = m_segment[m_stopIndex].m_state;
+    m_body.m_index[_voiceId] = m_stopIndex;
+    m_body.m_next[_voiceId] = m_segment[m_stopIndex].m_next;
 }
 
 /* */
 void env_object_adbdsr_retrig::tick(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
-    const uint32_t segment = body->m_index;
-    const float diff_magnitude = m_segment[segment].m_dest_magnitude[_voiceId] - body->m_start_magnitude;
+    const uint32_t segment = m_body.m_index[_voiceId];
+    const float diff_magnitude = m_segment[segment].m_dest_magnitude[_voiceId] - m_body.m_start_magnitude[_voiceId];
     /* */
-    switch(body->m_state)
+    switch(m_body.m_state[_voiceId])
     {
 
     case 0:     /* idle */
@@ -382,17 +496,17 @@ void env_object_adbdsr_retrig::tick(const uint32_t _voiceId)
 
     case 1:     /* linear rendering (decay1 phase) */
 
-        if(body->m_x < 1.f)
+        if(m_body.m_x[_voiceId] < 1.f)
         {
             /* */
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * body->m_x);
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * m_body.m_x[_voiceId]);
             /* */
-            body->m_x += m_segment[segment].m_dx[_voiceId];
+            m_body.m_x[_voiceId] += m_segment[segment].m_dx[_voiceId];
         }
         else
         {
             /* */
-            body->m_signal_magnitude = m_segment[segment].m_dest_magnitude[_voiceId];
+            m_body.m_signal_magnitude[_voiceId] = m_segment[segment].m_dest_magnitude[_voiceId];
             /* */
             nextSegment(_voiceId);
         }
@@ -400,33 +514,33 @@ void env_object_adbdsr_retrig::tick(const uint32_t _voiceId)
 
     case 2:     /* exponential, quasi-infinite rendering (decay2 phase) */
 
-        if(body->m_y > dsp_render_min)
+        if(m_body.m_y[_voiceId] > dsp_render_min)
         {
             /* */
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * (1.f - body->m_y));
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * (1.f - m_body.m_y[_voiceId]));
             /* */
-            body->m_y *= 1.f - m_segment[segment].m_dx[_voiceId];
+            m_body.m_y[_voiceId] *= 1.f - m_segment[segment].m_dx[_voiceId];
         }
         else
         {
             /* */
-            body->m_signal_magnitude = body->m_start_magnitude + diff_magnitude;
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + diff_magnitude;
         }
         break;
 
     case 3:     /* exponential, quasi-finite rendering (release phase) */
 
-        if(body->m_y > dsp_render_min)
+        if(m_body.m_y[_voiceId] > dsp_render_min)
         {
             /* */
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * (1.f - body->m_y));
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * (1.f - m_body.m_y[_voiceId]));
             /* */
-            body->m_y *= 1.f - m_segment[segment].m_dx[_voiceId];
+            m_body.m_y[_voiceId] *= 1.f - m_segment[segment].m_dx[_voiceId];
         }
         else
         {
             /* */
-            body->m_signal_magnitude = m_segment[segment].m_dest_magnitude[_voiceId];
+            m_body.m_signal_magnitude[_voiceId] = m_segment[segment].m_dest_magnitude[_voiceId];
             /* */
             nextSegment(_voiceId);
         }
@@ -434,22 +548,22 @@ void env_object_adbdsr_retrig::tick(const uint32_t _voiceId)
 
     case 4:     /* polynomial rendering (attack phase) */
 
-        if(body->m_x < 1.f)
+        if(m_body.m_x[_voiceId] < 1.f)
         {
             /* */
-            float x = NlToolbox::Curves::SquaredCurvature(body->m_x, m_segment[segment].m_curve);
+            float x = NlToolbox::Curves::SquaredCurvature(m_body.m_x[_voiceId], m_segment[segment].m_curve);
             x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);
             x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);
             x = NlToolbox::Curves::SquaredCurvature(x, m_segment[segment].m_curve);
             /* */
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * x);
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * x);
             /* */
-            body->m_x += m_segment[segment].m_dx[_voiceId];
+            m_body.m_x[_voiceId] += m_segment[segment].m_dx[_voiceId];
         }
         else
         {
             /* */
-            body->m_signal_magnitude = m_segment[segment].m_dest_magnitude[_voiceId];
+            m_body.m_signal_magnitude[_voiceId] = m_segment[segment].m_dest_magnitude[_voiceId];
             /* */
             nextSegment(_voiceId);
         }
@@ -457,19 +571,23 @@ void env_object_adbdsr_retrig::tick(const uint32_t _voiceId)
     }
 }
 
+/* */
+void env_object_adbdsr_retrig::tickAll(const uint32_t _voiceMask)
+{
+    tickLanes(m_body, m_segment, _voiceMask, 2, 3);                     // decay2 (2) stays, release (3) finishes
+}
+
 /* */
 void env_object_adbdsr_retrig::nextSegment(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
-    /* */
-    body->m_x = m_segment[body->m_next].m_dx[_voiceId];
-    body->m_y = 1.f - m_segment[body->m_next].m_dx[_voiceId];
-    body->m_start_magnitude = body->m_signal_magnitude;
+    m_body.m_x[_voiceId] = m_segment[m_body.m_next[_voiceId]].m_dx[_voiceId];
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_body.m_next[_voiceId]].m_dx[_voiceId];
+    m_body.m_start_magnitude[_voiceId] = m_body.m_signal_magnitude[_voiceId];
     /* */
-    body->m_state = m_segment[body->m_next].m_state;
-    body->m_index = body->m_next;
-    body->m_next = m_segment[body->m_index].m_next;
+    m_body.m_state[_voiceId] = m_segment[m_body.m_next[_voiceId]].m_state;
+    m_body.m_index[_voiceId] = m_body.m_next[_voiceId];
+    m_body.m_next[_voiceId] = m_segment[m_body.m_index[_voiceId]].m_next;
 }
 
 /* */
@@ -505,41 +623,36 @@ void env_object_adbdsr_retrig::setRetriggerHardness(const float _value)
 void env_object_gate::start(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
+    m_body.m_x[_voiceId] = m_segment[m_startIndex].m_dx[_voiceId];
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_startIndex].m_dx[_voiceId];
+    m_body.m_start_magnitude[_voiceId] = m_body.m_signal_magnitude[_voiceId];
     /* */
-    body->m_x = m_segment[m_startIndex].m_dx[_voiceId];
-    body->m_y = 1.f - m_segment[m_startIndex].m_dx[_voiceId];
-    body->m_start_magnitude = body->m_signal_magnitude;
-    /* */
-    body->m_state = m_segment[m_startIndex].m_state;
-    body->m_index = m_startIndex;
-    body->m_next = m_segment[m_startIndex].m_next;
+    m_body.m_state[_voiceId] = m_segment[m_startIndex].m_state;
+    m_body.m_index[_voiceId] = m_startIndex;
+    m_body.m_next[_voiceId] = m_segment[m_startIndex].m_next;
 }
 
 /* */
 void env_object_gate::stop(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
-    /* */
-    body->m_x = m_segment[m_stopIndex].m_dx[_voiceId];
-    body->m_y = 1.f - m_segment[m_stopIndex].m_dx[_voiceId];
-    body->m_start_magnitude = body->m_signal_magnitude;
+    m_body.m_x[_voiceId] = m_segment[m_stopIndex].m_dx[_voiceId];
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_stopIndex].m_dx[_voiceId];
+    m_body.m_start_magnitude[_voiceId] = m_body.m_signal_magnitude[_voiceId];
     /* */
-    body->m_state = m_segment[m_stopIndex].m_state;
-    body->m_index = m_stopIndex;
-    body->m_next = m_segment[m_stopIndex].m_next;
+    m_body.m_state[_voiceId] = m_segment[m_stopIndex].m_state;
+    m_body.m_index[_voiceId] = m_stopIndex;
+    m_body.m_next[_voiceId] = m_segment[m_stopIndex].m_next;
 }
 
 /* */
 void env_object_gate::tick(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
-    const uint32_t segment = body->m_index;
-    const float diff_magnitude = m_segment[segment].m_dest_magnitude[_voiceId] - body->m_start_magnitude;
+    const uint32_t segment = m_body.m_index[_voiceId];
+    const float diff_magnitude = m_segment[segment].m_dest_magnitude[_voiceId] - m_body.m_start_magnitude[_voiceId];
     /* */
-    switch(body->m_state)
+    switch(m_body.m_state[_voiceId])
     {
 
     case 0:     /* idle */
@@ -548,17 +661,17 @@ void env_object_gate::tick(const uint32_t _voiceId)
 
     case 1:     /* linear rendering (attack phase) */
 
-        if(body->m_x < 1.f)
+        if(m_body.m_x[_voiceId] < 1.f)
         {
             /* */
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * body->m_x);
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * m_body.m_x[_voiceId]);
             /* */
-            body->m_x += m_segment[segment].m_dx[_voiceId];
+            m_body.m_x[_voiceId] += m_segment[segment].m_dx[_voiceId];
         }
         else
         {
             /* */
-            body->m_signal_magnitude = m_segment[segment].m_dest_magnitude[_voiceId];
+            m_body.m_signal_magnitude[_voiceId] = m_segment[segment].m_dest_magnitude[_voiceId];
             /* */
             nextSegment(_voiceId);
         }
@@ -566,17 +679,17 @@ void env_object_gate::tick(const uint32_t _voiceId)
 
     case 2:     /* exponential, quasi-finite rendering (release phase) */
 
-        if(body->m_y > dsp_render_min)
+        if(m_body.m_y[_voiceId] > dsp_render_min)
         {
             /* */
-            body->m_signal_magnitude = body->m_start_magnitude + (diff_magnitude * (1.f - body->m_y));
+            m_body.m_signal_magnitude[_voiceId] = m_body.m_start_magnitude[_voiceId] + (diff_magnitude * (1.f - m_body.m_y[_voiceId]));
             /* */
-            body->m_y *= 1.f - m_segment[segment].m_dx[_voiceId];
+            m_body.m_y[_voiceId] *= 1.f - m_segment[segment].m_dx[_voiceId];
         }
         else
         {
             /* */
-            body->m_signal_magnitude = m_segment[segment].m_dest_magnitude[_voiceId];
+            m_body.m_signal_magnitude[_voiceId] = m_segment[segment].m_dest_magnitude[_voiceId];
             /* */
             nextSegment(_voiceId);
         }
@@ -584,19 +697,23 @@ void env_object_gate::tick(const uint32_t _voiceId)
     }
 }
 
+/* */
+void env_object_gate::tickAll(const uint32_t _voiceMask)
+{
+    tickLanes(m_body, m_segment, _voiceMask, -1, 2);                    // release (2) finishes
+}
+
 /* */
 void env_object_gate::nextSegment(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
-    /* */
-    body->m_x = m_segment[body->m_next].m_dx[_voiceId];
-    body->m_y = 1.f - m_segment[body->m_next].m_dx[_voiceId];
-    body->m_start_magnitude = body->m_signal_magnitude;
+    m_body.m_x[_voiceId] = m_segment[m_body.m_next[_voiceId]].m_dx[_voiceId];
+    m_body.m_y[_voiceId] = 1.f - m_segment[m_body.m_next[_voiceId]].m_dx[_voiceId];
+    m_body.m_start_magnitude[_voiceId] = m_body.m_signal_magnitude[_voiceId];
     /* */
-    body->m_state = m_segment[body->m_next].m_state;
-    body->m_index = body->m_next;
-    body->m_next = m_segment[body->m_index].m_next;
+    m_body.m_state[_voiceId] = m_segment[m_body.m_next[_voiceId]].m_state;
+    m_body.m_index[_voiceId] = m_body.m_next[_voiceId];
+    m_body.m_next[_voiceId] = m_segment[m_body.m_index[_voiceId]].m_next;
 }
 
 /* */
@@ -619,7 +736,7 @@ void env_object_gate::setSegmentDest(const uint32_t _voiceId, const uint32_t _se
 void env_object_decay::start(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
+    env_body_single_mono* body = &m_body[_voiceId];
     /* */
     body->m_x = m_segment[m_startIndex].m_dx[_voiceId];
     body->m_y = 1.f - m_segment[m_startIndex].m_dx[_voiceId];
@@ -634,7 +751,7 @@ void env_object_decay::start(const uint32_t _voiceId)
 void env_object_decay::tick(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
+    env_body_single_mono* body = &m_body[_voiceId];
     const uint32_t segment = body->m_index;
     const float diff_magnitude = m_segment[segment].m_dest_magnitude[_voiceId] - body->m_start_magnitude;
     /* */
@@ -687,7 +804,7 @@ void env_object_decay::tick(const uint32_t _voiceId)
 void env_object_decay::nextSegment(const uint32_t _voiceId)
 {
     /* */
-    env_body_single* body = &m_body[_voiceId];
+    env_body_single_mono* body = &m_body[_voiceId];
     /* */
     body->m_x = m_segment[body->m_next].m_dx[_voiceId];
     body->m_y = 1.f - m_segment[body->m_next].m_dx[_voiceId];
@@ -782,3 +899,13 @@ void env_engine2::tickPoly(const uint32_t _voiceId)
     m_env_c.tick(_voiceId);
     m_env_g.tick(_voiceId);
 }
+
+/* */
+void env_engine2::tickPolyAll(const uint32_t _voiceMask)
+{
+    /* */
+    m_env_a.tickAll(_voiceMask);
+    m_env_b.tickAll(_voiceMask);
+    m_env_c.tickAll(_voiceMask);
+    m_env_g.tickAll(_voiceMask);
+}
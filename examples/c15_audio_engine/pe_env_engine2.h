@@ -17,6 +17,7 @@
 #include <stdint.h>
 #include "nltoolbox.h"
 #include "pe_defines_config.h"
+#include "ae_simd.h"
 
 /********************************************** Initial Segment Data **********************************************/
 
@@ -52,7 +53,7 @@ const uint32_t envelope2_definition[sig_number_of_env_types][sig_number_of_env_s
 
 /********************************************** Envelope Segment Structures **********************************************/
 
-/* Single Segment Object (handling only magnitude signal) */
+/* Single Segment Object (handling only magnitude signal), voice data in lanes (see tickAll()) */
 
 struct env_segment_single
 {
@@ -63,8 +64,8 @@ struct env_segment_single
 
     /* local rendering variables */
 
-    float m_dx[dsp_number_of_voices] = {};                  // transition times as incremental values [0 ... 1] (infinite ... zero)
-    float m_dest_magnitude[dsp_number_of_voices] = {};      // transition destinations for the magnitude signal
+    float m_dx[dsp_simd_voices] = {};                       // transition times as incremental values [0 ... 1] (infinite ... zero)
+    float m_dest_magnitude[dsp_simd_voices] = {};           // transition destinations for the magnitude signal
     float m_curve = 0.f;                                    // curvature (of the attack segment)
 };
 
@@ -89,37 +90,55 @@ struct env_segment_split : env_segment_single
 {
     /* additional local rendering variables */
 
-    float m_dest_timbre[dsp_number_of_voices] = {};         // additional transition destinations for the timbre signal
+    float m_dest_timbre[dsp_simd_voices] = {};              // additional transition destinations for the timbre signal
 };
 
 /********************************************** Envelope Rendering Body Structures **********************************************/
 
-/* Single Body Object (rendering only magnitude signal) */
+/* Single Body Object (rendering only magnitude signal), one lane per voice */
 
 struct env_body_single
 {
     /* local state variables */
 
-    uint32_t m_state = 0;                                   // current rendering state and curve type
-    uint32_t m_next = 0;                                    // subsequent segment index (following segment)
-    uint32_t m_index = 0;                                   // current segment index
+    uint32_t m_state[dsp_simd_voices] = {};                 // current rendering state and curve type
+    uint32_t m_next[dsp_simd_voices] = {};                  // subsequent segment index (following segment)
+    uint32_t m_index[dsp_simd_voices] = {};                 // current segment index
 
     /* local rendering variables */
 
-    float m_x = 0.f;                                        // transition curve progress (linear and polynomial curves)
-    float m_y = 0.f;                                        // transition curve progress (exponential curves)
-    float m_start_magnitude = 0.f;                          // transition signal startpoint (magnitude)
-    float m_signal_magnitude = 0.f;                         // rendering signal (magnitude)
+    float m_x[dsp_simd_voices] = {};                        // transition curve progress (linear and polynomial curves)
+    float m_y[dsp_simd_voices] = {};                        // transition curve progress (exponential curves)
+    float m_start_magnitude[dsp_simd_voices] = {};          // transition signal startpoint (magnitude)
+    float m_signal_magnitude[dsp_simd_voices] = {};         // rendering signal (magnitude)
 };
 
-/* Split Body Object (rendering magnitude and timbre signals) */
+/* Split Body Object (rendering magnitude and timbre signals), one lane per voice */
 
 struct env_body_split : env_body_single
 {
     /* additional local rendering variables */
 
-    float m_start_timbre = 0.f;                             // transition signal startpoint (timbre)
-    float m_signal_timbre = 0.f;                            // rendering signal (timbre)
+    float m_start_timbre[dsp_simd_voices] = {};             // transition signal startpoint (timbre)
+    float m_signal_timbre[dsp_simd_voices] = {};            // rendering signal (timbre)
+};
+
+/* Single Monophonic Body Object (rendering only magnitude signal) */
+
+struct env_body_single_mono
+{
+    /* local state variables */
+
+    uint32_t m_state = 0;                                   // current rendering state and curve type
+    uint32_t m_next = 0;                                    // subsequent segment index (following segment)
+    uint32_t m_index = 0;                                   // current segment index
+
+    /* local rendering variables */
+
+    float m_x = 0.f;                                        // transition curve progress (linear and polynomial curves)
+    float m_y = 0.f;                                        // transition curve progress (exponential curves)
+    float m_start_magnitude = 0.f;                          // transition signal startpoint (magnitude)
+    float m_signal_magnitude = 0.f;                         // rendering signal (magnitude)
 };
 
 /********************************************** Envelope Object Structures **********************************************/
@@ -140,7 +159,7 @@ struct env_object_adbdsr_split
 
     /* local data structures: rendering body, segment array */
 
-    env_body_split m_body[dsp_number_of_voices];
+    env_body_split m_body;
     env_segment_split m_segment[sig_number_of_env_segments + 1];
 
     /* object functionality */
@@ -148,6 +167,7 @@ struct env_object_adbdsr_split
     void start(const uint32_t _voiceId);
     void stop(const uint32_t _voiceId);
     void tick(const uint32_t _voiceId);
+    void tickAll(const uint32_t _voiceMask);
     void nextSegment(const uint32_t _voiceId);
     void setSegmentDx(const uint32_t _voiceId, const uint32_t _segmentId, const float _value);
     void setSegmentDest(const uint32_t _voiceId, const uint32_t _segmentId, const bool _splitMode, const float _value);
@@ -171,7 +191,7 @@ struct env_object_adbdsr_retrig
 
     /* local data structures: rendering body, segment array */
 
-    env_body_single m_body[dsp_number_of_voices];
+    env_body_single m_body;
     env_segment_single m_segment[sig_number_of_env_segments + 1];
 
     /* object functionality */
@@ -179,6 +199,7 @@ struct env_object_adbdsr_retrig
     void start(const uint32_t _voiceId);
     void stop(const uint32_t _voiceId);
     void tick(const uint32_t _voiceId);
+    void tickAll(const uint32_t _voiceMask);
     void nextSegment(const uint32_t _voiceId);
     void setSegmentDx(const uint32_t _voiceId, const uint32_t _segmentId, const float _value);
     void setSegmentDest(const uint32_t _voiceId, const uint32_t _segmentId, const float _value);
@@ -197,7 +218,7 @@ struct env_object_gate
 
     /* local data structures: rendering body, segment array */
 
-    env_body_single m_body[dsp_number_of_voices];
+    env_body_single m_body;
     env_segment_single m_segment[sig_number_of_env_segments + 1];
 
     /* object functionality */
@@ -205,6 +226,7 @@ struct env_object_gate
     void start(const uint32_t _voiceId);
     void stop(const uint32_t _voiceId);
     void tick(const uint32_t _voiceId);
+    void tickAll(const uint32_t _voiceMask);
     void nextSegment(const uint32_t _voiceId);
     void setSegmentDx(const uint32_t _voiceId, const uint32_t _segmentId, const float _value);
     void setSegmentDest(const uint32_t _voiceId, const uint32_t _segmentId, const float _value);
@@ -220,7 +242,7 @@ struct env_object_decay
 
     /* local data structures: rendering body, segment array */
 
-    env_body_single m_body[1];
+    env_body_single_mono m_body[1];
     env_segment_single_mono m_segment[sig_number_of_env_segments + 1];
 
     /* object functionality */
@@ -253,5 +275,6 @@ struct env_engine2
     /* object functionality (rendering) */
 
     void tickMono();                                                // rendering function for monophonic Envelopes
-    void tickPoly(const uint32_t _voiceId);                         // rendering function for polyphonic Envelopes
+    void tickPoly(const uint32_t _voiceId);                         // rendering function for polyphonic Envelopes (single voice reference)
+    void tickPolyAll(const uint32_t _voiceMask);                    // rendering function for polyphonic Envelopes (all voices of the mask, in lanes)
 };
@@ -1,114 +1,89 @@
 #include <math.h>
 #include "pe_exponentiator.h"
+#include "ae_simd.h"
 
-/* proper init */
-void exponentiator::init()
+/* table interpolation */
+
+float exponentiator::interpolate(const float *_table, float _from, float _to, float _value)
 {
-    /* helper variables for initialization */
-    uint32_t i;                                     // array index variable
-    float exp;                                      // exponent variable
-    /* construct linear pitch table */              // note: table construction loop goes up to range element (as tables are set to be range+1 in size)
-    for(i = 0; i <= dsp_expon_lin_pitch_range; i++)
-    {
-        /* determine exponent of equation */
-        exp = (static_cast<float>(i) + m_linear_pitch_from - m_freqExponent_offset) * m_scaleFreqExponent;
-        /* determine power (base ^ exponent) */
-        m_linear_pitch_table[i] = pow(m_freqBase, exp);
-    }
-    /* construct oscillator pitch table */
-    m_oscillator_pitch_table[0] = 0;                // set first table element to zero
-    /* construct hyperfloor part of oscillator pitch table (second till 19th element) */
-    for(i = 1; i < 20; i++)
-    {
-        /* determine exponent of equation */
-        exp = (hyperfloor(static_cast<float>(i) + m_oscillator_pitch_from) - m_freqExponent_offset) * m_scaleFreqExponent;
-        /* determine power (base ^ exponent) */
-        m_oscillator_pitch_table[i] = pow(m_freqBase, exp);
-    }
-    /* construct remaining (linear) part of oscillator pitch table */
-    for(i = 20; i <= dsp_expon_osc_pitch_range; i++)
-    {
-        /* determine exponent of equation */
-        exp = (static_cast<float>(i) + m_oscillator_pitch_from - m_freqExponent_offset) * m_scaleFreqExponent;
-        /* determine power (base ^ exponent) */
-        m_oscillator_pitch_table[i] = pow(m_freqBase, exp);
-    }
-    /* construct level table */
-    m_level_table[0] = 0;                           // set first table element to zero
-    for(i = 1; i <= dsp_expon_level_range; i++)
+    /* clip and translate value (clipping ensures that table access does not exceed predefined ranges) */
+    _value = NlToolbox::Clipping::floatMax(_from, NlToolbox::Clipping::floatMin(_to, _value)) - _from;
+    /* convert floating point table position into integer and fractional parts */
+    const uint32_t step = static_cast<int>(floor(_value));
+    const float fine = _value - static_cast<float>(step);
+    /* linear interpolation of two consecutive table values by linear crossfade */
+    return(((1 - fine) * _table[step]) + (fine * _table[step + 1]));
+}
+
+/* the same operations as above, dsp_simd_lanes values at once (table positions are positive, so truncation equals floor()) */
+static inline NlToolbox::Simd::vfloat interpolateLanes(const float *_table, float _from, float _to, NlToolbox::Simd::vfloat _value)
+{
+    using namespace NlToolbox::Simd;
+    _value = select(_to < _value, splat(_to), _value);
+    _value = select(_from > _value, splat(_from), _value) - _from;
+    const vint step = toInt(_value);
+    const vfloat fine = _value - toFloat(step);
+    return ((1.f - fine) * gather(_table, step)) + (fine * gather(_table, step + 1));
+}
+
+void exponentiator::interpolate(const float *_table, float _from, float _to, const float *_in, float *_out, const uint32_t _count)
+{
+    using namespace NlToolbox::Simd;
+    uint32_t i = 0;
+    for(; i + dsp_simd_lanes <= _count; i += dsp_simd_lanes)
     {
-        /* determine exponent of equation */
-        exp = (static_cast<float>(i) + m_level_from) * m_scaleGainExponent;
-        /* determine power (base ^ exponent) */
-        m_level_table[i] = pow(m_gainBase, exp);
+        store(&_out[i], interpolateLanes(_table, _from, _to, load(&_in[i])));
     }
-    /* construct time table */
-    m_time_table[0] = 0;                            // set first table element to zero
-    for(i = 1; i <= dsp_expon_time_range; i++)
+    /* remaining values (padded to a full vector) */
+    if(i < _count)
     {
-        /* determine exponent of equation */
-        exp = (static_cast<float>(i) + m_time_from) * m_scaleGainExponent;
-        /* determine power (base ^ exponent) */
-        m_time_table[i] = pow(m_gainBase, exp);
+        float lanes[dsp_simd_lanes] = {};
+        std::memcpy(lanes, &_in[i], (_count - i) * sizeof(float));
+        store(lanes, interpolateLanes(_table, _from, _to, load(lanes)));
+        std::memcpy(&_out[i], lanes, (_count - i) * sizeof(float));
     }
 }
 
-/* helper methods */
-float exponentiator::hyperfloor(float _value)
+/* main, run-time conversion methods */
+
+float exponentiator::eval_lin_pitch(float _value)
 {
-    /* the hyperbolic floor function of oscillator pitches */
-    return((m_hyperfloor[0] * _value) / m_hyperfloor[1] + _value);
+    return interpolate(m_tables.m_linear_pitch_table, m_linear_pitch_from, m_linear_pitch_to, _value);
 }
 
-float exponentiator::clip(float _min, float _max, float _value)
+float exponentiator::eval_osc_pitch(float _value)
 {
-    /* clipping of values to ensure that table access does not exceed predefined ranges */
-    return NlToolbox::Clipping::floatMax(_min, NlToolbox::Clipping::floatMin(_max, _value));
+    return interpolate(m_tables.m_oscillator_pitch_table, m_oscillator_pitch_from, m_oscillator_pitch_to, _value);
 }
 
-void exponentiator::setTablePos(float _value)
+float exponentiator::eval_level(float _value)
 {
-    /* convert floating point table position into integer and fractional parts */
-    m_position_step = static_cast<int>(floor(_value));
-    m_position_fine = _value - static_cast<float>(m_position_step);
+    return interpolate(m_tables.m_level_table, m_level_from, m_level_to, _value);
 }
 
-float exponentiator::getInterpolated(float _fade, float _first, float _second)
+float exponentiator::eval_time(float _value)
 {
-    /* linear interpolation of two consecutive table values (first, second) by linear crossfade (fade) */
-    return(((1 - _fade) * _first) + (_fade * _second));
+    return interpolate(m_tables.m_time_table, m_time_from, m_time_to, _value);
 }
 
-/* main, run-time conversion methods */
+/* batch conversion methods */
 
-float exponentiator::eval_lin_pitch(float _value)
+void exponentiator::eval_lin_pitch(const float *_in, float *_out, const uint32_t _count)
 {
-    /* clip and translate value, update table position */
-    setTablePos(clip(m_linear_pitch_from, m_linear_pitch_to, _value) - m_linear_pitch_from);
-    /* perform interpolation and return result */
-    return getInterpolated(m_position_fine, m_linear_pitch_table[m_position_step], m_linear_pitch_table[m_position_step + 1]);
+    interpolate(m_tables.m_linear_pitch_table, m_linear_pitch_from, m_linear_pitch_to, _in, _out, _count);
 }
 
-float exponentiator::eval_osc_pitch(float _value)
+void exponentiator::eval_osc_pitch(const float *_in, float *_out, const uint32_t _count)
 {
-    /* clip and translate value, update table position */
-    setTablePos(clip(m_oscillator_pitch_from, m_oscillator_pitch_to, _value) - m_oscillator_pitch_from);
-    /* perform interpolation and return result */
-    return getInterpolated(m_position_fine, m_oscillator_pitch_table[m_position_step], m_oscillator_pitch_table[m_position_step + 1]);
+    interpolate(m_tables.m_oscillator_pitch_table, m_oscillator_pitch_from, m_oscillator_pitch_to, _in, _out, _count);
 }
 
-float exponentiator::eval_level(float _value)
+void exponentiator::eval_level(const float *_in, float *_out, const uint32_t _count)
 {
-    /* clip and translate value, update table position */
-    setTablePos(clip(m_level_from, m_level_to, _value) - m_level_from);
-    /* perform interpolation and return result */
-    return getInterpolated(m_position_fine, m_level_table[m_position_step], m_level_table[m_position_step + 1]);
+    interpolate(m_tables.m_level_table, m_level_from, m_level_to, _in, _out, _count);
 }
 
-float exponentiator::eval_time(float _value)
+void exponentiator::eval_time(const float *_in, float *_out, const uint32_t _count)
 {
-    /* clip and translate value, update table position */
-    setTablePos(clip(m_time_from, m_time_to, _value) - m_time_from);
-    /* perform interpolation and return result */
-    return getInterpolated(m_position_fine, m_time_table[m_position_step], m_time_table[m_position_step + 1]);
+    interpolate(m_tables.m_time_table, m_time_from, m_time_to, _in, _out, _count);
 }
@@ -3,7 +3,7 @@
     @date       2018-03-16
     @version    1.0
     @author     Matthias Seeber
-    @brief      exponential converter based on initialized tables
+    @brief      exponential converter based on compile time generated tables
                 (used for TCD scaling mechanism)
     @todo
 *******************************************************************************/
@@ -14,45 +14,133 @@
 #include "pe_defines_config.h"
 #include "nltoolbox.h"
 
+/* conversion tables, generated at compile time and shared by all exponentiator instances */
+struct exponentiator_tables
+{
+    /* constants (table offsets, exponent scalings, natural logarithms of the bases, hyperbolic floor parameters) */
+    static constexpr float m_freqExponent_offset = 69;                  // pitch reference offset (where resulting frequency factor equals 1)
+    static constexpr float m_scaleFreqExponent = 1.f / 12;              // exponent normalization for pitch conversion
+    static constexpr float m_scaleGainExponent = 1.f / 20;              // exponent normalization for level and time conversion
+    static constexpr double m_logFreqBase = 0.693147180559945309417;    // ln(2), base for pitch to frequency conversion
+    static constexpr double m_logGainBase = 2.302585092994045684018;    // ln(10), base for level to amplitude and time conversion
+    static constexpr float m_hyperfloor[2] = {(300.f / 13), (280.f / 13)}; // two parameters needed to generate the hyperbolic floor function of oscillator pitches
+    /* conversion tables */                                             // (note: the additional table elements (size + 2) keep the interpolation of the
+                                                                        // highest table position inside the table, the last element is repeated)
+    float m_linear_pitch_table[dsp_expon_lin_pitch_range + 2] = {};     // linear pitch table: [-150, 150] semitones
+    float m_oscillator_pitch_table[dsp_expon_osc_pitch_range + 2] = {}; // nonlinear pitch table for oscillators: [-20, 130] semitones
+    float m_level_table[dsp_expon_level_range + 2] = {};                // level conversion table: [-300, 100] decibel (first element is zero)
+    float m_time_table[dsp_expon_time_range + 2] = {};                  // time conversion table: [-20, 90] decibel (first element is zero)
+    /* construction of all four conversion tables */
+    constexpr exponentiator_tables();
+    /* hyperbolic osc pitch function (nonlinear pitch floor) */
+    static constexpr float hyperfloor(float _value);
+    /* power function (base ^ exponent), evaluated in double precision and rounded once, like pow() on floats */
+    static constexpr float power(double _logBase, float _exponent);
+};
+
+/* conversion tables: construction (the exponents are formed in float precision, as before) */
+constexpr exponentiator_tables::exponentiator_tables()
+{
+    /* helper variables for construction */
+    uint32_t i = 0;                                 // array index variable
+    float exp = 0.f;                                // exponent variable
+    /* construct linear pitch table */              // note: table construction loop goes up to range element (the last element is repeated)
+    for(i = 0; i <= dsp_expon_lin_pitch_range; i++)
+    {
+        exp = (static_cast<float>(i) + dsp_expon_lin_pitch_from - m_freqExponent_offset) * m_scaleFreqExponent;
+        m_linear_pitch_table[i] = power(m_logFreqBase, exp);
+    }
+    m_linear_pitch_table[i] = m_linear_pitch_table[i - 1];
+    /* construct oscillator pitch table */
+    m_oscillator_pitch_table[0] = 0;                // set first table element to zero
+    /* construct hyperfloor part of oscillator pitch table (second till 19th element) */
+    for(i = 1; i < 20; i++)
+    {
+        exp = (hyperfloor(static_cast<float>(i) + dsp_expon_osc_pitch_from) - m_freqExponent_offset) * m_scaleFreqExponent;
+        m_oscillator_pitch_table[i] = power(m_logFreqBase, exp);
+    }
+    /* construct remaining (linear) part of oscillator pitch table */
+    for(i = 20; i <= dsp_expon_osc_pitch_range; i++)
+    {
+        exp = (static_cast<float>(i) + dsp_expon_osc_pitch_from - m_freqExponent_offset) * m_scaleFreqExponent;
+        m_oscillator_pitch_table[i] = power(m_logFreqBase, exp);
+    }
+    m_oscillator_pitch_table[i] = m_oscillator_pitch_table[i - 1];
+    /* construct level table */
+    m_level_table[0] = 0;                           // set first table element to zero
+    for(i = 1; i <= dsp_expon_level_range; i++)
+    {
+        exp = (static_cast<float>(i) + dsp_expon_level_from) * m_scaleGainExponent;
+        m_level_table[i] = power(m_logGainBase, exp);
+    }
+    m_level_table[i] = m_level_table[i - 1];
+    /* construct time table */
+    m_time_table[0] = 0;                            // set first table element to zero
+    for(i = 1; i <= dsp_expon_time_range; i++)
+    {
+        exp = (static_cast<float>(i) + dsp_expon_time_from) * m_scaleGainExponent;
+        m_time_table[i] = power(m_logGainBase, exp);
+    }
+    m_time_table[i] = m_time_table[i - 1];
+}
+
+constexpr float exponentiator_tables::hyperfloor(float _value)
+{
+    /* the hyperbolic floor function of oscillator pitches */
+    return((m_hyperfloor[0] * _value) / m_hyperfloor[1] + _value);
+}
+
+constexpr float exponentiator_tables::power(double _logBase, float _exponent)
+{
+    /* e ^ x, x = ln(base) * exponent, reduced to 2 ^ k * e ^ r (|r| <= ln(2) / 2) */
+    const double ln2_hi = 0.693147180369123816490;      // ln(2), split into an upper part (k * ln2_hi is exact)
+    const double ln2_lo = 1.90821492927058770002e-10;   // and the remainder
+    const double x = _logBase * static_cast<double>(_exponent);
+    const int32_t k = static_cast<int32_t>(x * 1.44269504088896340736 + (x < 0.0 ? -0.5 : 0.5));
+    const double r = (x - (k * ln2_hi)) - (k * ln2_lo);
+    /* taylor series of e ^ r */
+    double term = 1.0, sum = 1.0;
+    for(int32_t n = 1; n < 24; n++)
+    {
+        term *= r / n;
+        sum += term;
+    }
+    /* scale by 2 ^ k */
+    for(int32_t n = 0; n < k; n++)
+    {
+        sum *= 2.0;
+    }
+    for(int32_t n = 0; n > k; n--)
+    {
+        sum *= 0.5;
+    }
+    return static_cast<float>(sum);
+}
+
 struct exponentiator
 {
-    /* table position variables */
-    uint32_t m_position_step;
-    float m_position_fine;
-    /* constants (table offsets, bases, exponent scalings, hyperbolic floor parameters) */
-    const float m_freqExponent_offset = 69;                             // pitch reference offset (where resulting frequency factor equals 1)
-    const float m_freqBase = 2;                                         // base for pitch to frequency conversion
-    const float m_scaleFreqExponent = 1.f / 12;                         // exponent normalization for pitch conversion
-    const float m_gainBase = 10;                                        // base for level to amplitude and time conversion
-    const float m_scaleGainExponent = 1.f / 20;                         // exponent normalization for level and time conversion
-    const float m_hyperfloor[2] = {(300.f / 13), (280.f / 13)};         // two parameters needed to generate the hyperbolic floor function of oscillator pitches
+    /* the shared conversion tables */
+    static constexpr exponentiator_tables m_tables = exponentiator_tables();
     /* constant input value ranges for (clipped) table access */        // (range values provided by pe_defines_config.h)
-    const float m_linear_pitch_from = dsp_expon_lin_pitch_from;
-    const float m_linear_pitch_to = dsp_expon_lin_pitch_range + dsp_expon_lin_pitch_from;
-    const float m_oscillator_pitch_from = dsp_expon_osc_pitch_from;
-    const float m_oscillator_pitch_to = dsp_expon_osc_pitch_range + dsp_expon_osc_pitch_from;
-    const float m_level_from = dsp_expon_level_from;
-    const float m_level_to = dsp_expon_level_range + dsp_expon_level_from;
-    const float m_time_from = dsp_expon_time_from;
-    const float m_time_to = dsp_expon_time_range + dsp_expon_time_from;
-    /* conversion tables (constructed on initialization) */             // (note: the additional table element (size + 1) prevents interpolation issues)
-    float m_linear_pitch_table[dsp_expon_lin_pitch_range + 1];          // linear pitch table: [-150, 150] semitones
-    float m_oscillator_pitch_table[dsp_expon_osc_pitch_range + 1];      // nonlinear pitch table for oscillators: [-20, 130] semitones
-    float m_level_table[dsp_expon_level_range + 1];                     // level conversion table: [-300, 100] decibel (first element is zero)
-    float m_time_table[dsp_expon_time_range + 1];                       // time conversion table: [-20, 90] decibel (first element is zero)
-    /* proper init */
-    void init();                                                        // perform construction of all four conversion tables
-    /* hyperbolic osc pitch function (nonlinear pitch floor) */
-    float hyperfloor(float _value);
-    /* table position clipping */
-    float clip(float _min, float _max, float _value);                   // return clipped value according to min and max parameters
-    /* update (clipped) table position */
-    void setTablePos(float _value);                                     // transform a valid (clipped) table position into integer and fractional parts
-    /* table interpolation */
-    float getInterpolated(float _fade, float _first, float _second);    // perform linear interpolation of two values (cross-fade value provided)
-    /* run-time conversion methods (using table interpolation) */
-    float eval_lin_pitch(float _value);                                 // linear pitch conversion (into frequency factor - multiples of 440 Hz - or different reference)
-    float eval_osc_pitch(float _value);                                 // oscillator pitch conversion (into frequency factor)
-    float eval_level(float _value);                                     // gain/level conversion (into amplitude factor)
-    float eval_time(float _value);                                      // time conversion (into milliseconds)
+    static constexpr float m_linear_pitch_from = dsp_expon_lin_pitch_from;
+    static constexpr float m_linear_pitch_to = dsp_expon_lin_pitch_range + dsp_expon_lin_pitch_from;
+    static constexpr float m_oscillator_pitch_from = dsp_expon_osc_pitch_from;
+    static constexpr float m_oscillator_pitch_to = dsp_expon_osc_pitch_range + dsp_expon_osc_pitch_from;
+    static constexpr float m_level_from = dsp_expon_level_from;
+    static constexpr float m_level_to = dsp_expon_level_range + dsp_expon_level_from;
+    static constexpr float m_time_from = dsp_expon_time_from;
+    static constexpr float m_time_to = dsp_expon_time_range + dsp_expon_time_from;
+    /* run-time conversion methods (using table interpolation, stateless and thread-safe) */
+    static float eval_lin_pitch(float _value);                          // linear pitch conversion (into frequency factor - multiples of 440 Hz - or different reference)
+    static float eval_osc_pitch(float _value);                          // oscillator pitch conversion (into frequency factor)
+    static float eval_level(float _value);                              // gain/level conversion (into amplitude factor)
+    static float eval_time(float _value);                               // time conversion (into milliseconds)
+    /* batch conversion methods (_count values, SIMD interpolation, _in and _out may be the same array) */
+    static void eval_lin_pitch(const float *_in, float *_out, const uint32_t _count);
+    static void eval_osc_pitch(const float *_in, float *_out, const uint32_t _count);
+    static void eval_level(const float *_in, float *_out, const uint32_t _count);
+    static void eval_time(const float *_in, float *_out, const uint32_t _count);
+    /* table interpolation of a clipped value */
+    static float interpolate(const float *_table, float _from, float _to, float _value);
+    static void interpolate(const float *_table, float _from, float _to, const float *_in, float *_out, const uint32_t _count);
 };
@@ -7,6 +7,7 @@
 *******************************************************************************/
 
 #include "reverb.h"
+#include <cstring>
 
 /******************************************************************************/
 /** Reverb Default Constructor
@@ -67,10 +68,8 @@ Reverb::Reverb()
     mHPCoeff_1 = 1.f / (mHPOmega + 1.f);
     mHPCoeff_2 = mHPOmega - 1.f;
 
-    mLPStateVar_L = 0.f;
-    mLPStateVar_R = 0.f;
-    mHPStateVar_L = 0.f;
-    mHPStateVar_R = 0.f;
+    mLPStateVar = ReverbLanes{};
+    mHPStateVar = ReverbLanes{};
 
     //******************************** Depth *********************************//
     mDepthSize = 311.f + 0.75f * -200.f;
@@ -87,55 +86,22 @@ Reverb::Reverb()
 
     //******************************* Buffers ********************************//
     mSampleBufferIndx = 0;
-
-    mAsymBuffer_L = {0.f};
-    mAsymBuffer_R = {0.f};
-
-    mDelayBuffer_L1 = {0.f};
-    mDelayBuffer_L2 = {0.f};
-    mDelayBuffer_L3 = {0.f};
-    mDelayBuffer_L4 = {0.f};
-    mDelayBuffer_L5 = {0.f};
-    mDelayBuffer_L6 = {0.f};
-    mDelayBuffer_L7 = {0.f};
-    mDelayBuffer_L8 = {0.f};
-    mDelayBuffer_L9 = {0.f};
-
-    mDelayBuffer_R1 = {0.f};
-    mDelayBuffer_R2 = {0.f};
-    mDelayBuffer_R3 = {0.f};
-    mDelayBuffer_R4 = {0.f};
-    mDelayBuffer_R5 = {0.f};
-    mDelayBuffer_R6 = {0.f};
-    mDelayBuffer_R7 = {0.f};
-    mDelayBuffer_R8 = {0.f};
-    mDelayBuffer_R9 = {0.f};
-
-    mDelayStateVar_L1 = 0.f;
-    mDelayStateVar_L2 = 0.f;
-    mDelayStateVar_L3 = 0.f;
-    mDelayStateVar_L4 = 0.f;
-    mDelayStateVar_L5 = 0.f;
-    mDelayStateVar_L6 = 0.f;
-    mDelayStateVar_L7 = 0.f;
-    mDelayStateVar_L8 = 0.f;
-    mDelayStateVar_L9 = 0.f;
-
-    mDelayStateVar_R1 = 0.f;
-    mDelayStateVar_R2 = 0.f;
-    mDelayStateVar_R3 = 0.f;
-    mDelayStateVar_R4 = 0.f;
-    mDelayStateVar_R5 = 0.f;
-    mDelayStateVar_R6 = 0.f;
-    mDelayStateVar_R7 = 0.f;
-    mDelayStateVar_R8 = 0.f;
-    mDelayStateVar_R9 = 0.f;
+    mSampleBufferMask = 0;
+
+    mDelayStateVar_1 = ReverbLanes{};
+    mDelayStateVar_2 = ReverbLanes{};
+    mDelayStateVar_3 = ReverbLanes{};
+    mDelayStateVar_4 = ReverbLanes{};
+    mDelayStateVar_5 = ReverbLanes{};
+    mDelayStateVar_6 = ReverbLanes{};
+    mDelayStateVar_7 = ReverbLanes{};
+    mDelayStateVar_8 = ReverbLanes{};
+    mDelayStateVar_9 = ReverbLanes{};
 
     //********************************* LFO **********************************//
-    mLFOStateVar_1 = 0.f;
-    mLFOStateVar_2 = 0.f;
-    mLFOWarpedFreq_1 = 0.86306 * (2 / SAMPLERATE);
-    mLFOWarpedFreq_2 = 0.6666 * (2 / SAMPLERATE);
+    mLFOStateVar = ReverbLanes{};
+    mLFOWarpedFreq = ReverbLanes{static_cast<float>(0.86306 * (2 / SAMPLERATE)),
+                                 static_cast<float>(0.6666 * (2 / SAMPLERATE))};
 
     //****************************** Smoothing *******************************//
     mSmootherMask = 0x0000;
@@ -225,10 +191,8 @@ Reverb::Reverb(float _size,
     mHPCoeff_1 = 1.f / (mHPOmega + 1.f);
     mHPCoeff_2 = mHPOmega - 1.f;
 
-    mLPStateVar_L = 0.f;
-    mLPStateVar_R = 0.f;
-    mHPStateVar_L = 0.f;
-    mHPStateVar_R = 0.f;
+    mLPStateVar = ReverbLanes{};
+    mHPStateVar = ReverbLanes{};
 
     //******************************* Depth ********************************//
     mDepthSize = 311.f + _size * -200.f;
@@ -250,55 +214,22 @@ Reverb::Reverb(float _size,
 
     //****************************** Buffers *******************************//
     mSampleBufferIndx = 0;
-
-    mAsymBuffer_L = {0.f};
-    mAsymBuffer_R = {0.f};
-
-    mDelayBuffer_L1 = {0.f};
-    mDelayBuffer_L2 = {0.f};
-    mDelayBuffer_L3 = {0.f};
-    mDelayBuffer_L4 = {0.f};
-    mDelayBuffer_L5 = {0.f};
-    mDelayBuffer_L6 = {0.f};
-    mDelayBuffer_L7 = {0.f};
-    mDelayBuffer_L8 = {0.f};
-    mDelayBuffer_L9 = {0.f};
-
-    mDelayBuffer_R1 = {0.f};
-    mDelayBuffer_R2 = {0.f};
-    mDelayBuffer_R3 = {0.f};
-    mDelayBuffer_R4 = {0.f};
-    mDelayBuffer_R5 = {0.f};
-    mDelayBuffer_R6 = {0.f};
-    mDelayBuffer_R7 = {0.f};
-    mDelayBuffer_R8 = {0.f};
-    mDelayBuffer_R9 = {0.f};
-
-    mDelayStateVar_L1 = 0.f;
-    mDelayStateVar_L2 = 0.f;
-    mDelayStateVar_L3 = 0.f;
-    mDelayStateVar_L4 = 0.f;
-    mDelayStateVar_L5 = 0.f;
-    mDelayStateVar_L6 = 0.f;
-    mDelayStateVar_L7 = 0.f;
-    mDelayStateVar_L8 = 0.f;
-    mDelayStateVar_L9 = 0.f;
-
-    mDelayStateVar_R1 = 0.f;
-    mDelayStateVar_R2 = 0.f;
-    mDelayStateVar_R3 = 0.f;
-    mDelayStateVar_R4 = 0.f;
-    mDelayStateVar_R5 = 0.f;
-    mDelayStateVar_R6 = 0.f;
-    mDelayStateVar_R7 = 0.f;
-    mDelayStateVar_R8 = 0.f;
-    mDelayStateVar_R9 = 0.f;
+    mSampleBufferMask = 0;
+
+    mDelayStateVar_1 = ReverbLanes{};
+    mDelayStateVar_2 = ReverbLanes{};
+    mDelayStateVar_3 = ReverbLanes{};
+    mDelayStateVar_4 = ReverbLanes{};
+    mDelayStateVar_5 = ReverbLanes{};
+    mDelayStateVar_6 = ReverbLanes{};
+    mDelayStateVar_7 = ReverbLanes{};
+    mDelayStateVar_8 = ReverbLanes{};
+    mDelayStateVar_9 = ReverbLanes{};
 
     //******************************** LFO *********************************//
-    mLFOStateVar_1 = 0.f;
-    mLFOStateVar_2 = 0.f;
-    mLFOWarpedFreq_1 = 0.86306 * (2 / SAMPLERATE);
-    mLFOWarpedFreq_2 = 0.6666 * (2 / SAMPLERATE);
+    mLFOStateVar = ReverbLanes{};
+    mLFOWarpedFreq = ReverbLanes{static_cast<float>(0.86306 * (2 / SAMPLERATE)),
+                                 static_cast<float>(0.6666 * (2 / SAMPLERATE))};
 
     //***************************** Smoothing ******************************//
     mSmootherMask = 0x0000;
@@ -315,555 +246,234 @@ Reverb::Reverb(float _size,
 
 
 /*****************************************************************************/
-/** @brief    processes the incoming samples of both channels
- *  @param    raw left Sample, raw right Sample, Reverb Level from
- *            the feedback mixer
+/** @brief    lane helpers of the reverb: frames of both channels are written
+ *            at the same index (one store), the channels read at their own
+ *            delays
 ******************************************************************************/
 
-void Reverb::applyReverb(float _EchosSample_L, float _EchosSample_R, float _ReverbLevel)
+static inline ReverbLanes splat(float _value)
 {
-    //***************************** Smoothing ******************************//
-    if (mSmootherMask)
-    {
-        applySmoother();
-    }
-
-
-    //**************** Temp. Variables for both Channels *******************//
-    float modCoeff_1a, modCoeff_2a, modCoeff_1b, modCoeff_2b;           // Modulation Coefficients
-    int32_t ind_tm1, ind_t0, ind_tp1, ind_tp2;                          // Interpolation Points
-
-    float holdSample;                                                   // Holds the state of currently processed sample
-    float delaySamples_int, delaySamples_fract;                         // Interger and fraction parts of delaytimes
-
-    float wetSample_L, wetSample_R;                                     // Fully processed Samples
-    float wetSample_L2, wetSample_R2;                                   // Processed Samples after Delays L4 and R12
-
-
-    //************************* Reverb Modulation **************************//
-    if (mDepth > 0.f)
-    {
-        float phase = mLFOStateVar_1 + mLFOWarpedFreq_1;        // phase 1
-        phase = phase - round(phase);
-        mLFOStateVar_1 = phase;
-
-        phase = (8.f - fabs(phase) * 16.f) * phase;             // par
-
-        phase += 1.f;
-        modCoeff_1a = phase * mDepth;
-        modCoeff_2a = (1.f - phase) * mDepth;
-
-        phase = mLFOStateVar_2 + mLFOWarpedFreq_2;              // phase 2
-        phase = phase - round(phase);
-        mLFOStateVar_2 = phase;
-
-        phase = (8.f - fabs(phase) * 16.f) * phase;             // par
-
-        phase += 1.f;
-        modCoeff_1b = phase * mDepth;
-        modCoeff_2b = (1.f - phase) * mDepth;
-    }
-    else
-    {
-        mLFOStateVar_1 = 0.f;
-        mLFOStateVar_2 = 0.f;
-
-        modCoeff_1a = 0.f;
-        modCoeff_2a = 0.f;
-        modCoeff_1b = 0.f;
-        modCoeff_2b = 0.f;
-    }
-
-
-    //**********************************************************************//
-    //*************************** Left Channel *****************************//
-    //**********************************************************************//
-
-    wetSample_L = _EchosSample_L * mFeed;
-
-    //***************************** Asym 2 L *******************************//
-    wetSample_L *= mFlushFade;
-    mAsymBuffer_L[mSampleBufferIndx] = wetSample_L;         // write
-
-    if (mPreDelayTime_L > REVERB_BUFFERSIZE_M1)
-    {
-        mPreDelayTime_L = REVERB_BUFFERSIZE_M1;
-    }
-    else if (mPreDelayTime_L < 0.f)
-    {
-        mPreDelayTime_L = 0.f;
-    }
-
-    delaySamples_int = round(mPreDelayTime_L - 0.5f);
-    delaySamples_fract = mPreDelayTime_L - delaySamples_int;
-
-    ind_t0 = mSampleBufferIndx - delaySamples_int;
-    ind_tm1 = ind_t0 - 1.f;
-
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
-    ind_tm1 &= REVERB_BUFFERSIZE_M1;
-
-    wetSample_L = mAsymBuffer_L[ind_t0] + delaySamples_fract * (mAsymBuffer_L[ind_tm1] - mAsymBuffer_L[ind_t0]);
-
-    wetSample_L *= mFlushFade;
-    wetSample_L = wetSample_L + mDelayStateVar_L9 * mFBAmnt;
-
-
-    //*************************** Loop Filter L ****************************//
-    wetSample_L = (wetSample_L - mLPStateVar_L * mLPCoeff_2) * mLPCoeff_1;          // LP IIR
-    holdSample = mLPStateVar_L;
-    mLPStateVar_L = wetSample_L;
-
-    wetSample_L = (wetSample_L + holdSample) * mLPOmega;                            // LP FIR
-
-    wetSample_L = (wetSample_L - mHPStateVar_L * mHPCoeff_2) * mHPCoeff_1;          // HP IIR
-    holdSample = mHPStateVar_L;
-    mHPStateVar_L = wetSample_L;
-
-    wetSample_L = wetSample_L - holdSample;                                         // HP FIR
-
-
-    //***************************** Del 4p L1 ******************************//
-    holdSample = mDelayStateVar_L1 * mAbAmnt;
-    wetSample_L = wetSample_L + (holdSample * GAIN_1);
-
-    mDelayBuffer_L1[mSampleBufferIndx] = wetSample_L;           // Write
-
-    delaySamples_fract = DELAYSAMPLES_1 + modCoeff_2a;
-
-    if (delaySamples_fract > REVERB_BUFFERSIZE_M2)              // Clip
-    {
-        delaySamples_fract = REVERB_BUFFERSIZE_M2;
-    }
-    else if (delaySamples_fract < 1.f)
-    {
-        delaySamples_fract = 1.f;
-    }
-
-    delaySamples_int = round(delaySamples_fract - 0.5f);
-    delaySamples_fract = delaySamples_fract - delaySamples_int;
-
-    ind_t0 = mSampleBufferIndx - delaySamples_int;
-    ind_tp1 = ind_t0 + -1;
-    ind_tp2 = ind_t0 + -2;
-
-    if (delaySamples_int < 1.f)
-    {
-        delaySamples_int = 1.f;
-    }
-
-    ind_tm1 = mSampleBufferIndx - delaySamples_int;
-    ind_tm1 += 1;
-
-    ind_tm1 &= REVERB_BUFFERSIZE_M1;
-    ind_t0  &= REVERB_BUFFERSIZE_M1;
-    ind_tp1 &= REVERB_BUFFERSIZE_M1;
-    ind_tp2 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_L1 = NlToolbox::Math::interpolRT(delaySamples_fract,             // 4 Point Interpolation
-                                                    mDelayBuffer_L1[ind_tm1],
-                                                    mDelayBuffer_L1[ind_t0],
-                                                    mDelayBuffer_L1[ind_tp1],
-                                                    mDelayBuffer_L1[ind_tp2]);
-
-    wetSample_L = wetSample_L * -GAIN_1 + holdSample;
-
-
-    //***************************** Del 1p L2 ******************************//
-    holdSample = mDelayStateVar_L2 * mAbAmnt;
-    wetSample_L = wetSample_L + (holdSample * GAIN_2);
-
-    mDelayBuffer_L2[mSampleBufferIndx] = wetSample_L;           // Write
-
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_2;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_L2 = mDelayBuffer_L2[ind_t0];
-
-    wetSample_L = wetSample_L * -GAIN_2 + holdSample;
-
-
-    //***************************** Del 1p L3 ******************************//
-    holdSample = mDelayStateVar_L3 * mAbAmnt;
-    wetSample_L = wetSample_L + (holdSample * GAIN_3);
-
-    mDelayBuffer_L3[mSampleBufferIndx] = wetSample_L;           // Write
-
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_3;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_L3 = mDelayBuffer_L3[ind_t0];
-
-    wetSample_L = wetSample_L * -GAIN_3 + holdSample;
-
-
-    //***************************** Del 1p L4 ******************************//
-    holdSample = mDelayStateVar_L4 * mAbAmnt;
-    wetSample_L = wetSample_L + (holdSample * GAIN_4);
-
-    mDelayBuffer_L4[mSampleBufferIndx] = wetSample_L;           // Write
-
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_4;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_L4 = mDelayBuffer_L4[ind_t0];
-
-    wetSample_L = wetSample_L * -GAIN_4 + holdSample;
-
-    wetSample_L2 = wetSample_L;
-
-
-    //***************************** Del 1p L5 ******************************//
-    holdSample = mDelayStateVar_L5 * mAbAmnt;
-    wetSample_L = wetSample_L + (holdSample * GAIN_4);
-
-    mDelayBuffer_L5[mSampleBufferIndx] = wetSample_L;           // Write
-
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_5;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_L5 = mDelayBuffer_L5[ind_t0];
+    return ReverbLanes{} + _value;
+}
 
-    wetSample_L = wetSample_L * -GAIN_4 + holdSample;
+static inline ReverbIndices splat(int32_t _value)
+{
+    return ReverbIndices{} + _value;
+}
 
+static inline void writeFrame(DelayLine& _line, int32_t _index, ReverbLanes _sample)
+{
+    std::memcpy(&_line[(_index & _line.mMask) * 2], &_sample, sizeof(_sample));
+}
 
-    //***************************** Del 1p L6 ******************************//
-    holdSample = mDelayStateVar_L6 * mAbAmnt;
-    wetSample_L = wetSample_L + (holdSample * GAIN_4);
+static inline ReverbLanes readFrames(DelayLine& _line, ReverbIndices _index)       // _index: masked index of each channel
+{
+    return ReverbLanes{_line[_index[0] * 2], _line[_index[1] * 2 + 1]};
+}
 
-    mDelayBuffer_L6[mSampleBufferIndx] = wetSample_L;           // Write
+static inline ReverbLanes interpolRT(ReverbLanes fract, ReverbLanes sample_tm1, ReverbLanes sample_t0, ReverbLanes sample_tp1, ReverbLanes sample_tp2)
+{
+    ReverbLanes fract_square = fract * fract;
+    ReverbLanes fract_cube = fract_square * fract;
 
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_6;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
+    ReverbLanes a = 0.5f * (sample_tp1 - sample_tm1);
+    ReverbLanes b = 0.5f * (sample_tp2 - sample_t0);
+    ReverbLanes c = sample_t0 - sample_tp1;
 
-    mDelayStateVar_L6 = mDelayBuffer_L6[ind_t0];
+    return sample_t0 + fract * a + fract_cube * (a + b + 2.f * c) - fract_square * (2.f * a + b + 3.f * c);
+}
 
-    wetSample_L = wetSample_L * -GAIN_4 + holdSample;
 
 
-    //***************************** Del 1p L7 ******************************//
-    holdSample = mDelayStateVar_L7 * mAbAmnt;
-    wetSample_L = wetSample_L + (holdSample * GAIN_4);
+/*****************************************************************************/
+/** @brief    1 point allpass delay of both channels
+******************************************************************************/
 
-    mDelayBuffer_L7[mSampleBufferIndx] = wetSample_L;           // Write
+static inline ReverbLanes allpass1p(DelayLine& _line, ReverbLanes& _stateVar, ReverbLanes _sample,
+                                    int32_t _index, ReverbIndices _delaySamples, float _gain, float _abAmnt)
+{
+    ReverbLanes holdSample = _stateVar * _abAmnt;
+    _sample = _sample + (holdSample * _gain);
 
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_7;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
+    writeFrame(_line, _index, _sample);                                             // Write
+    _stateVar = readFrames(_line, (_index - _delaySamples) & _line.mMask);
 
-    mDelayStateVar_L7 = mDelayBuffer_L7[ind_t0];
+    return _sample * -_gain + holdSample;
+}
 
-    wetSample_L = wetSample_L * -GAIN_4 + holdSample;
 
 
-    //***************************** Del 1p L8 ******************************//
-    holdSample = mDelayStateVar_L8 * mAbAmnt;
-    wetSample_L = wetSample_L + (holdSample * GAIN_4);
+/*****************************************************************************/
+/** @brief    4 point interpolated tap of a modulated delay (the frame at
+ *            _index has been written already), the delays are clipped to
+ *            [_clipLo ... size - 2], so the integer part is a truncation
+******************************************************************************/
 
-    mDelayBuffer_L8[mSampleBufferIndx] = wetSample_L;           // Write
+static inline ReverbLanes modulatedTap(DelayLine& _line, int32_t _index, ReverbLanes _delaySamples, float _clipLo)
+{
+    const ReverbLanes clipHi = splat(static_cast<float>(_line.mMask - 1));
 
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_8;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
+    _delaySamples = _delaySamples > clipHi ? clipHi : _delaySamples;                // Clip
+    _delaySamples = _delaySamples < _clipLo ? splat(_clipLo) : _delaySamples;
 
-    mDelayStateVar_L8 = mDelayBuffer_L8[ind_t0];
+    ReverbIndices delaySamples_int = __builtin_convertvector(_delaySamples, ReverbIndices);
+    ReverbLanes delaySamples_fract = _delaySamples - __builtin_convertvector(delaySamples_int, ReverbLanes);
 
-    wetSample_L = wetSample_L * -GAIN_4 + holdSample;
+    ReverbIndices ind_t0 = _index - delaySamples_int;
+    ReverbIndices ind_tp1 = ind_t0 - 1;
+    ReverbIndices ind_tp2 = ind_t0 - 2;
+    ReverbIndices ind_tm1 = _index - (delaySamples_int < 1 ? splat(1) : delaySamples_int) + 1;     // IClip Lo
 
+    const int32_t mask = _line.mMask;
 
-    //***************************** Del 4p L9 ******************************//
-    mDelayBuffer_L9[mSampleBufferIndx] = wetSample_L;
+    return interpolRT(delaySamples_fract,                                           // 4 Point Interpolation
+                      readFrames(_line, ind_tm1 & mask),
+                      readFrames(_line, ind_t0 & mask),
+                      readFrames(_line, ind_tp1 & mask),
+                      readFrames(_line, ind_tp2 & mask));
+}
 
-    delaySamples_fract = DELAYSAMPLES_L + modCoeff_1a;
 
-    if (delaySamples_fract > REVERB_BUFFERSIZE_M2)              // Clip
-    {
-        delaySamples_fract = REVERB_BUFFERSIZE_M2;
-    }
-    else if (delaySamples_fract < 0.f)
-    {
-        delaySamples_fract = 0.f;
-    }
 
-    delaySamples_int = round(delaySamples_fract - 0.5f);
-    delaySamples_fract = delaySamples_fract - delaySamples_int;
-
-    ind_t0 = mSampleBufferIndx - delaySamples_int;
-    ind_tp1 = ind_t0 + -1;
-    ind_tp2 = ind_t0 + -2;
+/*****************************************************************************/
+/** @brief    processes the incoming samples of both channels
+ *  @param    raw left Sample, raw right Sample, Reverb Level from
+ *            the feedback mixer
+******************************************************************************/
 
-    if (delaySamples_int < 1.f)                                 // IClip Lo
+void Reverb::applyReverb(float _EchosSample_L, float _EchosSample_R, float _ReverbLevel)
+{
+    //***************************** Smoothing ******************************//
+    if (mSmootherMask)
     {
-        delaySamples_int = 1.f;
+        applySmoother();
     }
 
-    ind_tm1 = mSampleBufferIndx - delaySamples_int;
-    ind_tm1 = ind_tm1 + 1;
-
-    ind_tm1 &= REVERB_BUFFERSIZE_M1;
-    ind_t0  &= REVERB_BUFFERSIZE_M1;
-    ind_tp1 &= REVERB_BUFFERSIZE_M1;
-    ind_tp2 &= REVERB_BUFFERSIZE_M1;
 
-    mDelayStateVar_L9 = NlToolbox::Math::interpolRT(delaySamples_fract,             // 4 Point Interpolation
-                                                    mDelayBuffer_L9[ind_tm1],
-                                                    mDelayBuffer_L9[ind_t0],
-                                                    mDelayBuffer_L9[ind_tp1],
-                                                    mDelayBuffer_L9[ind_tp2]);
+    //********************* Temp. Variables (Lanes) ************************//
+    ReverbLanes modCoeff_1, modCoeff_2;                                 // Modulation Coefficients (lane 0: LFO 1, lane 1: LFO 2)
 
+    ReverbLanes holdSample;                                             // Holds the state of currently processed sample
+    ReverbLanes wetSample;                                              // Fully processed Samples
+    ReverbLanes wetSample2;                                             // Processed Samples after Delays 4
 
-    //**********************************************************************//
-    //************************** Right Channel *****************************//
-    //**********************************************************************//
-
-    wetSample_R = _EchosSample_R * mFeed;
+    const int32_t index = static_cast<int32_t>(mSampleBufferIndx);
 
 
-    //***************************** Asym 2 R *******************************//
-    wetSample_R *= mFlushFade;
-    mAsymBuffer_R[mSampleBufferIndx] = wetSample_R;
-
-    if (mPreDelayTime_R > REVERB_BUFFERSIZE_M1)
-    {
-        mPreDelayTime_R = REVERB_BUFFERSIZE_M1;
-    }
-    else if (mPreDelayTime_R < 0.f)
+    //************************* Reverb Modulation **************************//
+    if (mDepth > 0.f)
     {
-        mPreDelayTime_R = 0.f;
-    }
-
-    delaySamples_int = round(mPreDelayTime_R - 0.5f);
-    delaySamples_fract = mPreDelayTime_R - delaySamples_int;
-
-    ind_t0 = mSampleBufferIndx - delaySamples_int;
-    ind_tm1 = ind_t0 - 1.f;
-
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
-    ind_tm1 &= REVERB_BUFFERSIZE_M1;
-
-    wetSample_R = mAsymBuffer_R[ind_t0] + delaySamples_fract * (mAsymBuffer_R[ind_tm1] - mAsymBuffer_R[ind_t0]);
-
-    wetSample_R *= mFlushFade;
-    wetSample_R = wetSample_R + mDelayStateVar_R9 * mFBAmnt;
-
-
-    //*************************** Loop Filter R ****************************//
-    wetSample_R = (wetSample_R - mLPStateVar_R * mLPCoeff_2) * mLPCoeff_1;          // LP IIR
-    holdSample = mLPStateVar_R;
-    mLPStateVar_R = wetSample_R;
-
-    wetSample_R = (wetSample_R + holdSample) * mLPOmega;                            // LP FIR
+        ReverbLanes phase = mLFOStateVar + mLFOWarpedFreq;
+        phase = phase >= 0.5f ? phase - 1.f : phase;                    // phase - round(phase), the phase only grows
+        mLFOStateVar = phase;
 
-    wetSample_R = (wetSample_R - mHPStateVar_R * mHPCoeff_2) * mHPCoeff_1;          // HP IIR
-    holdSample = mHPStateVar_R;
-    mHPStateVar_R = wetSample_R;
+        ReverbLanes64 par = __builtin_convertvector(phase, ReverbLanes64);  // par (in double, like the scalar fabs())
+        par = (8.0 - (par < 0.0 ? -par : par) * 16.0) * par;
+        phase = __builtin_convertvector(par, ReverbLanes);
 
-    wetSample_R = wetSample_R - holdSample;                                         // HP FIR
-
-
-    //***************************** Del 4p R1 ******************************//
-    holdSample = mDelayStateVar_R1 * mAbAmnt;
-    wetSample_R = wetSample_R + (holdSample * GAIN_1);
-
-    mDelayBuffer_R1[mSampleBufferIndx] = wetSample_R;           // Write
-
-    delaySamples_fract = DELAYSAMPLES_9 + modCoeff_2b;
-
-    if (delaySamples_fract > REVERB_BUFFERSIZE_M2)              // Clip
-    {
-        delaySamples_fract = REVERB_BUFFERSIZE_M2;
+        phase += 1.f;
+        modCoeff_1 = phase * mDepth;
+        modCoeff_2 = (1.f - phase) * mDepth;
     }
-    else if (delaySamples_fract < 1.f)
+    else
     {
-        delaySamples_fract = 1.f;
-    }
-
-    delaySamples_int = round(delaySamples_fract - 0.5f);
-    delaySamples_fract = delaySamples_fract - delaySamples_int;
+        mLFOStateVar = ReverbLanes{};
 
-    ind_t0 = mSampleBufferIndx - delaySamples_int;
-    ind_tp1 = ind_t0 + -1;
-    ind_tp2 = ind_t0 + -2;
-
-    if (delaySamples_int < 1.f)
-    {
-        delaySamples_int = 1.f;
+        modCoeff_1 = ReverbLanes{};
+        modCoeff_2 = ReverbLanes{};
     }
 
-    ind_tm1 = mSampleBufferIndx - delaySamples_int;
-    ind_tm1 += 1;
-
-    ind_tm1 &= REVERB_BUFFERSIZE_M1;
-    ind_t0  &= REVERB_BUFFERSIZE_M1;
-    ind_tp1 &= REVERB_BUFFERSIZE_M1;
-    ind_tp2 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_R1 = NlToolbox::Math::interpolRT(delaySamples_fract,             // 4 Point Interpolation
-                                                    mDelayBuffer_R1[ind_tm1],
-                                                    mDelayBuffer_R1[ind_t0],
-                                                    mDelayBuffer_R1[ind_tp1],
-                                                    mDelayBuffer_R1[ind_tp2]);
-
-    wetSample_R = wetSample_R * -GAIN_1 + holdSample;
-
-
-    //***************************** Del 1p R2 ******************************//
-    holdSample = mDelayStateVar_R2 * mAbAmnt;
-    wetSample_R = wetSample_R + (holdSample * GAIN_2);
-
-    mDelayBuffer_R2[mSampleBufferIndx] = wetSample_R;           // Write
-
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_10;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_R2 = mDelayBuffer_R2[ind_t0];
-
-    wetSample_R = wetSample_R * -GAIN_2 + holdSample;
-
-
-    //***************************** Del 1p R3 ******************************//
-    holdSample = mDelayStateVar_R3 * mAbAmnt;
-    wetSample_R = wetSample_R + (holdSample * GAIN_3);
-
-    mDelayBuffer_R3[mSampleBufferIndx] = wetSample_R;           // Write
-
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_11;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_R3 = mDelayBuffer_R3[ind_t0];
-
-    wetSample_R = wetSample_R * -GAIN_3 + holdSample;
-
-
-    //***************************** Del 1p R4 ******************************//
-    holdSample = mDelayStateVar_R4 * mAbAmnt;
-    wetSample_R = wetSample_R + (holdSample * GAIN_4);
 
-    mDelayBuffer_R4[mSampleBufferIndx] = wetSample_R;           // Write
+    wetSample = ReverbLanes{_EchosSample_L, _EchosSample_R} * mFeed;
 
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_12;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
 
-    mDelayStateVar_R4 = mDelayBuffer_R4[ind_t0];
+    //******************************* Asym 2 *******************************//
+    wetSample *= mFlushFade;
+    writeFrame(mAsymBuffer, index, wetSample);                          // write
 
-    wetSample_R = wetSample_R * -GAIN_4 + holdSample;
+    ReverbLanes preDelayTime = {mPreDelayTime_L, mPreDelayTime_R};
+    const ReverbLanes preDelayClip = splat(static_cast<float>(mAsymBuffer.mMask));
 
-    wetSample_R2 = wetSample_R;
+    preDelayTime = preDelayTime > preDelayClip ? preDelayClip : preDelayTime;
+    preDelayTime = preDelayTime < 0.f ? ReverbLanes{} : preDelayTime;
 
+    mPreDelayTime_L = preDelayTime[0];
+    mPreDelayTime_R = preDelayTime[1];
 
-    //***************************** Del 1p R5 ******************************//
-    holdSample = mDelayStateVar_R5 * mAbAmnt;
-    wetSample_R = wetSample_R + (holdSample * GAIN_4);
+    ReverbIndices delaySamples_int = __builtin_convertvector(preDelayTime, ReverbIndices);
+    ReverbLanes delaySamples_fract = preDelayTime - __builtin_convertvector(delaySamples_int, ReverbLanes);
 
-    mDelayBuffer_R5[mSampleBufferIndx] = wetSample_R;           // Write
+    ReverbIndices ind_t0 = (index - delaySamples_int) & mAsymBuffer.mMask;
+    ReverbIndices ind_tm1 = (index - delaySamples_int - 1) & mAsymBuffer.mMask;
 
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_13;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
+    ReverbLanes sample_t0 = readFrames(mAsymBuffer, ind_t0);
+    wetSample = sample_t0 + delaySamples_fract * (readFrames(mAsymBuffer, ind_tm1) - sample_t0);
 
-    mDelayStateVar_R5 = mDelayBuffer_R5[ind_t0];
+    wetSample *= mFlushFade;
+    wetSample = wetSample + mDelayStateVar_9 * mFBAmnt;
 
-    wetSample_R = wetSample_R * -GAIN_4 + holdSample;
 
+    //***************************** Loop Filter ****************************//
+    wetSample = (wetSample - mLPStateVar * mLPCoeff_2) * mLPCoeff_1;               // LP IIR
+    holdSample = mLPStateVar;
+    mLPStateVar = wetSample;
 
-    //***************************** Del 1p R6 ******************************//
-    holdSample = mDelayStateVar_R6 * mAbAmnt;
-    wetSample_R = wetSample_R + (holdSample * GAIN_4);
+    wetSample = (wetSample + holdSample) * mLPOmega;                                // LP FIR
 
-    mDelayBuffer_R6[mSampleBufferIndx] = wetSample_R;           // Write
+    wetSample = (wetSample - mHPStateVar * mHPCoeff_2) * mHPCoeff_1;               // HP IIR
+    holdSample = mHPStateVar;
+    mHPStateVar = wetSample;
 
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_14;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
+    wetSample = wetSample - holdSample;                                             // HP FIR
 
-    mDelayStateVar_R6 = mDelayBuffer_R6[ind_t0];
 
-    wetSample_R = wetSample_R * -GAIN_4 + holdSample;
+    //******************************* Del 4p 1 *****************************//
+    holdSample = mDelayStateVar_1 * mAbAmnt;
+    wetSample = wetSample + (holdSample * GAIN_1);
 
+    writeFrame(mDelayBuffer_1, index, wetSample);                                  // Write
 
-    //***************************** Del 1p R7 ******************************//
-    holdSample = mDelayStateVar_R7 * mAbAmnt;
-    wetSample_R = wetSample_R + (holdSample * GAIN_4);
+    mDelayStateVar_1 = modulatedTap(mDelayBuffer_1, index, ReverbLanes{DELAYSAMPLES_1, DELAYSAMPLES_9} + modCoeff_2, 1.f);
 
-    mDelayBuffer_R7[mSampleBufferIndx] = wetSample_R;           // Write
+    wetSample = wetSample * -GAIN_1 + holdSample;
 
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_15;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
 
-    mDelayStateVar_R7 = mDelayBuffer_R7[ind_t0];
+    //***************************** Del 1p 2 - 8 ***************************//
+    wetSample = allpass1p(mDelayBuffer_2, mDelayStateVar_2, wetSample, index, ReverbIndices{DELAYSAMPLES_2, DELAYSAMPLES_10}, GAIN_2, mAbAmnt);
+    wetSample = allpass1p(mDelayBuffer_3, mDelayStateVar_3, wetSample, index, ReverbIndices{DELAYSAMPLES_3, DELAYSAMPLES_11}, GAIN_3, mAbAmnt);
+    wetSample = allpass1p(mDelayBuffer_4, mDelayStateVar_4, wetSample, index, ReverbIndices{DELAYSAMPLES_4, DELAYSAMPLES_12}, GAIN_4, mAbAmnt);
 
-    wetSample_R = wetSample_R * -GAIN_4 + holdSample;
+    wetSample2 = wetSample;
 
+    wetSample = allpass1p(mDelayBuffer_5, mDelayStateVar_5, wetSample, index, ReverbIndices{DELAYSAMPLES_5, DELAYSAMPLES_13}, GAIN_4, mAbAmnt);
+    wetSample = allpass1p(mDelayBuffer_6, mDelayStateVar_6, wetSample, index, ReverbIndices{DELAYSAMPLES_6, DELAYSAMPLES_14}, GAIN_4, mAbAmnt);
+    wetSample = allpass1p(mDelayBuffer_7, mDelayStateVar_7, wetSample, index, ReverbIndices{DELAYSAMPLES_7, DELAYSAMPLES_15}, GAIN_4, mAbAmnt);
+    wetSample = allpass1p(mDelayBuffer_8, mDelayStateVar_8, wetSample, index, ReverbIndices{DELAYSAMPLES_8, DELAYSAMPLES_16}, GAIN_4, mAbAmnt);
 
-    //***************************** Del 1p R8 ******************************//
-    holdSample = mDelayStateVar_R8 * mAbAmnt;
-    wetSample_R = wetSample_R + (holdSample * GAIN_4);
 
-    mDelayBuffer_R8[mSampleBufferIndx] = wetSample_R;           // Write
+    //******************************* Del 4p 9 *****************************//
+    writeFrame(mDelayBuffer_9, index, wetSample);
 
-    ind_t0  = mSampleBufferIndx - DELAYSAMPLES_16;
-    ind_t0 &= REVERB_BUFFERSIZE_M1;
+    mDelayStateVar_9 = modulatedTap(mDelayBuffer_9, index, ReverbLanes{DELAYSAMPLES_L, DELAYSAMPLES_R} + modCoeff_1, 0.f);
 
-    mDelayStateVar_R8 = mDelayBuffer_R8[ind_t0];
-
-    wetSample_R = wetSample_R * -GAIN_4 + holdSample;
-
-
-    //***************************** Del 4p R9 ******************************//
-    mDelayBuffer_R9[mSampleBufferIndx] = wetSample_R;
-
-    delaySamples_fract = DELAYSAMPLES_R + modCoeff_1b;
-
-    if (delaySamples_fract > REVERB_BUFFERSIZE_M2)              // Clip
-    {
-        delaySamples_fract = REVERB_BUFFERSIZE_M2;
-    }
-    else if (delaySamples_fract < 0.f)
-    {
-        delaySamples_fract = 0.f;
-    }
-
-    delaySamples_int = round(delaySamples_fract - 0.5f);
-    delaySamples_fract = delaySamples_fract - delaySamples_int;
-
-    ind_t0 = mSampleBufferIndx - delaySamples_int;
-    ind_tp1 = ind_t0 + -1;
-    ind_tp2 = ind_t0 + -2;
-
-    if (delaySamples_int < 1.f)                                 // IClip Lo
-    {
-        delaySamples_int = 1.f;
-    }
-
-    ind_tm1 = mSampleBufferIndx - delaySamples_int;
-    ind_tm1 = ind_tm1 + 1;
-
-    ind_tm1 &= REVERB_BUFFERSIZE_M1;
-    ind_t0  &= REVERB_BUFFERSIZE_M1;
-    ind_tp1 &= REVERB_BUFFERSIZE_M1;
-    ind_tp2 &= REVERB_BUFFERSIZE_M1;
-
-    mDelayStateVar_R9 = NlToolbox::Math::interpolRT(delaySamples_fract,             // 4 Point Interpolation
-                                                    mDelayBuffer_R9[ind_tm1],
-                                                    mDelayBuffer_R9[ind_t0],
-                                                    mDelayBuffer_R9[ind_tp1],
-                                                    mDelayBuffer_R9[ind_tp2]);
-
-    mSampleBufferIndx = (mSampleBufferIndx + 1) & REVERB_BUFFERSIZE_M1;
+    mSampleBufferIndx = (mSampleBufferIndx + 1) & mSampleBufferMask;
 
 
     //**************************** Delay Mixer *****************************//
-    wetSample_L = wetSample_L * mBalance_full + wetSample_L2 * mBalance_half;
-    wetSample_R = wetSample_R * mBalance_full + wetSample_R2 * mBalance_half;
+    wetSample = wetSample * mBalance_full + wetSample2 * mBalance_half;
 
 
     //**********************************************************************//
     //*************************** Output Mixer *****************************//
 
-    mReverbOut_L = _EchosSample_L * mDry + wetSample_L * mWet;
-    mReverbOut_R = _EchosSample_R * mDry + wetSample_R * mWet;
+    mReverbOut_L = _EchosSample_L * mDry + wetSample[0] * mWet;
+    mReverbOut_R = _EchosSample_R * mDry + wetSample[1] * mWet;
 
 
     //************************** Feedback Mixer ****************************//
 
     mFeedbackOut = ((_EchosSample_L + _EchosSample_R) * (1.f - _ReverbLevel))
-            + ((wetSample_L + wetSample_R) * _ReverbLevel);
+            + ((wetSample[0] + wetSample[1]) * _ReverbLevel);
 }
 
 
@@ -1032,8 +642,7 @@ void Reverb::setReverbParams(unsigned char _ctrlID, float _ctrlVal)
 
 void Reverb::resetBuffer()
 {
-    mAsymBuffer_L.fill(0.f);
-    mAsymBuffer_R.fill(0.f);
+    mAsymBuffer.clear();
 }
 
 
@@ -1219,3 +828,79 @@ void Reverb::initDepthSmoother()
     mSmootherMask |= 0x00E0;
     mDepth_ramp = 0.f;
 }
+
+
+
+/*****************************************************************************/
+/** @brief    longest delay of every line in samples (the longer one of both
+ *            channels), in the order of initDelayLines(): the pre delay
+ *            (scaled by the sample rate) and the allpass delays (fixed, the
+ *            4 point ones plus their modulation)
+******************************************************************************/
+
+static constexpr float sMaxDelaySamples[REVERB_DELAYLINES] =
+{
+    REVERB_MAX_PREDELAYTIME * SAMPLERATE * 1.18933f,
+
+    DELAYSAMPLES_9 + REVERB_MAX_MODULATION,
+    std::max(DELAYSAMPLES_2, DELAYSAMPLES_10),
+    std::max(DELAYSAMPLES_3, DELAYSAMPLES_11),
+    std::max(DELAYSAMPLES_4, DELAYSAMPLES_12),
+    std::max(DELAYSAMPLES_5, DELAYSAMPLES_13),
+    std::max(DELAYSAMPLES_6, DELAYSAMPLES_14),
+    std::max(DELAYSAMPLES_7, DELAYSAMPLES_15),
+    std::max(DELAYSAMPLES_8, DELAYSAMPLES_16),
+    DELAYSAMPLES_L + REVERB_MAX_MODULATION
+};
+
+
+
+/*****************************************************************************/
+/** @brief    every line gets its own size (holding both channels), the
+ *            shared buffer index wraps with the mask of the longest one
+******************************************************************************/
+
+void Reverb::initDelayLines(EngineArena& _arena, DelayFlush& _flush)
+{
+    DelayLine* delayLines[REVERB_DELAYLINES] =
+    {
+        &mAsymBuffer,
+        &mDelayBuffer_1, &mDelayBuffer_2, &mDelayBuffer_3, &mDelayBuffer_4, &mDelayBuffer_5,
+        &mDelayBuffer_6, &mDelayBuffer_7, &mDelayBuffer_8, &mDelayBuffer_9
+    };
+
+    mSampleBufferIndx = 0;
+    mSampleBufferMask = 0;
+
+    for (uint32_t line = 0; line < REVERB_DELAYLINES; line++)
+    {
+        delayLines[line]->init(_arena, DelayLine::sizeFor(sMaxDelaySamples[line]), 2);
+        _flush.add(delayLines[line]);
+
+        if (delayLines[line]->mMask > mSampleBufferMask)
+        {
+            mSampleBufferMask = delayLines[line]->mMask;
+        }
+    }
+}
+
+
+
+size_t Reverb::delayFootprint()
+{
+    size_t size = 0;
+
+    for (uint32_t line = 0; line < REVERB_DELAYLINES; line++)
+    {
+        size += DelayLine::footprint(DelayLine::sizeFor(sMaxDelaySamples[line]) * 2);
+    }
+
+    return size;
+}
+
+
+
+size_t Reverb::footprint() const
+{
+    return sizeof(Reverb) + delayFootprint();
+}
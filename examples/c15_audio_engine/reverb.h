@@ -10,17 +10,20 @@
                 samplingrate!!!
                 Loop Filter -> Lpf & Hpf Coeficients will be calculated
                 with half the SR
+                both channels are processed as the two lanes of a vector
+                (left: lane 0, right: lane 1), the delay lines of both
+                channels are interleaved
 *******************************************************************************/
 
 #pragma once
 
 #include "nltoolbox.h"
-#include <array>
+#include "delay_line.h"
 
-//****************************** Buffer Arrays *******************************//
-#define REVERB_BUFFERSIZE 16384
-#define REVERB_BUFFERSIZE_M1 16383
-#define REVERB_BUFFERSIZE_M2 16382
+//******************************* Delay Lines ********************************//
+#define REVERB_DELAYLINES 10                // pre delay and nine allpass delays, each one holding both channels
+#define REVERB_MAX_PREDELAYTIME 0.2f        // longest pre delay in seconds (the right channel is stretched by 1.18933)
+#define REVERB_MAX_MODULATION 622           // longest modulation of the 4 point delays in samples (2 * largest depth)
 
 //************************** Fixed Delay Samples ****************************//
 #define DELAYSAMPLES_1 281
@@ -49,6 +52,11 @@
 #define GAIN_3 0.64093f
 #define GAIN_4 0.653011f
 
+//******************************* Stereo Lanes *******************************//
+typedef float ReverbLanes __attribute__((vector_size(2 * sizeof(float))));          // left and right channel
+typedef int32_t ReverbIndices __attribute__((vector_size(2 * sizeof(int32_t))));    // buffer indices of both channels
+typedef double ReverbLanes64 __attribute__((vector_size(2 * sizeof(double))));
+
 
 class Reverb
 {
@@ -72,6 +80,10 @@ public:
     float mFlushFade;
     void resetBuffer();
 
+    void initDelayLines(EngineArena& _arena, DelayFlush& _flush);     // takes the sample buffers from the arena, the flush clears them
+    static size_t delayFootprint();                                 // arena memory initDelayLines() will take
+    size_t footprint() const;                                       // memory of the module including its sample buffers
+
 private:
     //*************************** Control Variables **************************//
     float mSize;
@@ -89,8 +101,8 @@ private:
     float mHPOmega, mLPOmega;
     float mLPCoeff_1, mLPCoeff_2;
     float mHPCoeff_1, mHPCoeff_2;
-    float mLPStateVar_L, mLPStateVar_R;
-    float mHPStateVar_L, mHPStateVar_R;
+    ReverbLanes mLPStateVar;
+    ReverbLanes mHPStateVar;
 
     float mDepthSize;
     float mDepthChorus;
@@ -101,54 +113,23 @@ private:
     float mDry;
     float mWet;
 
-    float mLFOStateVar_1, mLFOStateVar_2;
-    float mLFOWarpedFreq_1, mLFOWarpedFreq_2;
+    ReverbLanes mLFOStateVar;                   // LFO 1 and 2 (modulating the left and the right channel)
+    ReverbLanes mLFOWarpedFreq;
 
     //***************************** Delay Buffers ****************************//
     uint32_t mSampleBufferIndx;
+    uint32_t mSampleBufferMask;                 // mask of the longest line, the shorter lines mask the index again
 
-    std::array<float, REVERB_BUFFERSIZE> mAsymBuffer_L;
-    std::array<float, REVERB_BUFFERSIZE> mAsymBuffer_R;
-
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L1;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L2;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L3;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L4;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L5;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L6;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L7;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L8;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_L9;
-
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R1;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R2;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R3;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R4;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R5;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R6;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R7;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R8;
-    std::array<float, REVERB_BUFFERSIZE> mDelayBuffer_R9;
-
-    float mDelayStateVar_L1;
-    float mDelayStateVar_L2;
-    float mDelayStateVar_L3;
-    float mDelayStateVar_L4;
-    float mDelayStateVar_L5;
-    float mDelayStateVar_L6;
-    float mDelayStateVar_L7;
-    float mDelayStateVar_L8;
-    float mDelayStateVar_L9;
-
-    float mDelayStateVar_R1;
-    float mDelayStateVar_R2;
-    float mDelayStateVar_R3;
-    float mDelayStateVar_R4;
-    float mDelayStateVar_R5;
-    float mDelayStateVar_R6;
-    float mDelayStateVar_R7;
-    float mDelayStateVar_R8;
-    float mDelayStateVar_R9;
+
+    ReverbLanes mDelayStateVar_1;
+    ReverbLanes mDelayStateVar_2;
+    ReverbLanes mDelayStateVar_3;
+    ReverbLanes mDelayStateVar_4;
+    ReverbLanes mDelayStateVar_5;
+    ReverbLanes mDelayStateVar_6;
+    ReverbLanes mDelayStateVar_7;
+    ReverbLanes mDelayStateVar_8;
+    ReverbLanes mDelayStateVar_9;
 
     //************************** Smoothing Variables *************************//
     // Smoother Mask    ID 1: Balance
@@ -243,4 +224,17 @@ private:
     //**************************** Helper Functions ***************************//
     void initFeedSmoother();
     void initDepthSmoother();
+
+    //**************************** Sample Buffers ****************************//
+    DelayLine mAsymBuffer;                      // frame i: [2 * i] left, [2 * i + 1] right
+
+    DelayLine mDelayBuffer_1;
+    DelayLine mDelayBuffer_2;
+    DelayLine mDelayBuffer_3;
+    DelayLine mDelayBuffer_4;
+    DelayLine mDelayBuffer_5;
+    DelayLine mDelayBuffer_6;
+    DelayLine mDelayBuffer_7;
+    DelayLine mDelayBuffer_8;
+    DelayLine mDelayBuffer_9;
 };
@@ -51,7 +51,7 @@ Soundgenerator::Soundgenerator()
     mModuleA_PmSelfShaper = 0.f;
     mModuleA_PmCrossShaper = 0.f;
 
-    pModuleA_ChirpFilter = new NlToolbox::Filters::ChirpFilter();
+    mModuleA_ChirpFilter = NlToolbox::Filters::ChirpFilter();
 
 //    mModuleA_Pitch_EnvC_Amnt = 0.f;
 //    mModuleA_Fluct_EnvC_Amnt = 0.f;
@@ -98,7 +98,7 @@ Soundgenerator::Soundgenerator()
     mModuleB_PmSelfShaper = 0.f;
     mModuleB_PmCrossShaper = 0.f;
 
-    pModuleB_ChirpFilter = new NlToolbox::Filters::ChirpFilter();
+    mModuleB_ChirpFilter = NlToolbox::Filters::ChirpFilter();
 
 //    mModuleB_Pitch_EnvC_Amnt = 0.f;
 //    mModuleB_Fluct_EnvC_Amnt = 0.f;
@@ -228,7 +228,7 @@ Soundgenerator::Soundgenerator(float _pitchOffset_A, float _pitchOffset_B,
     mModuleA_PmSelfShaper = _pmSelfShaper_A;
     mModuleA_PmCrossShaper = _pmCrossShaper_A;
 
-    pModuleA_ChirpFilter = new NlToolbox::Filters::ChirpFilter(SAMPLERATE, NlToolbox::Conversion::pitch2freq(_chirpPitch_A - 1.5f));
+    mModuleA_ChirpFilter = NlToolbox::Filters::ChirpFilter(SAMPLERATE, NlToolbox::Conversion::pitch2freq(_chirpPitch_A - 1.5f));
 
 //    mModuleA_Pitch_EnvC_Amnt = _pitchEnvC_A;
 //    mModuleA_Fluct_EnvC_Amnt = _fluctEnvC_A;
@@ -275,7 +275,7 @@ Soundgenerator::Soundgenerator(float _pitchOffset_A, float _pitchOffset_B,
     mModuleB_PmSelfShaper = _pmSelfShaper_B;
     mModuleB_PmCrossShaper = _pmCrossShaper_B;
 
-    pModuleB_ChirpFilter = new NlToolbox::Filters::ChirpFilter(SAMPLERATE, NlToolbox::Conversion::pitch2freq(_chirpPitch_B - 1.5f));
+    mModuleB_ChirpFilter = NlToolbox::Filters::ChirpFilter(SAMPLERATE, NlToolbox::Conversion::pitch2freq(_chirpPitch_B - 1.5f));
 
 //    mModuleB_Pitch_EnvC_Amnt = _pitchEnvC_B;
 //    mModuleB_Fluct_EnvC_Amnt = _fluctEnvC_B;
@@ -356,19 +356,6 @@ Soundgenerator::Soundgenerator(float _pitchOffset_A, float _pitchOffset_B,
 
 
 
-/******************************************************************************/
-/** Soundgenerator Destructor
- * @brief
-*******************************************************************************/
-
-Soundgenerator::~Soundgenerator()
-{
-    delete pModuleA_ChirpFilter;
-    delete pModuleB_ChirpFilter;
-}
-
-
-
 /******************************************************************************/
 /** @brief    main function which calculates the modulated phase depending
  *            on mix amounts (self modulation, cross modulation, feedback modulation),
@@ -396,7 +383,7 @@ void Soundgenerator::generateSound(float _feedbackSample, float _envRamp_A, floa
 
 
     //********************************** Oscillator A ***********************************//
-    tmpVar = pModuleA_ChirpFilter->applyFilter(tmpVar);
+    tmpVar = mModuleA_ChirpFilter.applyFilter(tmpVar);
     tmpVar += mModuleA_OscPhase;
 
     tmpVar += (-0.25f);
@@ -427,7 +414,7 @@ void Soundgenerator::generateSound(float _feedbackSample, float _envRamp_A, floa
 
 
     //********************************** Oscillator B ***********************************//
-    tmpVar = pModuleB_ChirpFilter->applyFilter(tmpVar);
+    tmpVar = mModuleB_ChirpFilter.applyFilter(tmpVar);
     tmpVar += mModuleB_OscPhase;
 
     tmpVar += (-0.25f);
@@ -548,7 +535,7 @@ void Soundgenerator::generateSound(float _feedbackSample, float *polyPtr)
 
 
     //********************************** Oscillator A ***********************************//
-    tmpVar = pModuleA_ChirpFilter->applyFilter(tmpVar);
+    tmpVar = mModuleA_ChirpFilter.applyFilter(tmpVar);
     tmpVar += mModuleA_OscPhase;
 
     tmpVar += (-0.25f);
@@ -579,7 +566,7 @@ void Soundgenerator::generateSound(float _feedbackSample, float *polyPtr)
 
 
     //********************************** Oscillator B ***********************************//
-    tmpVar = pModuleB_ChirpFilter->applyFilter(tmpVar);
+    tmpVar = mModuleB_ChirpFilter.applyFilter(tmpVar);
     tmpVar += mModuleB_OscPhase;
 
     tmpVar += (-0.25f);
@@ -929,7 +916,7 @@ void Soundgenerator::setGenParams(unsigned char _instrID, unsigned char _ctrlID,
 #endif
                 _ctrlVal = NlToolbox::Conversion::pitch2freq(_ctrlVal - 1.5f);
 
-                pModuleA_ChirpFilter->setFrequency(_ctrlVal);
+                mModuleA_ChirpFilter.setFrequency(_ctrlVal);
                 break;
         }
         break;
@@ -1287,7 +1274,7 @@ void Soundgenerator::setGenParams(unsigned char _instrID, unsigned char _ctrlID,
 #endif
                 _ctrlVal = NlToolbox::Conversion::pitch2freq(_ctrlVal - 1.5f);
 
-                pModuleB_ChirpFilter->setFrequency(_ctrlVal);
+                mModuleB_ChirpFilter.setFrequency(_ctrlVal);
                 break;
         }
         break;
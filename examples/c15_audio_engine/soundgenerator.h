@@ -47,7 +47,7 @@ public:
                    float _driveEnvA_A, float _driveEnvB_B,
                    float _feedbackMixEnvC_A, float _feedbackMixEnvC_B);
 
-    ~Soundgenerator();                     // Destructor
+    ~Soundgenerator(){}                    // Destructor
 
     float mSampleA, mSampleB;              // Generated Samples
 
@@ -75,7 +75,7 @@ private:
     float mModuleA_PmSelfShaper;            // Self Phase Modulation Amount, Shaper Feedback
     float mModuleA_PmCrossShaper;           // Cross Phase Modulation Amount, Shaper Feedback
 
-    NlToolbox::Filters::ChirpFilter* pModuleA_ChirpFilter;   // Chirp Filter instance
+    NlToolbox::Filters::ChirpFilter mModuleA_ChirpFilter;    // Chirp Filter instance
 
 //    float mModuleA_Pitch_EnvC_Amnt;         // Envelope C Modulation Amount on Pitch Offset
 //    float mModuleA_Fluct_EnvC_Amnt;         // Envelope C Modulation Amount on Fluctuation
@@ -119,7 +119,7 @@ private:
     float mModuleB_PmSelfShaper;
     float mModuleB_PmCrossShaper;
 
-    NlToolbox::Filters::ChirpFilter* pModuleB_ChirpFilter;
+    NlToolbox::Filters::ChirpFilter mModuleB_ChirpFilter;
 
 //    float mModuleB_Pitch_EnvC_Amnt;         // Envelope C Modulation Amount on Pitch Offset
 //    float mModuleB_Fluct_EnvC_Amnt;         // Envelope C Modulation Amount on Fluctuation
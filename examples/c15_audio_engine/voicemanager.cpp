@@ -7,17 +7,34 @@
 *******************************************************************************/
 
 #include "voicemanager.h"
+#include <iostream>
 
 float PARAMSIGNALDATA[NUM_VOICES][NUM_SIGNALS];
 
+/* everything the constructor creates in the engine arena, in order of creation (the order of the voice loop),
+   every delay line follows the module it belongs to */
+static size_t arenaSize()
+{
+    return EngineArena::footprint<BiquadFilters>()
+         + EngineArena::footprint<VoiceModules>(NUM_VOICES)
+         + CombFilter::delayFootprint() * NUM_VOICES
+         + EngineArena::footprint<Outputmixer>()
+         + EngineArena::footprint<Flanger>() + Flanger::delayFootprint()
+         + EngineArena::footprint<Cabinet>() * 2
+         + EngineArena::footprint<GapFilter>()
+         + EngineArena::footprint<Echo>() + Echo::delayFootprint()
+         + EngineArena::footprint<Reverb>() + Reverb::delayFootprint();
+}
+
 /******************************************************************************/
 /** Voice Manager Default Constructor
  * @brief    initialization of the modules local variabels with default values
 *******************************************************************************/
 
 VoiceManager::VoiceManager()
+    : mArena(arenaSize())
 {
-    pFadepointLowpass = new BiquadFilters(250.f, 0.f, 0.2f, BiquadFilterType::LOWPASS);
+    pFadepointLowpass = mArena.create<BiquadFilters>(250.f, 0.f, 0.2f, BiquadFilterType::LOWPASS);
     mFlushNow = false;
     mFadepoint = 1.f;
     mFadepointCounter = 0;
@@ -28,86 +45,64 @@ VoiceManager::VoiceManager()
         mRaisedCosineTable[ind] = pow(cos(x), 2);
     }
 
-    uint32_t i;
-
-    for (i = 0; i < NUM_VOICES; i++)
-    {
-        pTest_Envelopes[i] = new Test_Envelopes();
-    }
-
-    for (i = 0; i < NUM_VOICES; i++)
-    {
-        pSoundGenerator[i] = new Soundgenerator();
-        pSoundGenerator[i]->setVoiceNumber(i);
-    }
-
-    for (i = 0; i < NUM_VOICES; i++)
-    {
-        pCombFilter[i] = new CombFilter();
-    }
-
-    for (i = 0; i < NUM_VOICES; i++)
-    {
-        pSVFilter[i] = new StateVariableFilter();
-    }
+    pVoices = mArena.createArray<VoiceModules>(NUM_VOICES);
 
-    for (i = 0; i < NUM_VOICES; i++)
+    for (uint32_t i = 0; i < NUM_VOICES; i++)
     {
-        pFeedbackMixer[i] = new FeedbackMixer();
+        pVoices[i].mSoundGenerator.setVoiceNumber(i);
+        pVoices[i].mCombFilter.initDelayLines(mArena, mDelayFlush);
     }
 
-
-    pOutputMixer = new Outputmixer();
-    pFlanger = new Flanger();
-    pCabinet_L = new Cabinet();
-    pCabinet_R = new Cabinet();
-    pGapFilter = new GapFilter();
-    pEcho = new Echo();
-    pReverb = new Reverb();
+    pOutputMixer = mArena.create<Outputmixer>();
+    pFlanger = mArena.create<Flanger>();
+    pFlanger->initDelayLines(mArena, mDelayFlush);
+    pCabinet_L = mArena.create<Cabinet>();
+    pCabinet_R = mArena.create<Cabinet>();
+    pGapFilter = mArena.create<GapFilter>();
+    pEcho = mArena.create<Echo>();
+    pEcho->initDelayLines(mArena, mDelayFlush);
+    pReverb = mArena.create<Reverb>();
+    pReverb->initDelayLines(mArena, mDelayFlush);
 
     mainOut_L = 0.f;
     mainOut_R = 0.f;
 
     vallocInit();                                       // Voice allocation initialization
+
+    std::cout << "VoiceManager: " << footprint() << " bytes (combfilter: " << pVoices[0].mCombFilter.footprint();
+    std::cout << " per voice, flanger: " << pFlanger->footprint() << ", echo: " << pEcho->footprint();
+    std::cout << ", reverb: " << pReverb->footprint() << "), arena: " << mArena.mappedSize() << " bytes mapped";
+    std::cout << (mArena.mHugePages ? ", huge pages" : "") << std::endl;
 }
 
 
 
 /******************************************************************************/
-/** Voice Manager Destructor
- * @brief
+/** @brief    memory of the engine, the modules with delay lines report their own
 *******************************************************************************/
 
-VoiceManager::~VoiceManager()
+size_t VoiceManager::footprint() const
 {
-    delete pFadepointLowpass;
+    size_t size = sizeof(VoiceManager) + sizeof(BiquadFilters);
 
     for (uint32_t i = 0; i < NUM_VOICES; i++)
     {
-        delete pTest_Envelopes[i];
-        pTest_Envelopes[i] = NULL;
-
-        delete pSoundGenerator[i];
-        pSoundGenerator[i] = NULL;
+        size += sizeof(VoiceModules) - sizeof(CombFilter) + pVoices[i].mCombFilter.footprint();
+    }
 
-        delete pCombFilter[i];
-        pCombFilter[i] = NULL;
+    return size + sizeof(Outputmixer) + pFlanger->footprint() + 2 * sizeof(Cabinet) + sizeof(GapFilter)
+                + pEcho->footprint() + pReverb->footprint();
+}
 
-        delete pSVFilter[i];
-        pSVFilter[i] = NULL;
 
-        delete pFeedbackMixer[i];
-        pFeedbackMixer[i] = NULL;
-    }
 
+/******************************************************************************/
+/** Voice Manager Destructor
+ * @brief    the modules are destroyed by the engine arena
+*******************************************************************************/
 
-    delete pOutputMixer;
-    delete pFlanger;
-    delete pCabinet_L;
-    delete pCabinet_R;
-    delete pGapFilter;
-    delete pEcho;
-    delete pReverb;
+VoiceManager::~VoiceManager()
+{
 }
 
 /******************************************************************************/
@@ -116,6 +111,8 @@ VoiceManager::~VoiceManager()
 
 void VoiceManager::evalMidiEvents(unsigned char _instrID, unsigned char _ctrlID, float _ctrlVal)
 {
+    AllocationTrap trap;                                // the setters run on the audio thread (debug builds abort on allocation)
+
     /// Flushing test
     if (_ctrlID == 127)
     {
@@ -129,7 +126,7 @@ void VoiceManager::evalMidiEvents(unsigned char _instrID, unsigned char _ctrlID,
 
             for (uint32_t i = 0; i < NUM_VOICES; i++)
             {
-                pTest_Envelopes[i]->setEnvelopePramas(_ctrlID, _ctrlVal);
+                pVoices[i].mTest_Envelopes.setEnvelopePramas(_ctrlID, _ctrlVal);
             }
             break;
 
@@ -140,7 +137,7 @@ void VoiceManager::evalMidiEvents(unsigned char _instrID, unsigned char _ctrlID,
 
             for (uint32_t i = 0; i < NUM_VOICES; i++)
             {
-                pSoundGenerator[i]->setGenParams(_instrID, _ctrlID, _ctrlVal);
+                pVoices[i].mSoundGenerator.setGenParams(_instrID, _ctrlID, _ctrlVal);
             }
             break;
 
@@ -148,7 +145,7 @@ void VoiceManager::evalMidiEvents(unsigned char _instrID, unsigned char _ctrlID,
 
             for (uint32_t i = 0; i < NUM_VOICES; i++)
             {
-                pCombFilter[i]->setCombFilterParams(_ctrlID, _ctrlVal);
+                pVoices[i].mCombFilter.setCombFilterParams(_ctrlID, _ctrlVal);
             }
             break;
 
@@ -156,7 +153,7 @@ void VoiceManager::evalMidiEvents(unsigned char _instrID, unsigned char _ctrlID,
 
             for (uint32_t i = 0; i < NUM_VOICES; i++)
             {
-                pSVFilter[i]->setStateVariableFilterParams(_ctrlID, _ctrlVal);
+                pVoices[i].mSVFilter.setStateVariableFilterParams(_ctrlID, _ctrlVal);
             }
             break;
 
@@ -166,7 +163,7 @@ void VoiceManager::evalMidiEvents(unsigned char _instrID, unsigned char _ctrlID,
 
             for (uint32_t i = 0; i < NUM_VOICES; i++)
             {
-                pFeedbackMixer[i]->setFeedbackMixerParams(_ctrlID, _ctrlVal);
+                pVoices[i].mFeedbackMixer.setFeedbackMixerParams(_ctrlID, _ctrlVal);
             }
             break;
 
@@ -265,6 +262,8 @@ void VoiceManager::evalTCDEvents(unsigned char _status, unsigned char _data_0, u
 
 void VoiceManager::voiceLoop()
 {
+    AllocationTrap trap;
+
     //************************* Global Fade Points **************************//
 
 //#define LOWPASSFLUSH
@@ -283,22 +282,24 @@ void VoiceManager::voiceLoop()
     //***************************** Main DSP Loop ***************************//
     for (uint32_t voiceNumber = 0; voiceNumber < NUM_VOICES; voiceNumber++)
     {
+        VoiceModules& voice = pVoices[voiceNumber];
+
 #if 1
         /// Global Array
-        pTest_Envelopes[voiceNumber]->applyEnvelope(PARAMSIGNALDATA[voiceNumber]);
-        pSoundGenerator[voiceNumber]->generateSound(pFeedbackMixer[voiceNumber]->mFeedbackOut, PARAMSIGNALDATA[voiceNumber]);
+        voice.mTest_Envelopes.applyEnvelope(PARAMSIGNALDATA[voiceNumber]);
+        voice.mSoundGenerator.generateSound(voice.mFeedbackMixer.mFeedbackOut, PARAMSIGNALDATA[voiceNumber]);
 #endif
 #if 0
         /// No Array
-        pTest_Envelopes[voiceNumber]->applyEnvelope();
-        pSoundGenerator[voiceNumber]->generateSound(pFeedbackMixer[voiceNumber]->mFeedbackOut, pTest_Envelopes[voiceNumber]->mEnvRamp_A, pEnvelopes[voiceNumber]->mEnvRamp_B, pEnvelopes[voiceNumber]->mEnvRamp_C, pEnvelopes[voiceNumber]->mGateRamp);
+        voice.mTest_Envelopes.applyEnvelope();
+        voice.mSoundGenerator.generateSound(voice.mFeedbackMixer.mFeedbackOut, voice.mTest_Envelopes.mEnvRamp_A, voice.mTest_Envelopes.mEnvRamp_B, voice.mTest_Envelopes.mEnvRamp_C, voice.mTest_Envelopes.mGateRamp);
 #endif
 
-        pCombFilter[voiceNumber]->mFlushFade = fadePoint;
-        pCombFilter[voiceNumber]->applyCombFilter(pSoundGenerator[voiceNumber]->mSampleA, pSoundGenerator[voiceNumber]->mSampleB);
-        pSVFilter[voiceNumber]->applyStateVariableFilter(pSoundGenerator[voiceNumber]->mSampleA, pSoundGenerator[voiceNumber]->mSampleB, pCombFilter[voiceNumber]->mCombFilterOut);
-        pFeedbackMixer[voiceNumber]->applyFeedbackMixer(pCombFilter[voiceNumber]->mCombFilterOut, pSVFilter[voiceNumber]->mSVFilterOut, pReverb->mFeedbackOut);
-        pOutputMixer->applyOutputMixer(voiceNumber, pSoundGenerator[voiceNumber]->mSampleA, pSoundGenerator[voiceNumber]->mSampleB, pCombFilter[voiceNumber]->mCombFilterOut, pSVFilter[voiceNumber]->mSVFilterOut);
+        voice.mCombFilter.mFlushFade = fadePoint;
+        voice.mCombFilter.applyCombFilter(voice.mSoundGenerator.mSampleA, voice.mSoundGenerator.mSampleB);
+        voice.mSVFilter.applyStateVariableFilter(voice.mSoundGenerator.mSampleA, voice.mSoundGenerator.mSampleB, voice.mCombFilter.mCombFilterOut);
+        voice.mFeedbackMixer.applyFeedbackMixer(voice.mCombFilter.mCombFilterOut, voice.mSVFilter.mSVFilterOut, pReverb->mFeedbackOut);
+        pOutputMixer->applyOutputMixer(voiceNumber, voice.mSoundGenerator.mSampleA, voice.mSoundGenerator.mSampleB, voice.mCombFilter.mCombFilterOut, voice.mSVFilter.mSVFilterOut);
     }
 
 #ifdef LOWPASSFLUSH
@@ -318,17 +319,17 @@ void VoiceManager::voiceLoop()
 #else
     if (mFlushNow)
     {
-        if (mFadepointCounter == FLUSH_INDEX)
+        if (mFadepointCounter != FLUSH_INDEX || mDelayFlush.done())     // muted point: the fade holds, until all delay lines are clear
         {
-            flushAllBuffer();
-        }
+            mFadepointCounter++;
 
-        if (mFadepointCounter > FADE_SAMPLES)
-        {
-            mFadepointCounter = 0;
-            mFlushNow = false;
+            if (mFadepointCounter == FADE_SAMPLES)
+            {
+                mFadepointCounter = 0;
+                mFlushNow = false;
+                mDelayFlush.restart();
+            }
         }
-        mFadepointCounter++;
     }
 #endif
 
@@ -355,7 +356,7 @@ void VoiceManager::voiceLoop()
 
     //********************************* Reverb ******************************//
 
-    pReverb->applyReverb(pEcho->mEchoOut_L, pEcho->mEchoOut_R, pFeedbackMixer[0]->mReverbLevel);
+    pReverb->applyReverb(pEcho->mEchoOut_L, pEcho->mEchoOut_R, pVoices[0].mFeedbackMixer.mReverbLevel);
 
 
     //******************************* Soft Clip *****************************//
@@ -475,12 +476,12 @@ void VoiceManager::vallocProcess(uint32_t _keyDirection, float _pitch, float _ve
 
         float offsetPitch = _pitch - 60.f;
 
-        pTest_Envelopes[v]->setEnvelope(_velocity/ 127.f);
-        pSoundGenerator[v]->setPitch(offsetPitch);
-        pSoundGenerator[v]->resetPhase();
-        pCombFilter[v]->setPitch(offsetPitch);
-        pSVFilter[v]->setPitch(offsetPitch);
-        pFeedbackMixer[v]->setPitchInfluence(offsetPitch);
+        pVoices[v].mTest_Envelopes.setEnvelope(_velocity/ 127.f);
+        pVoices[v].mSoundGenerator.setPitch(offsetPitch);
+        pVoices[v].mSoundGenerator.resetPhase();
+        pVoices[v].mCombFilter.setPitch(offsetPitch);
+        pVoices[v].mSVFilter.setPitch(offsetPitch);
+        pVoices[v].mFeedbackMixer.setPitchInfluence(offsetPitch);
 
         pOutputMixer->setKeyPitch(v, _pitch);
         pFlanger->triggerLFO(_velocity/127.f);
@@ -520,7 +521,7 @@ void VoiceManager::vallocProcess(uint32_t _keyDirection, float _pitch, float _ve
 
                 vVoiceState[v] = -1;
 
-                pTest_Envelopes[v]->killEnvelope();
+                pVoices[v].mTest_Envelopes.killEnvelope();
                 break;
             }
         }
@@ -529,6 +530,26 @@ void VoiceManager::vallocProcess(uint32_t _keyDirection, float _pitch, float _ve
 
 
 
+/******************************************************************************/
+/** @brief    period loop function, called once per period after voiceLoop()
+ *            of all its samples: clears the next chunk of the delay lines,
+ *            while a flush fade holds at its muted point
+*******************************************************************************/
+
+void VoiceManager::periodLoop()
+{
+#ifndef LOWPASSFLUSH
+    if (mFlushNow && mFadepointCounter == FLUSH_INDEX)
+    {
+        mDelayFlush.step();
+    }
+#endif
+
+    pEcho->stepFlush();                             // the echo flush trigger only clears the echo
+}
+
+
+
 /*****************************************************************************/
 /** @brief    sets all Delay Buffer to zero, when the preset changes for example
 ******************************************************************************/
@@ -541,6 +562,6 @@ void VoiceManager::flushAllBuffer()
 
     for (uint32_t voiceNumber = 0; voiceNumber < NUM_VOICES; voiceNumber++)
     {
-        pCombFilter[voiceNumber]->resetBuffer();
+        pVoices[voiceNumber].mCombFilter.resetBuffer();
     }
 }
@@ -28,10 +28,22 @@
 #include "flanger.h"
 #include "echo.h"
 #include "reverb.h"
+#include "engine_arena.h"
+#include "allocation_trap.h"
 
 #include <vector>
 #include <array>
 
+/* the modules of one voice in processing order, the voices follow each other in the engine arena */
+struct alignas(ENGINE_ARENA_ALIGNMENT) VoiceModules
+{
+    Test_Envelopes mTest_Envelopes;
+    Soundgenerator mSoundGenerator;
+    CombFilter mCombFilter;
+    StateVariableFilter mSVFilter;
+    FeedbackMixer mFeedbackMixer;
+};
+
 class VoiceManager{
 public:
     VoiceManager();                 // Default Constructor
@@ -41,10 +53,12 @@ public:
     float mainOut_L, mainOut_R;     // fully processed samples
 
     void voiceLoop();
+    void periodLoop();              // once per period, after voiceLoop() of all its samples
     void evalMidiEvents(unsigned char _instrID, unsigned char _ctrlID, float _ctrlVal);
     void evalTCDEvents(unsigned char _status, unsigned char _data_0, unsigned char _data_1);
 
     void flushAllBuffer();
+    size_t footprint() const;       // memory of the engine, the modules and their delay lines
 private:
 
     //************************ Fadepoint Lowpass *********************************//
@@ -55,19 +69,17 @@ private:
     uint32_t mFadepointCounter;
 
     std::array<float, FADE_SAMPLES > mRaisedCosineTable;
+    DelayFlush mDelayFlush;         // clears all delay lines in chunks (one per period) at the muted point of the fade
 
 
-    //*************************** Envelopes ***************************************//
+    //**************************** Engine Arena ***********************************//
 
-    Test_Envelopes* pTest_Envelopes[NUM_VOICES];
+    EngineArena mArena;             // holds the fade point lowpass and all modules below
 
 
-    //******************** Sound Generating Modules *******************************//
+    //************************ Envelopes and Sound Generating Modules *************//
 
-    Soundgenerator* pSoundGenerator[NUM_VOICES];
-    CombFilter* pCombFilter[NUM_VOICES];
-    StateVariableFilter* pSVFilter[NUM_VOICES];
-    FeedbackMixer* pFeedbackMixer[NUM_VOICES];
+    VoiceModules* pVoices;          // [NUM_VOICES]
 
 
     //***************************** Mixers ****************************************//
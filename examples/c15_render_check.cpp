@@ -0,0 +1,118 @@
+/*
+ * c15_render_check - offline comparison of the rendering paths of the dsp host
+ *
+ * The same TCD sequence (notes, voice stealing, a preset recall with transition time and a flush)
+ * is rendered twice: sample by sample with tickMain(), which runs the per voice reference chain,
+ * and in blocks of varying size with tickBlock(), which runs the voice parallel SIMD bank
+ * (or the per voice block chain, if built with dsp_poly_simd=0). Every sample has to match bit
+ * for bit, so the engine has to be built without floating point contraction (-ffp-contract=off).
+ *
+ * No audio or midi device is involved.
+ */
+
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <cstring>
+#include <stdlib.h>
+#include <getopt.h>
+
+#include "c15_audio_engine/dsp_host.h"
+
+using namespace std;
+
+void usage(const char* name)
+{
+    std::cout << "usage:" << std::endl <<
+                 "   " << name << ":" << std::endl <<
+                 "        -s" << " Samplerate in Hz (default=48000)" << std::endl <<
+                 "        -v" << " Voice count (default=20)" << std::endl <<
+                 "        -t" << " Rendering threads of the block path (default=1)" << std::endl <<
+                 "        -p" << " Periodes to render (default=2000)" << std::endl;
+
+    exit(EXIT_SUCCESS);
+}
+
+// Both hosts receive the same events at the same sample positions (periode starts)
+void sendEvents(dsp_host &host, uint32_t periode)
+{
+    if (periode % 50 == 0) {
+        host.governVoices(periode > 300 && periode < 900 ? 0.9f : 0.1f);
+        host.testNoteOn(40 + periode % 37, 100);
+    }
+    if (periode % 50 == 25)
+        host.testNoteOff(40 + (periode - 25) % 37, 60);
+    if (periode == 500) {
+        host.testSetGlobalTime(200);
+        host.testLoadPreset(1);
+    }
+    if (periode == 700)
+        host.testFlush();
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t samplerate = 48000;
+    uint32_t voices = 20;
+    uint32_t threads = 1;
+    uint32_t periodes = 2000;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:v:t:p:h")) != -1) {
+        switch (opt) {
+        case 's': samplerate = atoi(optarg); break;
+        case 'v': voices = atoi(optarg); break;
+        case 't': threads = atoi(optarg); break;
+        case 'p': periodes = atoi(optarg); break;
+        default: usage(argv[0]);
+        }
+    }
+
+    // The hosts are too large for the stack
+    std::unique_ptr<dsp_host> reference(new dsp_host());
+    std::unique_ptr<dsp_host> block(new dsp_host());
+    reference->init(samplerate, voices);
+    block->init(samplerate, voices);
+    reference->testInit();
+    block->testInit();
+#if dsp_poly_simd == 1
+    block->m_workers.start(threads, Nl::RealtimePolicy());
+#endif
+
+    std::vector<float> referenceL, referenceR, blockL(256), blockR(256);
+    uint64_t frames = 0, mismatches = 0;
+
+    for (uint32_t periode = 0; periode < periodes; periode++) {
+        sendEvents(*reference, periode);
+        sendEvents(*block, periode);
+
+        // Odd and changing periode sizes, so sub-blocks start at every clock position
+        const uint32_t n = 1 + (periode * 37) % 256;
+        referenceL.resize(n);
+        referenceR.resize(n);
+
+        for (uint32_t f = 0; f < n; f++) {
+            reference->tickMain();
+            referenceL[f] = reference->m_mainOut_L;
+            referenceR[f] = reference->m_mainOut_R;
+        }
+        reference->tickPeriod();
+
+        block->tickBlock(blockL.data(), blockR.data(), n);
+
+        for (uint32_t f = 0; f < n; f++, frames++) {
+            if (memcmp(&referenceL[f], &blockL[f], sizeof(float)) || memcmp(&referenceR[f], &blockR[f], sizeof(float))) {
+                if (mismatches == 0)
+                    std::cout << "### first mismatch at frame " << frames << " (periode " << periode << "): "
+                              << referenceL[f] << " / " << blockL[f] << std::endl;
+                mismatches++;
+            }
+        }
+    }
+
+    std::cout << "c15_render_check: " << frames << " frames, " << mismatches << " mismatches"
+              << " (samplerate " << samplerate << ", voices " << reference->m_voices
+              << ", dsp_poly_simd " << dsp_poly_simd << ", threads " << threads << ")" << std::endl;
+
+    return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
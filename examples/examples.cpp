@@ -44,10 +44,10 @@ void inToOutCallbackWithMidi(u_int8_t *in, u_int8_t *out,
 							 const SampleSpecs &sampleSpecs __attribute__ ((unused)),
 							 SharedUserPtr ptr __attribute__ ((unused)))
 {
-	static int counter = 0;
-	//StopBlockTime sft(&sw, "val" + std::to_string(counter++));
+	// Measures the time between two callbacks
+	static const StopWatch::ScopeId scope = sw.scope("inToOutWithMidi");
 	sw.stop();
-	sw.start("val" + std::to_string(counter++));
+	sw.start(scope);
 
 	// Midi Stuff
 	static float curVolumeFactor = 1.f;
@@ -9,7 +9,7 @@
 
 using namespace Nl;
 
-std::shared_ptr<StopWatch> sw(new StopWatch("AudioCallback", 10000, Nl::StopWatch::SUMMARY));
+std::shared_ptr<StopWatch> sw(new StopWatch("AudioCallback", Nl::StopWatch::SUMMARY));
 
 
 
@@ -31,7 +31,7 @@ int main()
 
 		while(getchar() != 'q')
 		{
-			std::cout << sw << std::endl;
+			std::cout << *sw << std::endl;
 
 			if (handle.audioOutput) std::cout << "Audio: Output Statistics:" << std::endl
 											  << handle.audioOutput->getStats() << std::endl;
@@ -45,7 +45,7 @@ int main()
 						  << "rxBytes=" << rxBytes << "  txBytes=" << txBytes << std::endl;
 			}
 
-			std::cout << "BufferCount: " << handle.audioInput->getBufferCount() << std::endl;
+			if (handle.audioInput) std::cout << "BufferCount: " << handle.audioInput->getBufferCount() << std::endl;
 		}
 
 		// Tell worker thread to cleanup and quit
@@ -70,10 +70,10 @@ void inToOutCallback(u_int8_t *in,
 					 const SampleSpecs &sampleSpecs __attribute__ ((unused)),
 					 SharedUserPtr ptr __attribute__ ((unused)))
 {
-	//static int counter = 0;
-	//StopBlockTime sft(sw, "val" + std::to_string(counter++));
+	//static const StopWatch::ScopeId scope = sw->scope("inToOut");
+	//StopBlockTime sft(sw, scope);
 
-	memcpy(out, in, sampleSpecs.buffersizeInBytes);
+	memcpy(out, in, sampleSpecs.buffersizeInBytesPerPeriode);
 }
 
 JobHandle inputToOutput(const AlsaAudioCardIdentifier &inCard, const AlsaAudioCardIdentifier &outCard, unsigned int buffersize, unsigned int samplerate)
@@ -84,6 +84,16 @@ JobHandle inputToOutput(const AlsaAudioCardIdentifier &inCard, const AlsaAudioCa
 	// To terminate this example, call:
 	// terminateWorkingThread(handle)
 	JobHandle ret;
+	SharedUserPtr ptr(new UserPtr("unused", nullptr));
+
+	// Capture and playback on the same card run linked in a single thread
+	if (inCard.getCardString() == outCard.getCardString()) {
+		ret.audioOutput = createAlsaDuplexDevice(outCard, buffersize);
+		ret.audioOutput->setSamplerate(samplerate);
+		registerInOutCallbackOnDevice(ret.audioOutput, inToOutCallback, ptr);
+		ret.audioOutput->start();
+		return ret;
+	}
 
 	ret.inBuffer = createBuffer("InputBuffer");
 	ret.audioInput = createAlsaInputDevice(inCard, ret.inBuffer, buffersize);
@@ -102,7 +112,6 @@ JobHandle inputToOutput(const AlsaAudioCardIdentifier &inCard, const AlsaAudioCa
 	ret.audioOutput->start();
 	ret.audioInput->start();
 
-	SharedUserPtr ptr(new UserPtr("unused", nullptr));
 	ret.workingThreadHandle = registerInOutCallbackOnBuffer(ret.inBuffer, ret.outBuffer, inToOutCallback, ptr);
 
 	return ret;
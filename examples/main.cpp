@@ -75,12 +75,9 @@ int main()
 
         // Wait for user to exit by pressing 'q'
         // Print buffer statistics on other keys
-        // TODO: We might have a deadlock here:
-        //		 sw.printSummary() holds a lock
-        //		 audioXX->getStats() holds a lock
-        //		 inMidiBuffer->getStats() holds a lock
-        //	     The calls should happen in this order. Otherwise we trigger
-        //		 a deadlock with the audio callback.
+        // Printing the StopWatch does not lock the audio callback, it only drains the histograms.
+        // TODO: audioXX->getStats() and inMidiBuffer->getStats() still hold a lock, that is shared
+        //       with the audio thread.
 
 		//while(true) {
         while(getchar() != 'q')
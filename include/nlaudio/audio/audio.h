@@ -31,6 +31,7 @@
 #include <memory>
 
 #include "common/bufferstatistics.h"
+#include "common/realtimepolicy.h"
 
 namespace Nl {
 
@@ -252,6 +253,18 @@ public:
 	 */
 	virtual BufferStatistics getStats() = 0;
 
+	/** \ingroup Audio
+	 *
+	 * \brief Sets the RealtimePolicy for the working thread of the interface
+	 *
+	 * The working thread applies the policy to itself, when it is started.
+	 * Has to be called before start().
+	 */
+	virtual void setRealtimePolicy(const RealtimePolicy &policy) { m_realtimePolicy = policy; }
+	const RealtimePolicy& getRealtimePolicy() const { return m_realtimePolicy; }
+
+protected:
+	RealtimePolicy m_realtimePolicy;
 };
 
 /*! A shared handle to a \ref Audio instance */
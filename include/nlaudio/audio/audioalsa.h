@@ -24,6 +24,7 @@
 #include <atomic>
 #include <thread>
 #include <iosfwd>
+#include <vector>
 
 #include "audio/audio.h"
 #include "common/alsa/alsacardidentifier.h"
@@ -68,6 +69,11 @@ public:
 
 	virtual BufferStatistics getStats();
 
+	virtual void setAccessMode(snd_pcm_access_t access);
+	virtual snd_pcm_access_t getAccessMode() const;
+	bool isMmap() const { return m_accessMode == SND_PCM_ACCESS_MMAP_INTERLEAVED || m_accessMode == SND_PCM_ACCESS_MMAP_NONINTERLEAVED; }
+	bool isInterleaved() const { return m_accessMode == SND_PCM_ACCESS_RW_INTERLEAVED || m_accessMode == SND_PCM_ACCESS_MMAP_INTERLEAVED; }
+
 protected:
 	void openCommon();
 	void throwOnDeviceClosed(const std::string &file, const std::string &func, int line) const;
@@ -77,16 +83,23 @@ protected:
 	void resetTerminateRequest() { m_requestTerminate.store(false); }
 	bool getTerminateRequest() const { return m_requestTerminate; }
 	SampleSpecs getSpecs();
+	const AlsaAudioCardIdentifier& getCard() const { return m_card; }
 
 	static int xrunRecovery(AudioAlsa *ptr, int err);
 
+	static std::vector<void*> getChannelPointers(u_int8_t *buffer, const SampleSpecs &specs);
+	snd_pcm_sframes_t readPeriode(snd_pcm_t *handle, u_int8_t *buffer, std::vector<void*> &channels, snd_pcm_uframes_t frames);
+	snd_pcm_sframes_t writePeriode(snd_pcm_t *handle, u_int8_t *buffer, std::vector<void*> &channels, snd_pcm_uframes_t frames);
+
 protected:
 	snd_pcm_t *m_handle;
 	std::thread *m_audioThread;
 	snd_pcm_hw_params_t *m_hwParams;
 	std::atomic<bool> m_requestTerminate;
 	std::atomic<unsigned int> m_xrunRecoveryCounter;
+	std::atomic<unsigned int> m_bufferXrunCounter;
 	SharedBufferHandle m_audioBuffer;
+	snd_pcm_access_t m_accessMode;
 
 	void throwOnAlsaError(const std::string &file, const std::string &func, int line, int e) const;
 private:
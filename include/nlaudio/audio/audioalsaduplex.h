@@ -0,0 +1,82 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#pragma once
+
+#include "audioalsa.h"
+#include "audio/audiocallback.h"
+#include "audio/sampleconversion.h"
+
+namespace Nl {
+
+/** \ingroup Audio
+ *
+ * \brief Full duplex device on a single card
+ *
+ * Opens capture and playback on the same card, links both streams using
+ * snd_pcm_link() and runs read -> callback -> write in one SCHED_FIFO thread.
+ * All hardware parameters are applied to both streams, start() fails if
+ * they do not end up with the same periode.
+ *
+ * The playback stream is handled by the AudioAlsa base class, the capture
+ * stream is owned by this class.
+ *
+*/
+class AudioAlsaDuplex : public AudioAlsa
+{
+public:
+	typedef AudioAlsa basetype;
+
+	AudioAlsaDuplex(const AlsaAudioCardIdentifier &card);
+	virtual ~AudioAlsaDuplex();
+
+	virtual void open();
+	virtual void close();
+	virtual void start();
+	virtual void stop();
+	virtual void init();
+
+	virtual void setBuffersize(unsigned int buffersize);
+	virtual void setBufferCount(unsigned int buffercount);
+	virtual void setSamplerate(samplerate_t rate);
+	virtual void setSampleFormat(sampleformat_t format);
+	virtual void setChannelCount(channelcount_t n);
+	virtual void setAccessMode(snd_pcm_access_t access);
+
+	void setCallback(AudioCallbackInOut callback, SharedUserPtr ptr);
+	void setCallback(AudioCallbackFloatInOut callback, SharedUserPtr ptr);
+
+	static void worker(SampleSpecs specs, AudioAlsaDuplex *ptr);
+
+private:
+	void throwOnPeriodeMismatch();
+	void restartLinked(const SampleSpecs &specs, u_int8_t *silence, std::vector<void*> &silenceChannels);
+
+	snd_pcm_t *m_captureHandle;
+	snd_pcm_hw_params_t *m_captureHwParams;
+
+	AudioCallbackInOut m_callback;
+	AudioCallbackFloatInOut m_floatCallback;
+	SharedUserPtr m_userPtr;
+
+	FloatPeriode m_floatIn;
+	FloatPeriode m_floatOut;
+};
+
+typedef std::shared_ptr<AudioAlsaDuplex> SharedAudioAlsaDuplexHandle;
+
+} // Namespace Nl
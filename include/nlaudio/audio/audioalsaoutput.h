@@ -20,6 +20,8 @@
 #pragma once
 
 #include "audioalsa.h"
+#include "audio/audiocallback.h"
+#include "audio/sampleconversion.h"
 
 namespace Nl {
 
@@ -35,7 +37,23 @@ public:
 	virtual void stop();
 	virtual void init();
 
+	void setCallback(AudioCallbackOut callback, SharedUserPtr ptr);
+	void setCallback(SharedBufferHandle inBuffer, AudioCallbackInOut callback, SharedUserPtr ptr);
+	void setCallback(AudioCallbackFloatOut callback, SharedUserPtr ptr);
+
 	static void worker(SampleSpecs specs, AudioAlsaOutput *ptr);
+	static void mmapWorker(SampleSpecs specs, AudioAlsaOutput *ptr);
+
+private:
+	void renderPeriode(u_int8_t *buffer, u_int8_t *inBuffer, const SampleSpecs &specs);
+	bool hasCallback() const { return m_callback || m_inOutCallback || m_floatCallback; }
+
+	AudioCallbackOut m_callback;
+	AudioCallbackInOut m_inOutCallback;
+	AudioCallbackFloatOut m_floatCallback;
+	FloatPeriode m_floatPeriode;
+	SharedBufferHandle m_inBuffer;
+	SharedUserPtr m_userPtr;
 };
 
 typedef std::shared_ptr<AudioAlsaOutput> SharedAudioAlsaOutputHandle;
@@ -0,0 +1,79 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#pragma once
+
+#include <cstring>
+
+namespace Nl {
+
+/** \ingroup Audio
+ *
+ * \brief Non owning view on channels x frames float samples
+ *
+ * Each channel is addressed by its own pointer, consecutive frames of a channel are
+ * \a stride floats apart. A planar periode (see FloatPeriode) has a stride of 1. An
+ * interleaved periode can be viewed with channel pointers data, data + 1, ... and a
+ * stride equal to the channel count.
+ *
+ * The view is cheap to copy and never allocates, so it can be passed around on the audio thread.
+ *
+*/
+class AudioBlock
+{
+public:
+	AudioBlock() :
+		m_channels(nullptr),
+		m_channelCount(0),
+		m_frames(0),
+		m_stride(1) {}
+
+	AudioBlock(float* const* channels, unsigned int channelCount, unsigned int frames, unsigned int stride = 1) :
+		m_channels(channels),
+		m_channelCount(channelCount),
+		m_frames(frames),
+		m_stride(stride) {}
+
+	float* channel(unsigned int channel) const { return m_channels[channel]; }
+	float* const* channels() const { return m_channels; }
+	unsigned int channelCount() const { return m_channelCount; }
+	unsigned int frames() const { return m_frames; }
+	unsigned int stride() const { return m_stride; }
+	bool isContiguous() const { return m_stride == 1; }
+
+	float& operator()(unsigned int channel, unsigned int frame) const { return m_channels[channel][frame * m_stride]; }
+
+	void clear() const
+	{
+		for (unsigned int c=0; c<m_channelCount; c++) {
+			if (isContiguous()) {
+				memset(m_channels[c], 0, m_frames * sizeof(float));
+			} else {
+				for (unsigned int f=0; f<m_frames; f++)
+					m_channels[c][f * m_stride] = 0.f;
+			}
+		}
+	}
+
+private:
+	float* const* m_channels;
+	unsigned int m_channelCount;
+	unsigned int m_frames;
+	unsigned int m_stride;
+};
+
+} // namespace Nl
@@ -0,0 +1,62 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  Authors: Pascal Huerst <pascal.huerst@gmail.com>
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <stdint.h>
+
+#include "audio/samplespecs.h"
+
+namespace Nl {
+
+/**
+ * \brief The User Pointer struct
+ *
+ * A handle that is passed to the audio callbacks for userdata
+ *
+ */
+struct UserPtr {
+    UserPtr() :
+        info("unused"),
+        ptr(nullptr) {}
+    UserPtr(const std::string info, void* ptr) :
+        info(info),
+        ptr(ptr) {}
+    std::string info; /**< A description of the type passed */
+    void *ptr;	/**< The actual user pointer */
+};
+
+typedef std::shared_ptr<UserPtr> SharedUserPtr;
+
+typedef void (*AudioCallbackIn)(uint8_t*, const SampleSpecs &specs, SharedUserPtr ptr);
+typedef void (*AudioCallbackOut)(uint8_t*, const SampleSpecs &specs, SharedUserPtr ptr);
+typedef void (*AudioCallbackInOut)(uint8_t*, uint8_t*, const SampleSpecs &specs, SharedUserPtr ptr);
+
+/**
+ * Float callbacks get one pointer per channel, each pointing to \a frames contiguous
+ * samples in the range -1.0 ... 1.0. The conversion from and to the device format
+ * is done by the device, \a specs still describe the device side.
+ */
+typedef void (*AudioCallbackFloatIn)(float* const* in, unsigned int frames, const SampleSpecs &specs, SharedUserPtr ptr);
+typedef void (*AudioCallbackFloatOut)(float* const* out, unsigned int frames, const SampleSpecs &specs, SharedUserPtr ptr);
+typedef void (*AudioCallbackFloatInOut)(const float* const* in, float* const* out, unsigned int frames, const SampleSpecs &specs, SharedUserPtr ptr);
+
+} // namespace Nl
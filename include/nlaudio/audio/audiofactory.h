@@ -30,36 +30,24 @@
 #include <map>
 #include <memory>
 #include <thread>
+#include <chrono>
+#include <algorithm>
 
 #include "common/blockingcircularbuffer.h"
+#include "common/nonblockingcircularbuffer.h"
+#include "audio/audiocallback.h"
+#include "audio/sampleconversion.h"
 #include "audio/audioalsainput.h"
 #include "audio/audioalsaoutput.h"
+#include "audio/audioalsaduplex.h"
 #include "midi/rawmididevice.h"
 #include "audio/audioalsaexception.h"
+#include "common/realtimepolicy.h"
 
 #include "audio/audiojack.h"
 
 namespace Nl {
 
-/**
- * \brief The User Pointer struct
- *
- * A handle that is passed to the audio callbacks for userdata
- *
- */
-struct UserPtr {
-    UserPtr() :
-        info("unused"),
-        ptr(nullptr) {}
-    UserPtr(const std::string info, void* ptr) :
-        info(info),
-        ptr(ptr) {}
-    std::string info; /**< A description of the type passed */
-    void *ptr;	/**< The actual user pointer */
-};
-
-typedef std::shared_ptr<UserPtr> SharedUserPtr;
-
 class AudioAlsaInput;
 class AudioAlsaOutput;
 class RawMidiDevice;
@@ -67,10 +55,6 @@ class RawMidiDevice;
 /*! A shared handle to a \ref std::atomic<bool> */
 typedef std::shared_ptr<std::atomic<bool>> SharedTerminateFlag;
 
-typedef void (*AudioCallbackIn)(uint8_t*, const SampleSpecs &specs, SharedUserPtr ptr);
-typedef void (*AudioCallbackOut)(uint8_t*, const SampleSpecs &specs, SharedUserPtr ptr);
-typedef void (*AudioCallbackInOut)(uint8_t*, uint8_t*, const SampleSpecs &specs, SharedUserPtr ptr);
-
 /*! A shared handle to a \ref std::thread */
 typedef std::shared_ptr<std::thread> SharedThreadHandle;
 
@@ -100,51 +84,109 @@ struct JobHandle {
 
 
 // Factory Functions
-SharedRawMidiDeviceHandle createRawMidiDevice(const AlsaMidiCardIdentifier &card, SharedBufferHandle buffer);
+SharedRawMidiDeviceHandle createRawMidiDevice(const AlsaMidiCardIdentifier &card, SharedBufferHandle buffer,
+                                              const RealtimePolicy &policy = RealtimePolicy());
 
 SharedTerminateFlag createTerminateFlag();
 
 SharedBufferHandle createBuffer(const std::string& name);
+SharedBufferHandle createNonBlockingBuffer(const std::string& name);
 SharedBufferHandle getBufferForName(const std::string& name);
 
 void terminateWorkingThread(WorkingThreadHandle handle);
 
-SharedAudioHandle createJackInputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize);
-SharedAudioHandle createJackOutputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize);
+SharedAudioHandle createJackInputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize,
+                                        const RealtimePolicy &policy = RealtimePolicy());
+SharedAudioHandle createJackOutputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize,
+                                         const RealtimePolicy &policy = RealtimePolicy());
 
 SharedAudioHandle createDefaultInputDevice(SharedBufferHandle buffer);
 SharedAudioHandle createAlsaInputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer);
-SharedAudioHandle createAlsaInputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize);
+SharedAudioHandle createAlsaInputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize,
+                                        const RealtimePolicy &policy = RealtimePolicy());
 
 SharedAudioHandle createDefaultOutputDevice(SharedBufferHandle buffer);
 SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer);
-SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize);
+SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize,
+                                         const RealtimePolicy &policy = RealtimePolicy());
+
+SharedAudioHandle createAlsaDuplexDevice(const AlsaAudioCardIdentifier &card, unsigned int buffersize,
+                                         const RealtimePolicy &policy = RealtimePolicy());
 
 WorkingThreadHandle registerInputCallbackOnBuffer(SharedBufferHandle inBuffer,
                                                   AudioCallbackIn callback,
-                                                  SharedUserPtr ptr);
+                                                  SharedUserPtr ptr,
+                                                  const RealtimePolicy &policy = RealtimePolicy());
 WorkingThreadHandle registerOutputCallbackOnBuffer(SharedBufferHandle outBuffer,
                                                    AudioCallbackOut callback,
-                                                   SharedUserPtr ptr);
+                                                   SharedUserPtr ptr,
+                                                   const RealtimePolicy &policy = RealtimePolicy());
 WorkingThreadHandle registerInOutCallbackOnBuffer(SharedBufferHandle inBuffer,
                                                   SharedBufferHandle outBuffer,
                                                   AudioCallbackInOut callback,
-                                                  SharedUserPtr ptr);
+                                                  SharedUserPtr ptr,
+                                                  const RealtimePolicy &policy = RealtimePolicy());
 WorkingThreadHandle registerAutoDrainOnBuffer(SharedBufferHandle inBuffer);
 
+WorkingThreadHandle registerInputCallbackOnBuffer(SharedBufferHandle inBuffer,
+                                                  AudioCallbackFloatIn callback,
+                                                  SharedUserPtr ptr,
+                                                  const RealtimePolicy &policy = RealtimePolicy());
+WorkingThreadHandle registerOutputCallbackOnBuffer(SharedBufferHandle outBuffer,
+                                                   AudioCallbackFloatOut callback,
+                                                   SharedUserPtr ptr,
+                                                   const RealtimePolicy &policy = RealtimePolicy());
+WorkingThreadHandle registerInOutCallbackOnBuffer(SharedBufferHandle inBuffer,
+                                                  SharedBufferHandle outBuffer,
+                                                  AudioCallbackFloatInOut callback,
+                                                  SharedUserPtr ptr,
+                                                  const RealtimePolicy &policy = RealtimePolicy());
+
+void registerOutputCallbackOnDevice(SharedAudioHandle output,
+                                    AudioCallbackOut callback,
+                                    SharedUserPtr ptr);
+void registerInOutCallbackOnDevice(SharedBufferHandle inBuffer,
+                                   SharedAudioHandle output,
+                                   AudioCallbackInOut callback,
+                                   SharedUserPtr ptr);
+void registerInOutCallbackOnDevice(SharedAudioHandle duplex,
+                                   AudioCallbackInOut callback,
+                                   SharedUserPtr ptr);
+
+void registerOutputCallbackOnDevice(SharedAudioHandle output,
+                                    AudioCallbackFloatOut callback,
+                                    SharedUserPtr ptr);
+void registerInOutCallbackOnDevice(SharedAudioHandle duplex,
+                                   AudioCallbackFloatInOut callback,
+                                   SharedUserPtr ptr);
+
+sampleformat_t negotiateSampleFormat(SharedAudioHandle device);
+
+// Time to sleep, before a non blocking buffer is polled again. A quarter of a periode.
+inline std::chrono::microseconds bufferPollInterval(const SampleSpecs& sampleSpecs)
+{
+    return std::chrono::microseconds(std::max(50, static_cast<int>(sampleSpecs.latency * 250.0)));
+}
+
 // Thread function, that handles blocking io calls on the buffers
 auto readAudioFunction = [](SharedBufferHandle audioBuffer,
 AudioCallbackIn callback,
-SharedTerminateFlag terminateRequest, SharedUserPtr ptr)
+SharedTerminateFlag terminateRequest, SharedUserPtr ptr, RealtimePolicy policy)
 {
+    applyRealtimePolicy(policy, "nlaudio_read");
 
     SampleSpecs sampleSpecs = audioBuffer->sampleSpecs();
 
     const int buffersize = sampleSpecs.buffersizeInBytesPerPeriode;
     u_int8_t *buffer = new u_int8_t[buffersize];
 
+    const auto pollInterval = bufferPollInterval(sampleSpecs);
+
     while(!terminateRequest->load()) {
-        audioBuffer->get(buffer, buffersize);
+        if (!audioBuffer->get(buffer, buffersize)) {
+            std::this_thread::sleep_for(pollInterval);
+            continue;
+        }
         callback(buffer, sampleSpecs, ptr);
     }
 
@@ -154,7 +196,9 @@ SharedTerminateFlag terminateRequest, SharedUserPtr ptr)
 // Thread function, that handles blocking io calls on the buffers
 auto writeAudioFunction = [](SharedBufferHandle audioBuffer,
 AudioCallbackIn callback,
-SharedTerminateFlag terminateRequest, SharedUserPtr ptr) {
+SharedTerminateFlag terminateRequest, SharedUserPtr ptr, RealtimePolicy policy) {
+
+    applyRealtimePolicy(policy, "nlaudio_write");
 
     SampleSpecs sampleSpecs = audioBuffer->sampleSpecs();
 
@@ -163,9 +207,12 @@ SharedTerminateFlag terminateRequest, SharedUserPtr ptr) {
 
     memset(buffer, 0, sampleSpecs.buffersizeInBytesPerPeriode);
 
+    const auto pollInterval = bufferPollInterval(sampleSpecs);
+
     while(!terminateRequest->load()) {
         callback(buffer, sampleSpecs, ptr);
-        audioBuffer->set(buffer, buffersize);
+        while (!audioBuffer->set(buffer, buffersize) && !terminateRequest->load())
+            std::this_thread::sleep_for(pollInterval);
     }
 
     delete[] buffer;
@@ -175,7 +222,9 @@ SharedTerminateFlag terminateRequest, SharedUserPtr ptr) {
 auto readWriteAudioFunction = [](SharedBufferHandle audioInBuffer,
 SharedBufferHandle audioOutBuffer,
 AudioCallbackInOut callback,
-SharedTerminateFlag terminateRequest, SharedUserPtr ptr) {
+SharedTerminateFlag terminateRequest, SharedUserPtr ptr, RealtimePolicy policy) {
+
+    applyRealtimePolicy(policy, "nlaudio_readwrite");
 
     SampleSpecs sampleSpecsIn = audioInBuffer->sampleSpecs();
     SampleSpecs sampleSpecsOut = audioOutBuffer->sampleSpecs();
@@ -195,12 +244,133 @@ SharedTerminateFlag terminateRequest, SharedUserPtr ptr) {
         memset(outBuffer, 0, outBuffersize);
         memset(inBuffer, 0, inBuffersize);
 
+        const auto pollInterval = bufferPollInterval(sampleSpecsIn);
+
         audioOutBuffer->set(outBuffer, outBuffersize);
 
         while(!terminateRequest->load()) {
-            audioInBuffer->get(inBuffer, inBuffersize);
+            if (!audioInBuffer->get(inBuffer, inBuffersize)) {
+                std::this_thread::sleep_for(pollInterval);
+                continue;
+            }
             callback(inBuffer, outBuffer, sampleSpecsIn, ptr);
-            audioOutBuffer->set(outBuffer, inBuffersize);
+            while (!audioOutBuffer->set(outBuffer, inBuffersize) && !terminateRequest->load())
+                std::this_thread::sleep_for(pollInterval);
+        }
+
+    } catch (AudioAlsaException& e) {
+        std::cout << "### Exception from " << __func__ <<  " ###" << std::endl << "  " << e.what() << std::endl;
+    } catch (std::exception& e) {
+        std::cout << "### Exception from " << __func__ << " ###" << std::endl << "  " << e.what() << std::endl;
+    } catch(...) {
+        std::cout << "### Exception from " << __func__ << " ###" << std::endl << "  default" << std::endl;
+    }
+
+    delete[] inBuffer;
+    delete[] outBuffer;
+};
+
+// Thread function, that handles blocking io calls on the buffers and converts the periode to planar float
+auto readAudioFloatFunction = [](SharedBufferHandle audioBuffer,
+AudioCallbackFloatIn callback,
+SharedTerminateFlag terminateRequest, SharedUserPtr ptr, RealtimePolicy policy)
+{
+    applyRealtimePolicy(policy, "nlaudio_read");
+
+    SampleSpecs sampleSpecs = audioBuffer->sampleSpecs();
+
+    const int buffersize = sampleSpecs.buffersizeInBytesPerPeriode;
+    const unsigned int frames = sampleSpecs.buffersizeInFramesPerPeriode;
+    u_int8_t *buffer = new u_int8_t[buffersize];
+
+    FloatPeriode periode;
+    periode.resize(sampleSpecs.channels, frames);
+
+    const auto pollInterval = bufferPollInterval(sampleSpecs);
+
+    while(!terminateRequest->load()) {
+        if (!audioBuffer->get(buffer, buffersize)) {
+            std::this_thread::sleep_for(pollInterval);
+            continue;
+        }
+        getSamples(buffer, periode.channels(), frames, sampleSpecs);
+        callback(periode.channels(), frames, sampleSpecs, ptr);
+    }
+
+    delete[] buffer;
+};
+
+// Thread function, that handles blocking io calls on the buffers and converts the planar float periode
+auto writeAudioFloatFunction = [](SharedBufferHandle audioBuffer,
+AudioCallbackFloatOut callback,
+SharedTerminateFlag terminateRequest, SharedUserPtr ptr, RealtimePolicy policy) {
+
+    applyRealtimePolicy(policy, "nlaudio_write");
+
+    SampleSpecs sampleSpecs = audioBuffer->sampleSpecs();
+
+    const int buffersize = sampleSpecs.buffersizeInBytesPerPeriode;
+    const unsigned int frames = sampleSpecs.buffersizeInFramesPerPeriode;
+    u_int8_t *buffer = new u_int8_t[buffersize];
+
+    FloatPeriode periode;
+    periode.resize(sampleSpecs.channels, frames);
+
+    const auto pollInterval = bufferPollInterval(sampleSpecs);
+
+    while(!terminateRequest->load()) {
+        callback(periode.channels(), frames, sampleSpecs, ptr);
+        setSamples(buffer, periode.channels(), frames, sampleSpecs);
+        while (!audioBuffer->set(buffer, buffersize) && !terminateRequest->load())
+            std::this_thread::sleep_for(pollInterval);
+    }
+
+    delete[] buffer;
+};
+
+// Thread function, that handles blocking io calls on the buffers and converts both periodes from and to planar float
+auto readWriteAudioFloatFunction = [](SharedBufferHandle audioInBuffer,
+SharedBufferHandle audioOutBuffer,
+AudioCallbackFloatInOut callback,
+SharedTerminateFlag terminateRequest, SharedUserPtr ptr, RealtimePolicy policy) {
+
+    applyRealtimePolicy(policy, "nlaudio_readwrite");
+
+    SampleSpecs sampleSpecsIn = audioInBuffer->sampleSpecs();
+    SampleSpecs sampleSpecsOut = audioOutBuffer->sampleSpecs();
+
+    const int inBuffersize = sampleSpecsIn.buffersizeInBytesPerPeriode;
+    const int outBuffersize = sampleSpecsOut.buffersizeInBytesPerPeriode;
+    const unsigned int frames = sampleSpecsIn.buffersizeInFramesPerPeriode;
+
+    u_int8_t *inBuffer = new u_int8_t[inBuffersize];
+    u_int8_t *outBuffer = new u_int8_t[outBuffersize];
+
+    FloatPeriode inPeriode, outPeriode;
+    inPeriode.resize(sampleSpecsIn.channels, frames);
+    outPeriode.resize(sampleSpecsOut.channels, frames);
+
+    try {
+
+        if (frames != sampleSpecsOut.buffersizeInFramesPerPeriode)
+            std::cout << "#### Error, in and out buffer are not the same size!! " << __FILE__ << ":" << __func__ << ":" << __LINE__ << std::endl;
+
+        memset(outBuffer, 0, outBuffersize);
+
+        const auto pollInterval = bufferPollInterval(sampleSpecsIn);
+
+        audioOutBuffer->set(outBuffer, outBuffersize);
+
+        while(!terminateRequest->load()) {
+            if (!audioInBuffer->get(inBuffer, inBuffersize)) {
+                std::this_thread::sleep_for(pollInterval);
+                continue;
+            }
+            getSamples(inBuffer, inPeriode.channels(), frames, sampleSpecsIn);
+            callback(inPeriode.channels(), outPeriode.channels(), frames, sampleSpecsOut, ptr);
+            setSamples(outBuffer, outPeriode.channels(), frames, sampleSpecsOut);
+            while (!audioOutBuffer->set(outBuffer, outBuffersize) && !terminateRequest->load())
+                std::this_thread::sleep_for(pollInterval);
         }
 
     } catch (AudioAlsaException& e) {
@@ -225,8 +395,11 @@ SharedTerminateFlag terminateRequest) {
 
     u_int8_t *inBuffer = new u_int8_t[inBuffersize];
 
+    const auto pollInterval = bufferPollInterval(sampleSpecsIn);
+
     while(!terminateRequest->load()) {
-        audioInBuffer->get(inBuffer, inBuffersize);
+        if (!audioInBuffer->get(inBuffer, inBuffersize))
+            std::this_thread::sleep_for(pollInterval);
     }
 };
 
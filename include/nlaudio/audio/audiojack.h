@@ -20,14 +20,36 @@
 #pragma once
 
 #include "audio/audio.h"
+#include "audio/audiocallback.h"
 #include "common/bufferstatistics.h"
 #include "common/alsa/alsacardidentifier.h"
-#include "common/blockingcircularbuffer.h"
+#include "common/circularbuffer.h"
 
 #include <jack/jack.h>
 
+#include <atomic>
+#include <vector>
+
 namespace Nl {
 
+/** \ingroup Audio
+ *
+ * \brief JACK backend
+ *
+ * Registers one native float port per channel. Samples are passed on as interleaved
+ * 32 bit float frames, which is reflected in the SampleSpecs. Samplerate and periode
+ * size are dictated by the JACK server.
+ *
+ * The process callback is real time safe: It either runs a callback, set by
+ * setCallback(), or exchanges one periode with the buffer. A float callback gets
+ * the JACK port buffers directly, without any conversion or copy. The buffer should be
+ * a non blocking buffer, a blocking buffer is only accessed if enough data or
+ * space is available.
+ *
+ * Scheduling class and priority of the process thread are owned by the JACK server,
+ * only CPU affinity, memory locking and stack prefaulting of a RealtimePolicy are applied.
+ *
+*/
 class AudioJack : public Audio
 {
 public:
@@ -63,15 +85,44 @@ public:
 
 	virtual BufferStatistics getStats();
 
+	void setCallback(AudioCallbackOut callback, SharedUserPtr ptr);
+	void setCallback(AudioCallbackFloatOut callback, SharedUserPtr ptr);
+
+	SampleSpecs getSpecs() const;
+
 protected:
 	bool m_isInput;
 	SharedBufferHandle m_audioBuffer;
-	jack_port_t *m_jackPort;
+	std::vector<jack_port_t*> m_jackPorts;
+	std::vector<float*> m_portBuffers;
 	jack_client_t *m_jackClient;
     AlsaAudioCardIdentifier m_card;
 
+	unsigned int m_channels;
+	unsigned int m_bufferCount;
+	SampleSpecs m_specs;
+
+	u_int8_t *m_scratch;
+	unsigned int m_scratchSize;
+
+	AudioCallbackOut m_callback;
+	AudioCallbackFloatOut m_floatCallback;
+	SharedUserPtr m_userPtr;
+
+	std::atomic<unsigned int> m_xrunCounter;
+	std::atomic<unsigned int> m_bufferXrunCounter;
+
 private:
+	void registerPorts();
+	void connectPhysicalPorts();
+	void allocateScratch(unsigned int size);
+	void exchangeWithBuffer(unsigned int bytes);
+
 	static int worker(jack_nframes_t nframes, void *arg);
+	static int bufferSizeChanged(jack_nframes_t nframes, void *arg);
+	static int xrunOccured(void *arg);
+	static void threadInit(void *arg);
+	static void shutdown(void *arg);
 
 }; // namespace Nl
 
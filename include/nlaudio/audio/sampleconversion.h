@@ -0,0 +1,88 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <vector>
+
+#include "audio/samplespecs.h"
+#include "audio/audioblock.h"
+
+namespace Nl {
+
+/** \ingroup Tools
+ *
+ * \brief Block conversion between float samples and device byte streams
+ *
+ * These functions convert a whole periode at once, instead of one sample per call like
+ * setSample() / getSample(). Supported are all formats, SampleSpecs can describe:
+ *  - FLOAT (32 bit)
+ *  - S16, S24_3 (3 bytes), S24 (in 4 bytes), S32
+ *  - the unsigned variants of the integer formats
+ *  - little and big endian
+ *  - interleaved and non interleaved streams (SampleSpecs::isInterleaved)
+ *
+ * Float samples are clipped to -1.0 ... 1.0. The float to integer step runs in AVX2, SSE2 or
+ * NEON kernels, depending on the platform, with a scalar fallback.
+ *
+*/
+void setSamples(u_int8_t* out, const float* in, u_int32_t frames, const SampleSpecs& sampleSpecs);
+void setSamples(u_int8_t* out, const float* const* in, u_int32_t frames, const SampleSpecs& sampleSpecs);
+void setSamples(u_int8_t* out, const AudioBlock& in, const SampleSpecs& sampleSpecs);
+
+void getSamples(const u_int8_t* in, float* out, u_int32_t frames, const SampleSpecs& sampleSpecs);
+void getSamples(const u_int8_t* in, float* const* out, u_int32_t frames, const SampleSpecs& sampleSpecs);
+void getSamples(const u_int8_t* in, const AudioBlock& out, const SampleSpecs& sampleSpecs);
+
+/** \ingroup Tools
+ *
+ * \brief One periode of planar float samples
+ *
+ * Owns the memory, which is passed to the float callbacks. Each channel is contiguous.
+ * resize() allocates, so it has to be called outside the audio thread.
+ *
+*/
+class FloatPeriode
+{
+public:
+	FloatPeriode() : m_frames(0) {}
+
+	void resize(unsigned int channels, unsigned int frames)
+	{
+		m_frames = frames;
+		m_samples.assign(channels * frames, 0.f);
+		m_channels.resize(channels);
+		for (unsigned int i=0; i<channels; i++)
+			m_channels[i] = m_samples.data() + i * frames;
+	}
+
+	AudioBlock block() { return AudioBlock(m_channels.data(), m_channels.size(), m_frames); }
+
+	float* const* channels() { return m_channels.data(); }
+	const float* const* channels() const { return m_channels.data(); }
+	unsigned int channelCount() const { return m_channels.size(); }
+	unsigned int frames() const { return m_frames; }
+
+private:
+	std::vector<float> m_samples;
+	std::vector<float*> m_channels;
+	unsigned int m_frames;
+};
+
+} // namespace Nl
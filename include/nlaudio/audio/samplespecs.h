@@ -34,7 +34,7 @@ struct SampleSpecs {
 	unsigned int channels;					///< Channels
 	unsigned int bytesPerSample;			///< How many bytes does one sample have. 24_BE3 = 3, S16 = 2, ...
 	unsigned int bytesPerSamplePhysical;	///< Sometimes 24_BE3 can be stored in 4Bytes, then this would be 4. Usually same as bytesPerSample
-	unsigned int bytesPerFrame;				///< How many bytes does one frame have. Same as channels * bytesPerSample
+	unsigned int bytesPerFrame;				///< How many bytes does one frame have. Same as channels * bytesPerSamplePhysical
 	unsigned int buffersizeInFrames;		///< Buffersize in Frames
 	unsigned int buffersizeInFramesPerPeriode;	///< Buffersize in Frames per Periode. Same as buffersizeInFrames / periodes
 	unsigned int buffersizeInBytes;				///< Buffersize in Bytes
@@ -45,7 +45,7 @@ struct SampleSpecs {
 	bool isLittleEndian;						///< Are we working in little endian?
 	bool isSigned;								///< Are we using a sample format with signed values?
 	double latency;								///< Latency, which is buffersizeInFramesPerPeriode / samplerate
-	// bool isInterleaved
+	bool isInterleaved;							///< Are the channels interleaved? Otherwise each periode holds one block of frames per channel
 };
 std::ostream& operator<<(std::ostream& lhs, const SampleSpecs& rhs);
 
@@ -27,6 +27,7 @@
 #include <cstring>
 
 #include "audio/samplespecs.h"
+#include "common/circularbuffer.h"
 
 namespace Nl {
 
@@ -42,7 +43,7 @@ namespace Nl {
  *
 */
 template <typename T>
-class BlockingCircularBuffer
+class BlockingCircularBuffer : public CircularBuffer<T>
 {
 public:
 	/** \ingroup Audio
@@ -64,13 +65,13 @@ public:
         m_writeIndex(0)
     {}
 
-    ~BlockingCircularBuffer()
+    virtual ~BlockingCircularBuffer()
     {
         if (m_buffer)
             delete[] m_buffer;
     }
 
-    void init(int size)
+    virtual void init(int size)
     {
         std::unique_lock<std::mutex> mlock(m_mutex);
 
@@ -93,7 +94,7 @@ public:
     }
 
     // Not sure if this is proper. This class should not know something about SampleSpecs.
-	void init(const SampleSpecs &sampleSpecs)
+	virtual void init(const SampleSpecs &sampleSpecs)
     {
         init(sampleSpecs.buffersizeInBytes);
         m_sampleSpecs = sampleSpecs;
@@ -107,11 +108,13 @@ public:
 	 * \param buffer Buffer to save data to
 	 * \param size Buffersize int bytes
 	 *
+	 * \return Always true, since the callee is blocked until all data is available.
+	 *
 	 * Reads size bytes into buffer. Blocks callee if
 	 * less data available than requested.
 	 *
 	*/
-	void get(T *buffer, unsigned int size)
+	virtual bool get(T *buffer, unsigned int size)
     {
         if (!m_buffer) {
             std::cout << "Buffer (" << m_name << ") not initialized!" << std::endl;
@@ -131,6 +134,7 @@ public:
         }
 
         m_condition.notify_one();
+        return true;
     }
 
 	/** \ingroup Audio
@@ -139,12 +143,14 @@ public:
 	 * \param buffer Buffer to read data from
 	 * \param size Buffersize int bytes
 	 *
+	 * \return Always true, since the callee is blocked until enough space is available.
+	 *
 	 * Writes size bytes into buffer. Blocks callee if
 	 * less space available than requested. Wakes waiting
 	 * readers.
 	 *
 	*/
-	void set(T *buffer, unsigned int size)
+	virtual bool set(T *buffer, unsigned int size)
     {
         if (!m_buffer) {
             std::cout << "Buffer (" << m_name << ") not initialized!" << std::endl;
@@ -166,6 +172,7 @@ public:
         }
 
         m_condition.notify_one();
+        return true;
     }
 
 	/** \ingroup Audio
@@ -177,7 +184,7 @@ public:
 	 * Returns how many write and how man read cycles have been performed
 	 * on the buffer.
 	*/
-    void getStat(unsigned long *readBytes, unsigned long *writtenBytes) const
+    virtual void getStat(unsigned long *readBytes, unsigned long *writtenBytes) const
     {
         *readBytes = m_bytesRead;
         *writtenBytes = m_bytesWritten;
@@ -191,7 +198,7 @@ public:
 	 * Returns how many elements can be read from the buffer,
 	 * before the callee is blocked.
 	*/
-    inline unsigned int availableToRead() const
+    virtual unsigned int availableToRead() const
     {
         return m_size - availableToWrite();
     }
@@ -204,7 +211,7 @@ public:
 	 * Returns how many elements can be written to the buffer,
 	 * before the callee is blocked.
 	*/
-    inline unsigned int availableToWrite() const
+    virtual unsigned int availableToWrite() const
     {
         //TODO: This is not really bullet proove, check again!!!
 		int tmp = m_readIndex - m_writeIndex - 1;
@@ -220,7 +227,7 @@ public:
 	 *
 	 * Returns the total size in elements of the buffer.
 	*/
-    inline int size() const
+    virtual int size() const
     {
         return m_size;
     }
@@ -232,7 +239,7 @@ public:
 	 *
 	 * Returns the name of the buffer.
 	*/
-    inline std::string name() const
+    virtual std::string name() const
     {
         return m_name;
     }
@@ -244,11 +251,22 @@ public:
 	 *
 	 * Returns the SampleSpecs_t which has been used to initialize this buffer.
 	*/
-	inline SampleSpecs sampleSpecs()
+	virtual SampleSpecs sampleSpecs()
     {
         return m_sampleSpecs;
     }
 
+	/** \ingroup Audio
+	 *
+	 * \brief Returns true, since get() and set() block the callee.
+	 * \return True
+	 *
+	*/
+	virtual bool isBlocking() const
+	{
+		return true;
+	}
+
 private:
     T *m_buffer;
     std::atomic<int> m_size;
@@ -266,7 +284,4 @@ private:
 	SampleSpecs m_sampleSpecs;
 };
 
-/*! A shared handle to a \ref BlockingCircularBuffer<uint8_t> */
-typedef std::shared_ptr<BlockingCircularBuffer<uint8_t>> SharedBufferHandle;
-
 } // namespace Nl
@@ -34,6 +34,7 @@ struct BufferStatistics {
 	unsigned long bytesReadFromBuffer; ///< Number of bytes that have been read from the buffer
 	unsigned long bytesWrittenToBuffer; ///< Number of bytes that have been written to the buffer
 	unsigned int xrunCount; ///< Number of over-/underflows
+	unsigned int bufferXrunCount; ///< Number of periodes, a non blocking buffer could not deliver or accept
 };
 
 std::ostream& operator<<(std::ostream& lhs, const BufferStatistics& rhs);
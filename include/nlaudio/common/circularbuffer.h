@@ -0,0 +1,76 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <stdint.h>
+
+#include "audio/samplespecs.h"
+
+namespace Nl {
+
+/** \ingroup Audio
+ *
+ * \brief Pure virtual base class for all circular buffers
+ * \tparam T Type of buffer elements
+ *
+ * This defines the interface for all buffers, that are used to pass data
+ * between the device threads and the callback threads, such as:
+ *  - Nl::BlockingCircularBuffer
+ *  - Nl::NonBlockingCircularBuffer
+ *
+ * get() and set() return true, if the whole request has been transferred.
+ * A blocking buffer waits until this is possible and therefore always returns true,
+ * a non blocking buffer returns false immediately and transfers nothing.
+ *
+*/
+template <typename T>
+class CircularBuffer
+{
+public:
+	virtual ~CircularBuffer() {}
+
+	virtual void init(int size) = 0;
+	virtual void init(const SampleSpecs &sampleSpecs) = 0;
+
+	virtual bool get(T *buffer, unsigned int size) = 0;
+	virtual bool set(T *buffer, unsigned int size) = 0;
+
+	virtual void getStat(unsigned long *readBytes, unsigned long *writtenBytes) const = 0;
+
+	virtual unsigned int availableToRead() const = 0;
+	virtual unsigned int availableToWrite() const = 0;
+
+	virtual int size() const = 0;
+	virtual std::string name() const = 0;
+	virtual SampleSpecs sampleSpecs() = 0;
+
+	/** \ingroup Audio
+	 *
+	 * \brief Returns true, if get() and set() block the callee
+	 * \return True for blocking buffers, false otherwise
+	 *
+	*/
+	virtual bool isBlocking() const = 0;
+};
+
+/*! A shared handle to a \ref CircularBuffer<uint8_t> */
+typedef std::shared_ptr<CircularBuffer<uint8_t>> SharedBufferHandle;
+
+} // namespace Nl
@@ -19,57 +19,96 @@
 
 #pragma once
 
-#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
 
-#include <iostream>
-#include "lockfreecircularbuffer.h"
-#include "samplespecs.h"
+#include "audio/samplespecs.h"
+#include "common/circularbuffer.h"
 
 namespace Nl {
 
 /** \ingroup Audio
  *
- * \brief A blocking circular buffer implementation
+ * \brief A wait-free single producer / single consumer circular buffer
  * \tparam Type of buffer elements
- * \param size Buffersize in elements of type T
  *
- * A circular buffer implementation which blocks the callee of get()
- * if nothing to read and the callee of set() when no space
- * to write
+ * A circular buffer implementation which never blocks. get() and set()
+ * either transfer the whole request or nothing and return false. There must
+ * be exactly one thread calling set() and exactly one thread calling get().
+ *
+ * The capacity is rounded up to the next power of two, so indices can be
+ * wrapped with a mask. Read and write index run freely and live on separate
+ * cache lines, data is copied in at most two memcpy() segments.
+ *
+ * init() is not thread safe and has to be called before producer and
+ * consumer are started.
  *
 */
 template <typename T>
-class BlockingCircularBuffer
+class NonBlockingCircularBuffer : public CircularBuffer<T>
 {
+	static_assert(std::is_trivially_copyable<T>::value, "NonBlockingCircularBuffer requires a trivially copyable type");
+
 public:
 	/** \ingroup Audio
 	 *
 	 * \brief Constructor
 	 * \tparam T element type
-	 * \param size Buffersize in elements
+	 * \param name Name of the buffer
 	 *
-	 * Sets up a new buffer.
+	 * Sets up a new buffer. The buffer has to be initialized using init()
+	 * before it can be used.
 	 *
 	*/
-	BlockingCircularBuffer(const std::string& name) :
+	NonBlockingCircularBuffer(const std::string& name) :
+		m_buffer(nullptr),
 		m_size(0),
+		m_mask(0),
 		m_name(name),
+		m_readIndex(0),
 		m_bytesRead(0),
+		m_writeIndex(0),
 		m_bytesWritten(0)
 	{}
 
-	~BlockingCircularBuffer()
+	virtual ~NonBlockingCircularBuffer()
 	{
-
+		if (m_buffer)
+			delete[] m_buffer;
 	}
 
-	void init(int size)
+	/** \ingroup Audio
+	 *
+	 * \brief Allocates the buffer
+	 * \param size Requested size in elements, rounded up to the next power of two
+	 *
+	*/
+	virtual void init(int size)
 	{
+		if (m_buffer)
+			delete [] m_buffer;
+
+		size_t capacity = 1;
+		while (capacity < static_cast<size_t>(size))
+			capacity <<= 1;
 
+		m_size = capacity;
+		m_mask = capacity - 1;
+
+		m_buffer = new T[m_size];
+		std::memset(m_buffer, 0, m_size * sizeof(T));
+
+		m_readIndex.store(0, std::memory_order_relaxed);
+		m_writeIndex.store(0, std::memory_order_relaxed);
+		m_bytesRead.store(0, std::memory_order_relaxed);
+		m_bytesWritten.store(0, std::memory_order_release);
 	}
 
 	// Not sure if this is proper. This class should not know something about SampleSpecs.
-	void init(const SampleSpecs &sampleSpecs)
+	virtual void init(const SampleSpecs &sampleSpecs)
 	{
 		init(sampleSpecs.buffersizeInBytes);
 		m_sampleSpecs = sampleSpecs;
@@ -79,31 +118,68 @@ public:
 	 *
 	 * \brief Read data from the buffer
 	 * \param buffer Buffer to save data to
-	 * \param size Buffersize int bytes
+	 * \param size Buffersize in elements
+	 * \return True on success, false if less than size elements are available
 	 *
-	 * Reads size bytes into buffer. Blocks callee if
-	 * less data available than requested.
+	 * Reads size elements into buffer. Never blocks. Must only be called
+	 * from the consumer thread.
 	 *
 	*/
-	void get(T *buffer, unsigned int size)
+	virtual bool get(T *buffer, unsigned int size)
 	{
+		if (!m_buffer)
+			return false;
+
+		const size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+		const size_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+
+		if (writeIndex - readIndex < size)
+			return false;
 
+		const size_t offset = readIndex & m_mask;
+		const size_t first = std::min<size_t>(size, m_size - offset);
+
+		std::memcpy(buffer, m_buffer + offset, first * sizeof(T));
+		std::memcpy(buffer + first, m_buffer, (size - first) * sizeof(T));
+
+		m_bytesRead.fetch_add(size, std::memory_order_relaxed);
+		m_readIndex.store(readIndex + size, std::memory_order_release);
+
+		return true;
 	}
 
 	/** \ingroup Audio
 	 *
 	 * \brief Write data to the buffer
 	 * \param buffer Buffer to read data from
-	 * \param size Buffersize int bytes
+	 * \param size Buffersize in elements
+	 * \return True on success, false if less than size elements are free
 	 *
-	 * Writes size bytes into buffer. Blocks callee if
-	 * less space available than requested. Wakes waiting
-	 * readers.
+	 * Writes size elements into the buffer. Never blocks. Must only be
+	 * called from the producer thread.
 	 *
 	*/
-	void set(T *buffer, unsigned int size)
+	virtual bool set(T *buffer, unsigned int size)
 	{
+		if (!m_buffer)
+			return false;
+
+		const size_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+		const size_t readIndex = m_readIndex.load(std::memory_order_acquire);
 
+		if (m_size - (writeIndex - readIndex) < size)
+			return false;
+
+		const size_t offset = writeIndex & m_mask;
+		const size_t first = std::min<size_t>(size, m_size - offset);
+
+		std::memcpy(m_buffer + offset, buffer, first * sizeof(T));
+		std::memcpy(m_buffer, buffer + first, (size - first) * sizeof(T));
+
+		m_bytesWritten.fetch_add(size, std::memory_order_relaxed);
+		m_writeIndex.store(writeIndex + size, std::memory_order_release);
+
+		return true;
 	}
 
 	/** \ingroup Audio
@@ -115,10 +191,10 @@ public:
 	 * Returns how many write and how man read cycles have been performed
 	 * on the buffer.
 	*/
-	void getStat(unsigned long *readBytes, unsigned long *writtenBytes) const
+	virtual void getStat(unsigned long *readBytes, unsigned long *writtenBytes) const
 	{
-		*readBytes = m_bytesRead;
-		*writtenBytes = m_bytesWritten;
+		*readBytes = m_bytesRead.load(std::memory_order_relaxed);
+		*writtenBytes = m_bytesWritten.load(std::memory_order_relaxed);
 	}
 
 	/** \ingroup Audio
@@ -126,12 +202,11 @@ public:
 	 * \brief Returns number of available elements to read.
 	 * \return A number of available elements to read.
 	 *
-	 * Returns how many elements can be read from the buffer,
-	 * before the callee is blocked.
+	 * Exact when called from the consumer thread, a lower bound otherwise.
 	*/
-	inline unsigned int availableToRead() const
+	virtual unsigned int availableToRead() const
 	{
-
+		return m_writeIndex.load(std::memory_order_acquire) - m_readIndex.load(std::memory_order_acquire);
 	}
 
 	/** \ingroup Audio
@@ -139,22 +214,21 @@ public:
 	 * \brief Returns number of available elements to write.
 	 * \return A number of available elements to write.
 	 *
-	 * Returns how many elements can be written to the buffer,
-	 * before the callee is blocked.
+	 * Exact when called from the producer thread, a lower bound otherwise.
 	*/
-	inline unsigned int availableToWrite() const
+	virtual unsigned int availableToWrite() const
 	{
-
+		return m_size - availableToRead();
 	}
 
 	/** \ingroup Audio
 	 *
 	 * \brief Returns the size of the buffer in elements.
-	 * \return The size of the buffer in elements.
+	 * \return The size of the buffer in elements, which is a power of two.
 	 *
 	 * Returns the total size in elements of the buffer.
 	*/
-	inline int size() const
+	virtual int size() const
 	{
 		return m_size;
 	}
@@ -166,7 +240,7 @@ public:
 	 *
 	 * Returns the name of the buffer.
 	*/
-	inline std::string name() const
+	virtual std::string name() const
 	{
 		return m_name;
 	}
@@ -178,25 +252,40 @@ public:
 	 *
 	 * Returns the SampleSpecs_t which has been used to initialize this buffer.
 	*/
-	inline SampleSpecs sampleSpecs()
+	virtual SampleSpecs sampleSpecs()
 	{
 		return m_sampleSpecs;
 	}
 
+	/** \ingroup Audio
+	 *
+	 * \brief Returns false, since get() and set() never block.
+	 * \return False
+	 *
+	*/
+	virtual bool isBlocking() const
+	{
+		return false;
+	}
+
 private:
+	static const size_t CacheLineSize = 64;
+
+	T *m_buffer;
+	size_t m_size;
+	size_t m_mask;
 	std::string m_name;
-	int m_size;
+	SampleSpecs m_sampleSpecs;
 
+	// Consumer side
+	alignas(CacheLineSize) std::atomic<size_t> m_readIndex;
 	std::atomic<unsigned long> m_bytesRead;
-	std::atomic<unsigned long> m_bytesWritten;
-
-	SampleSpecs m_sampleSpecs;
-	CircularFifo<u_int8_t, 512> m_buffer;
 
+	// Producer side
+	alignas(CacheLineSize) std::atomic<size_t> m_writeIndex;
+	std::atomic<unsigned long> m_bytesWritten;
 
+	char m_padding[CacheLineSize - sizeof(std::atomic<size_t>) - sizeof(std::atomic<unsigned long>)];
 };
 
-/*! A shared handle to a \ref BlockingCircularBuffer<uint8_t> */
-typedef std::shared_ptr<BlockingCircularBuffer<uint8_t>> SharedBufferHandle;
-
 } // namespace Nl
@@ -0,0 +1,72 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#pragma once
+
+#include <sched.h>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Nl {
+
+const size_t DEFAULT_PREFAULT_STACK_SIZE = 128 * 1024; /*!< Stack in bytes, touched by a realtime thread before it starts working */
+
+/** \ingroup Tools
+ *
+ * \brief Describes, how a worker thread should be configured
+ *
+ * Passed to the factory functions and devices, which create worker threads. Each thread
+ * applies the policy to itself, using applyRealtimePolicy(), before it enters its loop.
+ * A default constructed policy changes nothing.
+ *
+ * \code{.cpp}
+ * // SCHED_FIFO with priority 80, pinned to core 1, memory locked and stack prefaulted
+ * Nl::RealtimePolicy policy(SCHED_FIFO, 80, {1});
+ * auto output = Nl::createAlsaOutputDevice(card, buffer, 128, policy);
+ * \endcode
+ *
+*/
+struct RealtimePolicy {
+	RealtimePolicy() :
+		schedulingClass(SCHED_OTHER),
+		priority(0),
+		lockMemory(false),
+		prefaultStackSize(0) {}
+
+	RealtimePolicy(int schedulingClass, int priority, const std::vector<int> &cpus = std::vector<int>(),
+				   bool lockMemory = true, size_t prefaultStackSize = DEFAULT_PREFAULT_STACK_SIZE) :
+		schedulingClass(schedulingClass),
+		priority(priority),
+		cpus(cpus),
+		lockMemory(lockMemory),
+		prefaultStackSize(prefaultStackSize) {}
+
+	bool isDefault() const { return schedulingClass == SCHED_OTHER && cpus.empty() && !lockMemory && prefaultStackSize == 0; }
+
+	int schedulingClass;		///< SCHED_OTHER (unchanged), SCHED_FIFO or SCHED_RR
+	int priority;				///< Priority for SCHED_FIFO / SCHED_RR, clamped to the valid range
+	std::vector<int> cpus;		///< Cores, the thread may run on. Empty means all cores
+	bool lockMemory;			///< Lock all current and future pages of the process, done once per process
+	size_t prefaultStackSize;	///< Bytes of stack, which are touched once, so they do not fault later
+};
+std::ostream& operator<<(std::ostream& lhs, const RealtimePolicy& rhs);
+
+bool applyRealtimePolicy(const RealtimePolicy &policy, const std::string &threadName);
+
+} // namespace Nl
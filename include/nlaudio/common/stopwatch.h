@@ -19,56 +19,106 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
-#include <ctime>
-#include <queue>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <iostream>
-#include <iomanip>
-#include <mutex>
-#include <thread>
+#include <stdint.h>
 
 namespace Nl {
 
 class StopWatch;
 
 /** \ingroup Tools
- * \struct Timestamp - Stores time stamps for execution time measurements.
+ *
+ * \class LatencyHistogram
+ * \brief Fixed size log-linear histogram of durations in nanoseconds
+ *
+ * Each power of two is split into 8 linear buckets, so a value is off by at most 12.5%.
+ * Durations up to about 17 seconds are covered, longer ones end up in the last bucket.
+ * record() only uses relaxed atomics and never allocates or locks, drainTo() moves
+ * all counts into a plain Snapshot, which is used for reporting.
  *
 */
-struct Timestamp {
-    std::chrono::time_point<std::chrono::high_resolution_clock> start; ///< Start Time of the time stamp
-    std::chrono::time_point<std::chrono::high_resolution_clock> stop; ///< Stop Time of the time stamp
-    std::string name;
+class LatencyHistogram
+{
+public:
+    static const unsigned int SUB_BUCKET_BITS = 3;
+    static const unsigned int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const unsigned int BUCKETS = 256;
+
+    /** Plain copy of a histogram, as seen by the reader */
+    struct Snapshot {
+        Snapshot();
+        void add(const Snapshot& other);
+        uint64_t percentile(double p) const;
+        double mean() const { return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0; }
+
+        std::array<uint64_t, BUCKETS> buckets;
+        uint64_t count;
+        uint64_t sum;
+        uint64_t min;
+        uint64_t max;
+        uint64_t deadlineMisses;
+    };
+
+    LatencyHistogram();
+
+    void record(uint64_t ns, bool deadlineMissed);
+    void drainTo(Snapshot &snapshot);
+
+    static unsigned int bucketIndex(uint64_t ns);
+    static uint64_t bucketLowerBound(unsigned int index);
+    static uint64_t bucketUpperBound(unsigned int index);
+
+private:
+    std::array<std::atomic<uint32_t>, BUCKETS> m_buckets;
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_sum;
+    std::atomic<uint64_t> m_min;
+    std::atomic<uint64_t> m_max;
+    std::atomic<uint64_t> m_deadlineMisses;
 };
 
 /** \ingroup Tools
  *
- * \class StopFunctionTime
+ * \class StopBlockTime
  * \brief Helper class, that measures time duration for the time the object exists.
  *
- * This class calls StopWatch::start("") in constructor ans StopWatch::stop() in destructor.
+ * This class calls StopWatch::start() in constructor and StopWatch::stop() in destructor.
  * Hence it can be used like this, to measure the total executiontime of a function:
  *
  * \code{.cpp}
- * StopWatch sw();
+ * StopWatch sw("Callbacks");
+ * const StopWatch::ScopeId scope = sw.scope("anyFunction"); // Not on the audio thread
  *
  * void anyFunction()
  * {
- *    StopFunctionTime sft(&sw, "Valuename"); // Start measuring time from here.
+ *    StopBlockTime sbt(sw, scope); // Start measuring time from here.
  *
  *    // Some very expensive code here
  * }
  * \endcode
  *
+ * Note, that the object needs a name. StopBlockTime(sw, scope); is a temporary,
+ * which is destroyed right away.
+ *
 */
 class StopBlockTime
 {
 public:
-    StopBlockTime(std::shared_ptr<StopWatch> sw, std::string name);
+    StopBlockTime(StopWatch &sw, uint16_t scope);
+    StopBlockTime(const std::shared_ptr<StopWatch> &sw, uint16_t scope);
     ~StopBlockTime();
+
+    StopBlockTime(const StopBlockTime&) = delete;
+    StopBlockTime& operator=(const StopBlockTime&) = delete;
+
 private:
-    std::shared_ptr<StopWatch> m_currentStopWatch;
+    StopWatch *m_currentStopWatch;
 };
 
 /** \ingroup Tools
@@ -76,13 +126,23 @@ private:
  * \class StopWatch
  * \brief Helper class, that measures time durations.
  *
- * This class can be used to log execution time.
+ * This class can be used to log execution time on real time threads. Measurements
+ * are taken with a monotonic clock and go into one LatencyHistogram per scope. The
+ * recording side does not lock and does not allocate, so the audio thread never
+ * waits for a printing thread.
+ *
+ * Scopes are interned by name using scope(), which locks and might allocate. Do that
+ * once, outside the audio thread, and pass the returned ScopeId to start().
+ * Printing drains all histograms and reports min/mean/p50/p99/p99.9/max and the
+ * number of durations above the deadline.
  *
  * \code{.cpp}
- * StopWatch sw();
+ * StopWatch sw("Callbacks", StopWatch::SUMMARY, std::chrono::microseconds(2667));
+ * const StopWatch::ScopeId scope = sw.scope("TimePointName");
+ *
  * void anyFunction()
  * {
- *	  sw.start("TimePointName");
+ *    sw.start(scope);
  *    // Some very expensive code here
  *    sw.stop();
  * }
@@ -93,27 +153,42 @@ class StopWatch
 {
 public:
     enum Mode {
-        SUMMARY,
-        DETAILED
+        SUMMARY,    ///< One line per scope
+        DETAILED    ///< Summary plus all non empty histogram buckets
     };
 
-    StopWatch(const std::string& name, uint32_t windowSize, Mode m);
-    void start(const std::string& name);
+    typedef uint16_t ScopeId;
+
+    static const unsigned int MAX_SCOPES = 64;    ///< Maximum number of scopes per StopWatch
+    static const unsigned int MAX_NESTING = 16;    ///< Maximum depth of nested start() calls per thread
+
+    StopWatch(const std::string& name, Mode m = SUMMARY, std::chrono::nanoseconds deadline = std::chrono::nanoseconds(0));
+
+    ScopeId scope(const std::string& name);
+
+    void start(ScopeId scope);
     void stop();
 
+    void setDeadline(std::chrono::nanoseconds deadline);
+
     std::ostream& print(std::ostream& rhs);
 
 private:
-    std::mutex m_mutex;
-    std::queue<Timestamp> m_timestamps;
-    Timestamp m_currentTimeStamp;
-    bool m_waitingForStop;
+    struct Scope {
+        std::string name;
+        LatencyHistogram histogram;
+    };
+
+    std::mutex m_scopeMutex;
+    std::array<Scope, MAX_SCOPES> m_scopes;
+    std::atomic<unsigned int> m_scopeCount;
+    std::atomic<uint64_t> m_deadlineNs;
+    std::atomic<uint64_t> m_unbalancedCount;
     std::string m_name;
-    uint32_t m_windowSize;
     Mode m_mode;
 
-    std::ostream& printDetailed(std::ostream& rhs);
-    std::ostream& printSummary(std::ostream& rhs);
+    std::ostream& printDetailed(std::ostream& rhs, const std::string& name, const LatencyHistogram::Snapshot& snapshot);
+    std::ostream& printSummary(std::ostream& rhs, const std::string& name, const LatencyHistogram::Snapshot& snapshot);
 };
 
 std::ostream& operator<<(std::ostream& lhs, StopWatch& rhs);
@@ -28,7 +28,8 @@
 
 #include "midi/midi.h"
 #include "common/alsa/alsacardidentifier.h"
-#include "common/blockingcircularbuffer.h"
+#include "common/circularbuffer.h"
+#include "common/realtimepolicy.h"
 
 namespace Nl {
 
@@ -69,7 +70,7 @@ std::ostream& operator<<(std::ostream& lhs, const MidiCard& rhs);
 class RawMidiDevice : public Midi
 {
 public:
-    RawMidiDevice(const AlsaMidiCardIdentifier &card, std::shared_ptr<BlockingCircularBuffer<uint8_t>> buffer);
+    RawMidiDevice(const AlsaMidiCardIdentifier &card, SharedBufferHandle buffer);
 	~RawMidiDevice();
 
 	static std::list<MidiCard> getAvailableDevices();
@@ -81,6 +82,9 @@ public:
 	virtual void start();
 	virtual void stop();
 
+	void start(const RealtimePolicy &policy);
+	void setRealtimePolicy(const RealtimePolicy &policy) { m_realtimePolicy = policy; }
+
 	void setAlsaMidiBufferSize(unsigned int size);
 	unsigned int getAlsaMidiBufferSize();
 
@@ -93,7 +97,8 @@ private:
     AlsaMidiCardIdentifier m_card;
 	int m_buffersize;
 	std::thread *m_thread;
-	std::shared_ptr<BlockingCircularBuffer<uint8_t>> m_buffer;
+	SharedBufferHandle m_buffer;
+	RealtimePolicy m_realtimePolicy;
 
 	void throwOnAlsaError(int e, const std::string& function) const;
 
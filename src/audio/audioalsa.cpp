@@ -38,7 +38,9 @@ AudioAlsa::AudioAlsa(const AlsaAudioCardIdentifier& card, SharedBufferHandle buf
 	m_handle(nullptr),
 	m_hwParams(nullptr),
 	m_xrunRecoveryCounter(0),
+	m_bufferXrunCounter(0),
 	m_audioBuffer(buffer),
+	m_accessMode(SND_PCM_ACCESS_RW_INTERLEAVED),
     m_card(card),
 	m_deviceOpen(false),
 	m_isInput(isInput)
@@ -145,11 +147,99 @@ void AudioAlsa::openCommon()
 	THROW_ON_ALSA_ERROR(snd_pcm_open(&m_handle, m_card.getCardString().c_str(), m_isInput ? SND_PCM_STREAM_CAPTURE : SND_PCM_STREAM_PLAYBACK, SND_PCM_ASYNC));
 	THROW_ON_ALSA_ERROR(snd_pcm_hw_params_malloc(&m_hwParams));
 	THROW_ON_ALSA_ERROR(snd_pcm_hw_params_any(m_handle, m_hwParams));
-	THROW_ON_ALSA_ERROR(snd_pcm_hw_params_set_access(m_handle, m_hwParams, SND_PCM_ACCESS_RW_INTERLEAVED));
+	THROW_ON_ALSA_ERROR(snd_pcm_hw_params_set_access(m_handle, m_hwParams, m_accessMode));
 
 	m_deviceOpen = true;
 }
 
+/** \ingroup Audio
+ *
+ * \brief Sets the access mode of the device
+ * \param access SND_PCM_ACCESS_RW_INTERLEAVED (default), SND_PCM_ACCESS_MMAP_INTERLEAVED,
+ *        SND_PCM_ACCESS_RW_NONINTERLEAVED or SND_PCM_ACCESS_MMAP_NONINTERLEAVED
+ * \throw AudioAlsaException is thrown on error, or if the access mode is not supported.
+ *
+ * In interleaved mmap mode, AudioAlsaOutput renders each periode straight into the hardware buffer,
+ * instead of copying it through a scratch buffer and snd_pcm_writei().
+ * In non interleaved modes, each periode passed to the buffer or the callbacks holds one block
+ * of frames per channel (See SampleSpecs::isInterleaved).
+ * Has to be called before start().
+ *
+ */
+void AudioAlsa::setAccessMode(snd_pcm_access_t access)
+{
+	if (access != SND_PCM_ACCESS_RW_INTERLEAVED && access != SND_PCM_ACCESS_MMAP_INTERLEAVED &&
+		access != SND_PCM_ACCESS_RW_NONINTERLEAVED && access != SND_PCM_ACCESS_MMAP_NONINTERLEAVED)
+		throw(AudioAlsaException(__func__, __FILE__, __LINE__, -EINVAL, "Access mode not supported."));
+
+	if (m_deviceOpen)
+		THROW_ON_ALSA_ERROR(snd_pcm_hw_params_set_access(m_handle, m_hwParams, access));
+
+	m_accessMode = access;
+}
+
+/** \ingroup Audio
+ *
+ * \brief Returns the access mode of the device
+ * \return The access mode, see AudioAlsa::setAccessMode()
+ *
+ */
+snd_pcm_access_t AudioAlsa::getAccessMode() const
+{
+	return m_accessMode;
+}
+
+/** \ingroup Audio
+ *
+ * \brief Returns pointers to the channel blocks of a non interleaved periode
+ * \param buffer One periode, as passed to the buffer or the callbacks
+ * \param specs Sample specification of the current setup
+ * \return One pointer per channel, as needed by snd_pcm_readn() and snd_pcm_writen()
+ *
+ * Allocates, so it has to be called before the worker loop.
+ *
+ */
+std::vector<void*> AudioAlsa::getChannelPointers(u_int8_t *buffer, const SampleSpecs &specs)
+{
+	std::vector<void*> ret(specs.channels);
+	const unsigned int bytesPerChannel = specs.buffersizeInFramesPerPeriode * (specs.bytesPerFrame / specs.channels);
+
+	for (unsigned int channel=0; channel<specs.channels; channel++)
+		ret[channel] = buffer + channel * bytesPerChannel;
+
+	return ret;
+}
+
+// Reads one periode, using the read function, that matches the access mode
+snd_pcm_sframes_t AudioAlsa::readPeriode(snd_pcm_t *handle, u_int8_t *buffer, std::vector<void*> &channels, snd_pcm_uframes_t frames)
+{
+	switch (m_accessMode) {
+	case SND_PCM_ACCESS_MMAP_INTERLEAVED:
+		return snd_pcm_mmap_readi(handle, buffer, frames);
+	case SND_PCM_ACCESS_RW_NONINTERLEAVED:
+		return snd_pcm_readn(handle, channels.data(), frames);
+	case SND_PCM_ACCESS_MMAP_NONINTERLEAVED:
+		return snd_pcm_mmap_readn(handle, channels.data(), frames);
+	default:
+		return snd_pcm_readi(handle, buffer, frames);
+	}
+}
+
+// Writes one periode, using the write function, that matches the access mode
+snd_pcm_sframes_t AudioAlsa::writePeriode(snd_pcm_t *handle, u_int8_t *buffer, std::vector<void*> &channels, snd_pcm_uframes_t frames)
+{
+	switch (m_accessMode) {
+	case SND_PCM_ACCESS_MMAP_INTERLEAVED:
+		return snd_pcm_mmap_writei(handle, buffer, frames);
+	case SND_PCM_ACCESS_RW_NONINTERLEAVED:
+		return snd_pcm_writen(handle, channels.data(), frames);
+	case SND_PCM_ACCESS_MMAP_NONINTERLEAVED:
+		return snd_pcm_mmap_writen(handle, channels.data(), frames);
+	default:
+		return snd_pcm_writei(handle, buffer, frames);
+	}
+}
+
 /** \ingroup Audio
  *
  * \brief Closes the device
@@ -284,6 +374,7 @@ SampleSpecs AudioAlsa::getSpecs()
 	specs.isSigned = snd_pcm_format_signed(sampleFormat) == 1;
 	specs.isLittleEndian = snd_pcm_format_little_endian(sampleFormat) == 1;
 	specs.isFloat = snd_pcm_format_float(sampleFormat);
+	specs.isInterleaved = isInterleaved();
 
 	specs.channels = getChannelCount();
 
@@ -297,11 +388,14 @@ SampleSpecs AudioAlsa::getSpecs()
 
 	specs.bytesPerSample = snd_pcm_hw_params_get_sbits(m_hwParams) / 8;
 	specs.bytesPerSamplePhysical = snd_pcm_format_physical_width(sampleFormat) / 8;
-	specs.bytesPerFrame = specs.bytesPerSample * specs.channels;
+	// S24_LE and friends are stored in 4 bytes, the stream layout follows the physical width
+	if (specs.bytesPerSamplePhysical < specs.bytesPerSample)
+		specs.bytesPerSamplePhysical = specs.bytesPerSample;
+	specs.bytesPerFrame = specs.bytesPerSamplePhysical * specs.channels;
 
 	//std::cout << snd_pcm_hw_params_get_sbits(m_hwParams)  << " " << specs.bytesPerSample << "   " << specs.channels << "   " << specs.buffersizeInFrames << std::endl;
 
-	specs.buffersizeInBytes = specs.bytesPerSample * specs.channels * specs.buffersizeInFrames;
+	specs.buffersizeInBytes = specs.bytesPerFrame * specs.buffersizeInFrames;
 	specs.buffersizeInBytesPerPeriode = specs.buffersizeInBytes / getBufferCount();
 
 	specs.latency = static_cast<double>(specs.buffersizeInFramesPerPeriode) /
@@ -322,9 +416,11 @@ SampleSpecs AudioAlsa::getSpecs()
  */
 BufferStatistics AudioAlsa::getStats()
 {
-	BufferStatistics ret;
-	m_audioBuffer->getStat(&ret.bytesReadFromBuffer, &ret.bytesWrittenToBuffer);
+	BufferStatistics ret = {};
+	if (m_audioBuffer)
+		m_audioBuffer->getStat(&ret.bytesReadFromBuffer, &ret.bytesWrittenToBuffer);
 	ret.xrunCount = m_xrunRecoveryCounter;
+	ret.bufferXrunCount = m_bufferXrunCounter;
 
 	return ret;
 }
@@ -341,6 +437,9 @@ BufferStatistics AudioAlsa::getStats()
  */
 int AudioAlsa::xrunRecovery(AudioAlsa *ptr, int err)
 {
+	if (err == -EPIPE || err == -ESTRPIPE)
+		ptr->m_xrunRecoveryCounter++;
+
 	if (err == -EPIPE) {    /* under-run */
 		err = snd_pcm_prepare(ptr->m_handle);
 		if (err < 0)
@@ -0,0 +1,290 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#include <iostream>
+#include <cstring>
+
+#include "audio/audioalsaduplex.h"
+#include "audio/audioalsaexception.h"
+
+namespace Nl {
+
+/** \ingroup Audio
+ *
+ * \brief Constructor
+ * \param card The card, on which capture and playback are opened
+ *
+ * No buffer is needed, input and output are passed to the callback directly.
+ * The worker thread runs with SCHED_FIFO at maximum priority, unless another
+ * RealtimePolicy is set.
+ *
+*/
+AudioAlsaDuplex::AudioAlsaDuplex(const AlsaAudioCardIdentifier &card) :
+	basetype(card, nullptr, false),
+	m_captureHandle(nullptr),
+	m_captureHwParams(nullptr),
+	m_callback(nullptr),
+	m_floatCallback(nullptr),
+	m_userPtr(nullptr)
+{
+	m_realtimePolicy = RealtimePolicy(SCHED_FIFO, sched_get_priority_max(SCHED_FIFO), std::vector<int>(), false, 0);
+}
+
+AudioAlsaDuplex::~AudioAlsaDuplex()
+{
+	// The base class destructor only closes the playback stream
+	if (m_captureHandle) {
+		snd_pcm_close(m_captureHandle);
+		snd_pcm_hw_params_free(m_captureHwParams);
+		m_captureHandle = nullptr;
+		m_captureHwParams = nullptr;
+	}
+}
+
+void AudioAlsaDuplex::open()
+{
+	basetype::openCommon();
+
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_open(&m_captureHandle, getCard().getCardString().c_str(), SND_PCM_STREAM_CAPTURE, 0));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_malloc(&m_captureHwParams));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_any(m_captureHandle, m_captureHwParams));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_set_access(m_captureHandle, m_captureHwParams, getAccessMode()));
+}
+
+void AudioAlsaDuplex::close()
+{
+	if (m_captureHandle) {
+		throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_close(m_captureHandle));
+		snd_pcm_hw_params_free(m_captureHwParams);
+		m_captureHandle = nullptr;
+		m_captureHwParams = nullptr;
+	}
+
+	basetype::close();
+}
+
+void AudioAlsaDuplex::start()
+{
+	throwOnDeviceClosed(__FILE__, __func__, __LINE__);
+	resetTerminateRequest();
+
+	init();
+
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_link(m_captureHandle, m_handle));
+
+	SampleSpecs specs = basetype::getSpecs();
+	std::cout << "NlAudioAlsaDuplex Specs: " << std::endl << specs;
+
+	if (m_floatCallback) {
+		m_floatIn.resize(specs.channels, specs.buffersizeInFramesPerPeriode);
+		m_floatOut.resize(specs.channels, specs.buffersizeInFramesPerPeriode);
+	}
+
+	m_audioThread = new std::thread(AudioAlsaDuplex::worker, specs, this);
+}
+
+void AudioAlsaDuplex::stop()
+{
+	throwOnDeviceClosed(__FILE__, __func__, __LINE__);
+	setTerminateRequest();
+
+	m_audioThread->join();
+	delete m_audioThread;
+	m_audioThread = nullptr;
+
+	snd_pcm_unlink(m_captureHandle);
+}
+
+void AudioAlsaDuplex::init()
+{
+	throwOnDeviceClosed(__FILE__, __func__, __LINE__);
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params(m_handle, m_hwParams));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params(m_captureHandle, m_captureHwParams));
+
+	throwOnPeriodeMismatch();
+}
+
+void AudioAlsaDuplex::setBuffersize(unsigned int buffersize)
+{
+	basetype::setBuffersize(buffersize);
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_set_buffer_size(m_captureHandle, m_captureHwParams, static_cast<snd_pcm_uframes_t>(buffersize)));
+}
+
+void AudioAlsaDuplex::setBufferCount(unsigned int buffercount)
+{
+	basetype::setBufferCount(buffercount);
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_set_periods(m_captureHandle, m_captureHwParams, buffercount, 0));
+}
+
+void AudioAlsaDuplex::setSamplerate(samplerate_t rate)
+{
+	basetype::setSamplerate(rate);
+
+	// Use exactly what the playback stream got, so both run on the same clock
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_set_rate(m_captureHandle, m_captureHwParams, getSamplerate(), 0));
+}
+
+void AudioAlsaDuplex::setSampleFormat(sampleformat_t format)
+{
+	basetype::setSampleFormat(format);
+
+	snd_pcm_format_t alsaFormat = snd_pcm_format_value(format.c_str());
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_set_format(m_captureHandle, m_captureHwParams, alsaFormat));
+}
+
+void AudioAlsaDuplex::setChannelCount(channelcount_t n)
+{
+	basetype::setChannelCount(n);
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_set_channels(m_captureHandle, m_captureHwParams, n));
+}
+
+void AudioAlsaDuplex::setAccessMode(snd_pcm_access_t access)
+{
+	basetype::setAccessMode(access);
+	if (m_captureHandle)
+		throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_set_access(m_captureHandle, m_captureHwParams, access));
+}
+
+/** \ingroup Audio
+ *
+ * \brief Sets the callback, which is called for every periode
+ * \param callback A callback function of type \ref AudioCallbackInOut
+ * \param ptr User pointer, which is passed to the callback
+ *
+ * Without a callback, input is copied to output. Has to be called before start().
+ *
+*/
+void AudioAlsaDuplex::setCallback(AudioCallbackInOut callback, SharedUserPtr ptr)
+{
+	m_callback = callback;
+	m_floatCallback = nullptr;
+	m_userPtr = ptr;
+}
+
+/** \ingroup Audio
+ *
+ * \brief Sets a float callback, which is called for every periode
+ * \param callback A callback function of type \ref AudioCallbackFloatInOut
+ * \param ptr User pointer, which is passed to the callback
+ *
+ * Input is converted to planar float before, output is converted to the device
+ * format after the callback. Has to be called before start().
+ *
+*/
+void AudioAlsaDuplex::setCallback(AudioCallbackFloatInOut callback, SharedUserPtr ptr)
+{
+	m_callback = nullptr;
+	m_floatCallback = callback;
+	m_userPtr = ptr;
+}
+
+// Capture and playback have to match, otherwise a single loop can not serve both
+void AudioAlsaDuplex::throwOnPeriodeMismatch()
+{
+	snd_pcm_uframes_t playbackPeriode = 0, capturePeriode = 0;
+	snd_pcm_uframes_t playbackBuffer = 0, captureBuffer = 0;
+	unsigned int playbackRate = 0, captureRate = 0;
+	unsigned int playbackChannels = 0, captureChannels = 0;
+	snd_pcm_format_t playbackFormat, captureFormat;
+	int dir = 0;
+
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_period_size(m_hwParams, &playbackPeriode, &dir));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_period_size(m_captureHwParams, &capturePeriode, &dir));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_buffer_size(m_hwParams, &playbackBuffer));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_buffer_size(m_captureHwParams, &captureBuffer));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_rate(m_hwParams, &playbackRate, &dir));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_rate(m_captureHwParams, &captureRate, &dir));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_channels(m_hwParams, &playbackChannels));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_channels(m_captureHwParams, &captureChannels));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_format(m_hwParams, &playbackFormat));
+	throwOnAlsaError(__FILE__, __func__, __LINE__, snd_pcm_hw_params_get_format(m_captureHwParams, &captureFormat));
+
+	if (playbackPeriode != capturePeriode || playbackBuffer != captureBuffer ||
+		playbackRate != captureRate || playbackChannels != captureChannels ||
+		playbackFormat != captureFormat)
+		throw(AudioAlsaException(__func__, __FILE__, __LINE__, -EINVAL, "Capture and playback configuration differ."));
+}
+
+// Stops both streams, fills the playback buffer with silence and starts again
+void AudioAlsaDuplex::restartLinked(const SampleSpecs &specs, u_int8_t *silence, std::vector<void*> &silenceChannels)
+{
+	snd_pcm_drop(m_handle);
+	snd_pcm_prepare(m_handle);
+	if (snd_pcm_state(m_captureHandle) != SND_PCM_STATE_PREPARED)
+		snd_pcm_prepare(m_captureHandle);
+
+	const unsigned int periodes = specs.buffersizeInFrames / specs.buffersizeInFramesPerPeriode;
+	for (unsigned int i=0; i<periodes; i++)
+		writePeriode(m_handle, silence, silenceChannels, specs.buffersizeInFramesPerPeriode);
+
+	// Starting one stream starts the linked one as well
+	if (snd_pcm_state(m_handle) == SND_PCM_STATE_PREPARED)
+		snd_pcm_start(m_handle);
+}
+
+//static
+void AudioAlsaDuplex::worker(SampleSpecs specs, AudioAlsaDuplex *ptr)
+{
+	applyRealtimePolicy(ptr->m_realtimePolicy, "nlaudio_duplex");
+
+	const snd_pcm_sframes_t frames = specs.buffersizeInFramesPerPeriode;
+
+	u_int8_t *inBuffer = new u_int8_t[specs.buffersizeInBytesPerPeriode];
+	u_int8_t *outBuffer = new u_int8_t[specs.buffersizeInBytesPerPeriode];
+	u_int8_t *silence = new u_int8_t[specs.buffersizeInBytesPerPeriode];
+	memset(silence, 0, specs.buffersizeInBytesPerPeriode);
+
+	std::vector<void*> inChannels = getChannelPointers(inBuffer, specs);
+	std::vector<void*> outChannels = getChannelPointers(outBuffer, specs);
+	std::vector<void*> silenceChannels = getChannelPointers(silence, specs);
+
+	ptr->restartLinked(specs, silence, silenceChannels);
+
+	while(!ptr->getTerminateRequest()) {
+		snd_pcm_sframes_t ret = ptr->readPeriode(ptr->m_captureHandle, inBuffer, inChannels, frames);
+		if (ret != frames) {
+			ptr->m_xrunRecoveryCounter++;
+			ptr->restartLinked(specs, silence, silenceChannels);
+			continue;
+		}
+
+		if (ptr->m_floatCallback) {
+			getSamples(inBuffer, ptr->m_floatIn.channels(), specs.buffersizeInFramesPerPeriode, specs);
+			ptr->m_floatCallback(ptr->m_floatIn.channels(), ptr->m_floatOut.channels(), specs.buffersizeInFramesPerPeriode, specs, ptr->m_userPtr);
+			setSamples(outBuffer, ptr->m_floatOut.channels(), specs.buffersizeInFramesPerPeriode, specs);
+		} else if (ptr->m_callback)
+			ptr->m_callback(inBuffer, outBuffer, specs, ptr->m_userPtr);
+		else
+			memcpy(outBuffer, inBuffer, specs.buffersizeInBytesPerPeriode);
+
+		ret = ptr->writePeriode(ptr->m_handle, outBuffer, outChannels, frames);
+		if (ret != frames) {
+			ptr->m_xrunRecoveryCounter++;
+			ptr->restartLinked(specs, silence, silenceChannels);
+		}
+	}
+
+	snd_pcm_drop(ptr->m_handle);
+
+	delete[] inBuffer;
+	delete[] outBuffer;
+	delete[] silence;
+
+	std::cout << "void AudioAlsaDuplex::worker(SampleSpecs specs, AudioAlsaDuplex *ptr)" << std::endl;
+}
+
+} // namespace Nl
@@ -66,21 +66,26 @@ void AudioAlsaInput::init()
 //static
 void AudioAlsaInput::worker(SampleSpecs specs, AudioAlsaInput *ptr)
 {
+	applyRealtimePolicy(ptr->m_realtimePolicy, "nlaudio_in");
 
 	u_int8_t *buffer = new u_int8_t[specs.buffersizeInBytesPerPeriode];
 	memset(buffer, 0, specs.buffersizeInBytesPerPeriode);
+	std::vector<void*> channels = getChannelPointers(buffer, specs);
 
 	while(!ptr->getTerminateRequest()) {
 
-		int ret = snd_pcm_readi(ptr->m_handle, buffer, specs.buffersizeInFramesPerPeriode);
+		// In mmap mode, the data still has to be copied out of the hardware buffer, before it is passed on
+		int ret = ptr->readPeriode(ptr->m_handle, buffer, channels, specs.buffersizeInFramesPerPeriode);
 
 		if (ret < 0)
 			ptr->basetype::xrunRecovery(ptr, ret);
 		else if (ret != static_cast<int>(specs.buffersizeInFramesPerPeriode))
 			std::cout << "Only read " << ret << " of " << specs.buffersizeInFramesPerPeriode << " from input device." << std::endl;
 
-		// Might block, if no space in buffer
-		ptr->basetype::m_audioBuffer->set(buffer, specs.buffersizeInBytesPerPeriode);
+		// Might block, if no space in buffer. A non blocking buffer returns false instead,
+		// in that case the periode is dropped rather than stalling the device.
+		if (!ptr->basetype::m_audioBuffer->set(buffer, specs.buffersizeInBytesPerPeriode))
+			ptr->basetype::m_bufferXrunCounter++;
 	}
 
 	snd_pcm_abort(ptr->m_handle);
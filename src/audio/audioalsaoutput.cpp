@@ -22,7 +22,12 @@
 namespace Nl {
 
 AudioAlsaOutput::AudioAlsaOutput(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer) :
-	basetype(card, buffer, false)
+	basetype(card, buffer, false),
+	m_callback(nullptr),
+	m_inOutCallback(nullptr),
+	m_floatCallback(nullptr),
+	m_inBuffer(nullptr),
+	m_userPtr(nullptr)
 {
 }
 
@@ -42,7 +47,14 @@ void AudioAlsaOutput::start()
 	SampleSpecs specs = basetype::getSpecs();
 	std::cout << "NlAudioAlsaOutput Specs: " << std::endl << specs;
 
-	m_audioThread = new std::thread(AudioAlsaOutput::worker, specs, this);
+	if (m_floatCallback)
+		m_floatPeriode.resize(specs.channels, specs.buffersizeInFramesPerPeriode);
+
+	// Non interleaved mmap goes through snd_pcm_mmap_writen(), since the channels are not contiguous
+	if (isMmap() && isInterleaved())
+		m_audioThread = new std::thread(AudioAlsaOutput::mmapWorker, specs, this);
+	else
+		m_audioThread = new std::thread(AudioAlsaOutput::worker, specs, this);
 }
 
 void AudioAlsaOutput::stop()
@@ -63,16 +75,116 @@ void AudioAlsaOutput::init()
 	basetype::m_audioBuffer->init(basetype::getSpecs());
 }
 
+/** \ingroup Audio
+ *
+ * \brief Renders the output directly on the device thread
+ * \param callback A callback function of type \ref AudioCallbackOut, or nullptr to read from the buffer again
+ * \param ptr User pointer, which is passed to the callback
+ *
+ * If set, the callback is called by the device thread for every periode and writes
+ * into the memory, which is passed to the device. In mmap mode this is the hardware
+ * buffer itself. The buffer passed to the constructor is not used in that case.
+ * Has to be called before start().
+ *
+*/
+void AudioAlsaOutput::setCallback(AudioCallbackOut callback, SharedUserPtr ptr)
+{
+	m_callback = callback;
+	m_inOutCallback = nullptr;
+	m_floatCallback = nullptr;
+	m_inBuffer = nullptr;
+	m_userPtr = ptr;
+}
+
+/** \ingroup Audio
+ *
+ * \brief Renders input to output directly on the device thread
+ * \param inBuffer The buffer, an input device writes to. Should be a non blocking buffer.
+ * \param callback A callback function of type \ref AudioCallbackInOut
+ * \param ptr User pointer, which is passed to the callback
+ *
+ * Same as setCallback(AudioCallbackOut, SharedUserPtr), but one periode is read from
+ * \a inBuffer and passed to the callback as well. If no input is available, silence is passed
+ * and the event is counted in BufferStatistics::bufferXrunCount.
+ * Has to be called before start().
+ *
+*/
+void AudioAlsaOutput::setCallback(SharedBufferHandle inBuffer, AudioCallbackInOut callback, SharedUserPtr ptr)
+{
+	m_callback = nullptr;
+	m_inOutCallback = callback;
+	m_floatCallback = nullptr;
+	m_inBuffer = inBuffer;
+	m_userPtr = ptr;
+}
+
+/** \ingroup Audio
+ *
+ * \brief Renders planar float samples directly on the device thread
+ * \param callback A callback function of type \ref AudioCallbackFloatOut
+ * \param ptr User pointer, which is passed to the callback
+ *
+ * Same as setCallback(AudioCallbackOut, SharedUserPtr), but the callback gets one float
+ * array per channel. The samples are converted to the device format once per periode.
+ * Has to be called before start().
+ *
+*/
+void AudioAlsaOutput::setCallback(AudioCallbackFloatOut callback, SharedUserPtr ptr)
+{
+	m_callback = nullptr;
+	m_inOutCallback = nullptr;
+	m_floatCallback = callback;
+	m_inBuffer = nullptr;
+	m_userPtr = ptr;
+}
+
+// Fills one periode, either by the callback or from the buffer
+void AudioAlsaOutput::renderPeriode(u_int8_t *buffer, u_int8_t *inBuffer, const SampleSpecs &specs)
+{
+	if (m_floatCallback) {
+		m_floatCallback(m_floatPeriode.channels(), specs.buffersizeInFramesPerPeriode, specs, m_userPtr);
+		setSamples(buffer, m_floatPeriode.channels(), specs.buffersizeInFramesPerPeriode, specs);
+	} else if (m_callback) {
+		m_callback(buffer, specs, m_userPtr);
+	} else if (m_inOutCallback) {
+		if (!m_inBuffer->get(inBuffer, specs.buffersizeInBytesPerPeriode)) {
+			memset(inBuffer, 0, specs.buffersizeInBytesPerPeriode);
+			m_bufferXrunCounter++;
+		}
+		m_inOutCallback(inBuffer, buffer, specs, m_userPtr);
+	} else if (!m_audioBuffer->get(buffer, specs.buffersizeInBytesPerPeriode)) {
+		// Might block, if nothing to read. A non blocking buffer returns false instead,
+		// in that case we play silence rather than stalling the device.
+		memset(buffer, 0, specs.buffersizeInBytesPerPeriode);
+		m_bufferXrunCounter++;
+	}
+}
+
 //static
 void AudioAlsaOutput::worker(SampleSpecs specs, AudioAlsaOutput *ptr)
 {
+	applyRealtimePolicy(ptr->m_realtimePolicy, "nlaudio_out");
+
 	u_int8_t *buffer = new u_int8_t[specs.buffersizeInBytesPerPeriode];
+	u_int8_t *inBuffer = new u_int8_t[specs.buffersizeInBytesPerPeriode];
 	memset(buffer, 0, specs.buffersizeInBytesPerPeriode);
+	std::vector<void*> channels = getChannelPointers(buffer, specs);
+
+	const bool directCallback = ptr->hasCallback();
 
 	while(!ptr->getTerminateRequest()) {
-		// Might block, if nothing to read
-		ptr->basetype::m_audioBuffer->get(buffer, specs.buffersizeInBytesPerPeriode);
-		int ret = snd_pcm_writei(ptr->m_handle, buffer, specs.buffersizeInFramesPerPeriode);
+		// With a callback on this thread, we wait for space first, so that the periode is
+		// rendered as late as possible and the write does not block afterwards.
+		if (directCallback) {
+			int ret = snd_pcm_wait(ptr->m_handle, 1000);
+			if (ret < 0) {
+				ptr->basetype::xrunRecovery(ptr, ret);
+				continue;
+			}
+		}
+
+		ptr->renderPeriode(buffer, inBuffer, specs);
+		int ret = ptr->writePeriode(ptr->m_handle, buffer, channels, specs.buffersizeInFramesPerPeriode);
 		if (ret < 0)
 			ptr->basetype::xrunRecovery(ptr, ret);
 		else if (ret != static_cast<int>(specs.buffersizeInFramesPerPeriode))
@@ -81,8 +193,93 @@ void AudioAlsaOutput::worker(SampleSpecs specs, AudioAlsaOutput *ptr)
 
 	snd_pcm_abort(ptr->m_handle);
 	delete[] buffer;
+	delete[] inBuffer;
 
 	std::cout << "void AudioAlsaOutput::worker(SampleSpecs specs, AudioAlsaInput *ptr)" << std::endl;
 }
 
+//static
+void AudioAlsaOutput::mmapWorker(SampleSpecs specs, AudioAlsaOutput *ptr)
+{
+	applyRealtimePolicy(ptr->m_realtimePolicy, "nlaudio_out");
+
+	const snd_pcm_uframes_t framesPerPeriode = specs.buffersizeInFramesPerPeriode;
+
+	// Only used, if a periode wraps around the end of the hardware buffer
+	u_int8_t *scratch = new u_int8_t[specs.buffersizeInBytesPerPeriode];
+	u_int8_t *inBuffer = new u_int8_t[specs.buffersizeInBytesPerPeriode];
+
+	while(!ptr->getTerminateRequest()) {
+		snd_pcm_sframes_t avail = snd_pcm_avail_update(ptr->m_handle);
+		if (avail < 0) {
+			ptr->basetype::xrunRecovery(ptr, avail);
+			continue;
+		}
+
+		if (static_cast<snd_pcm_uframes_t>(avail) < framesPerPeriode) {
+			// Hardware buffer is full. After prepare or xrun recovery, we have to start manually.
+			if (snd_pcm_state(ptr->m_handle) == SND_PCM_STATE_PREPARED) {
+				snd_pcm_start(ptr->m_handle);
+			} else {
+				int ret = snd_pcm_wait(ptr->m_handle, 1000);
+				if (ret < 0)
+					ptr->basetype::xrunRecovery(ptr, ret);
+			}
+			continue;
+		}
+
+		const snd_pcm_channel_area_t *areas = nullptr;
+		snd_pcm_uframes_t offset = 0;
+		snd_pcm_uframes_t frames = framesPerPeriode;
+
+		int ret = snd_pcm_mmap_begin(ptr->m_handle, &areas, &offset, &frames);
+		if (ret < 0) {
+			ptr->basetype::xrunRecovery(ptr, ret);
+			continue;
+		}
+
+		u_int8_t *hwBuffer = static_cast<u_int8_t*>(areas[0].addr) + (areas[0].first + offset * areas[0].step) / 8;
+
+		if (frames == framesPerPeriode) {
+			// Zero copy: render straight into the hardware buffer
+			ptr->renderPeriode(hwBuffer, inBuffer, specs);
+			ret = snd_pcm_mmap_commit(ptr->m_handle, offset, frames);
+			if (ret < 0 || static_cast<snd_pcm_uframes_t>(ret) != frames)
+				ptr->basetype::xrunRecovery(ptr, ret >= 0 ? -EPIPE : ret);
+			continue;
+		}
+
+		// Periode wraps around, copy it in segments
+		ptr->renderPeriode(scratch, inBuffer, specs);
+
+		snd_pcm_uframes_t done = 0;
+		while (true) {
+			memcpy(hwBuffer, scratch + done * specs.bytesPerFrame, frames * specs.bytesPerFrame);
+			ret = snd_pcm_mmap_commit(ptr->m_handle, offset, frames);
+			if (ret < 0 || static_cast<snd_pcm_uframes_t>(ret) != frames) {
+				ptr->basetype::xrunRecovery(ptr, ret >= 0 ? -EPIPE : ret);
+				break;
+			}
+
+			done += frames;
+			if (done >= framesPerPeriode)
+				break;
+
+			frames = framesPerPeriode - done;
+			ret = snd_pcm_mmap_begin(ptr->m_handle, &areas, &offset, &frames);
+			if (ret < 0) {
+				ptr->basetype::xrunRecovery(ptr, ret);
+				break;
+			}
+			hwBuffer = static_cast<u_int8_t*>(areas[0].addr) + (areas[0].first + offset * areas[0].step) / 8;
+		}
+	}
+
+	snd_pcm_abort(ptr->m_handle);
+	delete[] scratch;
+	delete[] inBuffer;
+
+	std::cout << "void AudioAlsaOutput::mmapWorker(SampleSpecs specs, AudioAlsaOutput *ptr)" << std::endl;
+}
+
 } // namespace Nl
@@ -22,8 +22,10 @@
 #include "midi/rawmididevice.h"
 #include "audio/audioalsainput.h"
 #include "audio/audioalsaoutput.h"
+#include "audio/audioalsaduplex.h"
 #include "audio/audiojack.h"
 #include "common/blockingcircularbuffer.h"
+#include "common/nonblockingcircularbuffer.h"
 #include "audio/samplespecs.h"
 #include "midi/rawmididevice.h"
 
@@ -59,6 +61,10 @@ SharedTerminateFlag createTerminateFlag()
 */
 void terminateWorkingThread(WorkingThreadHandle handle)
 {
+	// Nothing to do for jobs, that run their callback on the device thread
+	if (!handle.thread)
+		return;
+
 	handle.terminateRequest->store(true);
 	handle.thread->join();
 }
@@ -80,6 +86,26 @@ SharedBufferHandle createBuffer(const std::string& name)
 	return newBuffer;
 }
 
+/** \ingroup Factory
+ *
+ * \brief Create a non blocking buffer
+ * \param name A buffer name.
+ * \return A handle of type \ref SharedBuffer
+ *
+ * Create a lock free single producer/single consumer buffer of type \ref SharedBuffer that
+ * can be found by its name using Nl::getBufferForName(). The audio threads never block on it,
+ * instead an underrun on output is filled with silence and an overrun on input is dropped.
+ * Both are counted in BufferStatistics::bufferXrunCount.
+ *
+*/
+SharedBufferHandle createNonBlockingBuffer(const std::string& name)
+{
+	SharedBufferHandle newBuffer = SharedBufferHandle(new NonBlockingCircularBuffer<u_int8_t>(name));
+
+	BuffersDictionary.insert(std::make_pair(name, newBuffer));
+	return newBuffer;
+}
+
 //TODO: Make this operation O(1)! Using a hash.
 /** \ingroup Factory
  *
@@ -106,16 +132,18 @@ SharedBufferHandle getBufferForName(const std::string& name)
  * \brief Creates a handle to a RawMidiDevice device for a given \a card
  * \param card A device identifier
  * \param buffer The buffer
+ * \param policy RealtimePolicy for the reader thread of the device
  * \return A handle of type \ref RawMidiDevice_t
  *
  * Factory function which creates a handle of type \ref RawMidiDevice_t to the given RawMidiDevice.\n
  * The device is automatically opened.\n
  *
 */
-SharedRawMidiDeviceHandle createRawMidiDevice(const AlsaMidiCardIdentifier &card, SharedBufferHandle buffer)
+SharedRawMidiDeviceHandle createRawMidiDevice(const AlsaMidiCardIdentifier &card, SharedBufferHandle buffer, const RealtimePolicy &policy)
 {
 	SharedRawMidiDeviceHandle midi(new RawMidiDevice(card, buffer));
 	midi->open();
+	midi->setRealtimePolicy(policy);
 	return midi;
 }
 
@@ -125,21 +153,26 @@ SharedRawMidiDeviceHandle createRawMidiDevice(const AlsaMidiCardIdentifier &card
  * \param card A device identifier
  * \param buffer The buffer
  * \param buffersize Buffersize in frames.
+ * \param policy RealtimePolicy for the working thread of the device
  * \return A handle of type \ref SharedAudioHandle
  *
- * Factory function which creates a handle of type \ref SharedAudioHandle to the given input device.\n
- * ???? Buffercount is set to 2. (See AudioAlsaOutput::setBufferCount())\n
+ * Factory function which creates a handle of type \ref SharedAudioHandle to a JACK client with input ports.\n
+ * Samplerate and periode size are taken from the JACK server, \a card and \a buffersize are informational only.\n
+ * Buffercount is set to 2, which is the number of JACK periodes the buffer holds.\n
  * The device is automatically opened.\n
  *
 */
-SharedAudioHandle createJackInputDevice(const AlsaAudioCardIdentifier& card, SharedBufferHandle buffer, unsigned int buffersize)
+SharedAudioHandle createJackInputDevice(const AlsaAudioCardIdentifier& card, SharedBufferHandle buffer, unsigned int buffersize, const RealtimePolicy &policy)
 {
 	SharedAudioHandle input(new AudioJack(card, buffer, true));
 	input->open();
-	//input->setBufferCount(2);
+	input->setBufferCount(2);
 	// We want buffersize to be the latency defining parameter. Therefore we have to multiply with buffercount
 	input->setBuffersize(buffersize*input->getBufferCount());
 
+	if (!policy.isDefault())
+		input->setRealtimePolicy(policy);
+
 	return input;
 }
 
@@ -149,21 +182,26 @@ SharedAudioHandle createJackInputDevice(const AlsaAudioCardIdentifier& card, Sha
  * \param card A device identifier
  * \param buffer The buffer
  * \param buffersize Buffersize in frames.
+ * \param policy RealtimePolicy for the working thread of the device
  * \return A handle of type \ref SharedAudioHandle
  *
- * Factory function which creates a handle of type \ref SharedAudioHandle to the given output device.\n
- * ???? Buffercount is set to 2. (See AudioAlsaOutput::setBufferCount())\n
+ * Factory function which creates a handle of type \ref SharedAudioHandle to a JACK client with output ports.\n
+ * Samplerate and periode size are taken from the JACK server, \a card and \a buffersize are informational only.\n
+ * Buffercount is set to 2, which is the number of JACK periodes the buffer holds.\n
  * The device is automatically opened.\n
  *
 */
-SharedAudioHandle createJackOutputDevice(const AlsaAudioCardIdentifier& card, SharedBufferHandle buffer, unsigned int buffersize)
+SharedAudioHandle createJackOutputDevice(const AlsaAudioCardIdentifier& card, SharedBufferHandle buffer, unsigned int buffersize, const RealtimePolicy &policy)
 {
 	SharedAudioHandle output(new AudioJack(card, buffer, false));
 	output->open();
-	//input->setBufferCount(2);
+	output->setBufferCount(2);
 	// We want buffersize to be the latency defining parameter. Therefore we have to multiply with buffercount
 	output->setBuffersize(buffersize*output->getBufferCount());
 
+	if (!policy.isDefault())
+		output->setRealtimePolicy(policy);
+
 	return output;
 }
 
@@ -173,6 +211,7 @@ SharedAudioHandle createJackOutputDevice(const AlsaAudioCardIdentifier& card, Sh
  * \param card A device identifier
  * \param buffer The buffer
  * \param buffersize Buffersize in frames.
+ * \param policy RealtimePolicy for the working thread of the device
  * \return A handle of type \ref SharedAudioHandle
  *
  * Factory function which creates a handle of type \ref SharedAudioHandle to the given input device.\n
@@ -180,7 +219,7 @@ SharedAudioHandle createJackOutputDevice(const AlsaAudioCardIdentifier& card, Sh
  * The device is automatically opened.\n
  *
 */
-SharedAudioHandle createAlsaInputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize)
+SharedAudioHandle createAlsaInputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize, const RealtimePolicy &policy)
 {
 	SharedAudioHandle input(new AudioAlsaInput(card, buffer));
 	input->open();
@@ -188,6 +227,9 @@ SharedAudioHandle createAlsaInputDevice(const AlsaAudioCardIdentifier &card, Sha
 	// We want buffersize to be the latency defining parameter. Therefore we have to multiply with buffercount
 	input->setBuffersize(buffersize*input->getBufferCount());
 
+	if (!policy.isDefault())
+		input->setRealtimePolicy(policy);
+
 	return input;
 }
 
@@ -233,6 +275,7 @@ SharedAudioHandle createAlsaInputDevice(const AlsaAudioCardIdentifier &card, Sha
  * \param card A device identifier
  * \param buffer The buffer
  * \param buffersize Buffersize in frames.
+ * \param policy RealtimePolicy for the working thread of the device
  * \return A handle of type \ref SharedAudioHandle
  *
  * Factory function which creates a handle of type \ref SharedAudioHandle to the given output device.\n
@@ -240,7 +283,7 @@ SharedAudioHandle createAlsaInputDevice(const AlsaAudioCardIdentifier &card, Sha
  * The device is automatically opened.\n
  *
 */
-SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize)
+SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, unsigned int buffersize, const RealtimePolicy &policy)
 {
 	SharedAudioHandle output(new AudioAlsaOutput(card, buffer));
 	output->open();
@@ -248,6 +291,9 @@ SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, Sh
 	// We want buffersize to be the latency defining parameter. Therefore we have to multiply with buffercount
 	output->setBuffersize(buffersize*output->getBufferCount());
 
+	if (!policy.isDefault())
+		output->setRealtimePolicy(policy);
+
 	return output;
 }
 
@@ -269,6 +315,35 @@ SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, Sh
 	return createAlsaOutputDevice(card, buffer, DEFAULT_BUFFERSIZE);
 }
 
+/** \ingroup Factory
+ *
+ * \brief Creates a handle to a full duplex device for a given \a card
+ * \param card A device identifier
+ * \param buffersize Buffersize in frames.
+ * \param policy RealtimePolicy for the working thread of the device
+ * \return A handle of type \ref SharedAudioHandle
+ *
+ * Factory function which creates a handle of type \ref SharedAudioHandle to a linked
+ * capture/playback pair on the given card (See AudioAlsaDuplex).\n
+ * Buffercount is set to 2 on both streams.\n
+ * The device is automatically opened.\n
+ * Use Nl::registerInOutCallbackOnDevice() to set the callback before the device is started.
+ *
+*/
+SharedAudioHandle createAlsaDuplexDevice(const AlsaAudioCardIdentifier &card, unsigned int buffersize, const RealtimePolicy &policy)
+{
+	SharedAudioHandle duplex(new AudioAlsaDuplex(card));
+	duplex->open();
+	duplex->setBufferCount(2);
+	// We want buffersize to be the latency defining parameter. Therefore we have to multiply with buffercount
+	duplex->setBuffersize(buffersize*duplex->getBufferCount());
+
+	if (!policy.isDefault())
+		duplex->setRealtimePolicy(policy);
+
+	return duplex;
+}
+
 /** \ingroup Factory
  *
  * \brief Creates a handle to the default output device
@@ -292,6 +367,8 @@ SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, Sh
  * \brief Registers a callback on a \ref SharedBuffer for Output operations
  * \param inBuffer The input buffer
  * \param callback A callback function of type \ref audioCallbackIn
+ * \param ptr User pointer, which is passed to the callback
+ * \param policy RealtimePolicy for the working thread
  * \return A handle of type \ref WorkingThreadHandle, which can be used to start/stop the working thread.
  *
  * Factory function which creates a reading thread to perform the blocking read
@@ -301,7 +378,8 @@ SharedAudioHandle createAlsaOutputDevice(const AlsaAudioCardIdentifier &card, Sh
 */
 WorkingThreadHandle registerInputCallbackOnBuffer(SharedBufferHandle inBuffer,
 												  AudioCallbackIn callback,
-												  SharedUserPtr ptr)
+												  SharedUserPtr ptr,
+												  const RealtimePolicy &policy)
 {
 	WorkingThreadHandle handle;
 	handle.terminateRequest = createTerminateFlag();
@@ -309,7 +387,8 @@ WorkingThreadHandle registerInputCallbackOnBuffer(SharedBufferHandle inBuffer,
 																 inBuffer,
 																 callback,
 																 handle.terminateRequest,
-																 ptr));
+																 ptr,
+																 policy));
 	return handle;
 }
 
@@ -318,6 +397,8 @@ WorkingThreadHandle registerInputCallbackOnBuffer(SharedBufferHandle inBuffer,
  * \brief Registers a callback on a \ref SharedBuffer for Output operations
  * \param outBuffer The output buffer
  * \param callback A callback function of type \ref audioCallbackOut
+ * \param ptr User pointer, which is passed to the callback
+ * \param policy RealtimePolicy for the working thread
  * \return A handle of type \ref WorkingThreadHandle, which can be used to start/stop the working thread.
  *
  * Factory function which creates a writing thread to perform the blocking write
@@ -327,7 +408,8 @@ WorkingThreadHandle registerInputCallbackOnBuffer(SharedBufferHandle inBuffer,
 */
 WorkingThreadHandle registerOutputCallbackOnBuffer(SharedBufferHandle outBuffer,
 												   AudioCallbackOut callback,
-												   SharedUserPtr ptr)
+												   SharedUserPtr ptr,
+												   const RealtimePolicy &policy)
 {
 	WorkingThreadHandle handle;
 	handle.terminateRequest = createTerminateFlag();
@@ -335,7 +417,8 @@ WorkingThreadHandle registerOutputCallbackOnBuffer(SharedBufferHandle outBuffer,
 																 outBuffer,
 																 callback,
 																 handle.terminateRequest,
-																 ptr));
+																 ptr,
+																 policy));
 	return handle;
 }
 
@@ -345,6 +428,8 @@ WorkingThreadHandle registerOutputCallbackOnBuffer(SharedBufferHandle outBuffer,
  * \param inBuffer The input buffer
  * \param outBuffer The output buffer
  * \param callback A callback function of type \ref audioCallbackInOut
+ * \param ptr User pointer, which is passed to the callback
+ * \param policy RealtimePolicy for the working thread
  * \return A handle of type \ref WorkingThreadHandle, which can be used to start/stop the working thread.
  *
  * Factory function which creates a reading and a writing thread to perform the blocking read/write
@@ -355,7 +440,8 @@ WorkingThreadHandle registerOutputCallbackOnBuffer(SharedBufferHandle outBuffer,
 WorkingThreadHandle registerInOutCallbackOnBuffer(SharedBufferHandle inBuffer,
 												  SharedBufferHandle outBuffer,
 												  AudioCallbackInOut callback,
-												  SharedUserPtr ptr)
+												  SharedUserPtr ptr,
+												  const RealtimePolicy &policy)
 {
 	WorkingThreadHandle handle;
 	handle.terminateRequest = createTerminateFlag();
@@ -364,7 +450,8 @@ WorkingThreadHandle registerInOutCallbackOnBuffer(SharedBufferHandle inBuffer,
 																 outBuffer,
 																 callback,
 																 handle.terminateRequest,
-																 ptr));
+																 ptr,
+																 policy));
 	return handle;
 }
 
@@ -391,5 +478,260 @@ WorkingThreadHandle registerAutoDrainOnBuffer(SharedBufferHandle inBuffer)
 	return handle;
 }
 
+/** \ingroup Factory
+ *
+ * \brief Registers a float callback on a \ref SharedBuffer for Input operations
+ * \param inBuffer The input buffer
+ * \param callback A callback function of type \ref AudioCallbackFloatIn
+ * \param ptr User pointer, which is passed to the callback
+ * \param policy RealtimePolicy for the working thread
+ * \return A handle of type \ref WorkingThreadHandle, which can be used to start/stop the working thread.
+ *
+ * Same as the byte variant, but the working thread converts each periode from the buffer
+ * to planar float, before the \a callback is called. The buffer still carries the device
+ * format, use Nl::negotiateSampleFormat() on the device before it is started.
+ *
+*/
+WorkingThreadHandle registerInputCallbackOnBuffer(SharedBufferHandle inBuffer,
+												  AudioCallbackFloatIn callback,
+												  SharedUserPtr ptr,
+												  const RealtimePolicy &policy)
+{
+	WorkingThreadHandle handle;
+	handle.terminateRequest = createTerminateFlag();
+	handle.thread = std::shared_ptr<std::thread>(new std::thread(readAudioFloatFunction,
+																 inBuffer,
+																 callback,
+																 handle.terminateRequest,
+																 ptr,
+																 policy));
+	return handle;
+}
+
+/** \ingroup Factory
+ *
+ * \brief Registers a float callback on a \ref SharedBuffer for Output operations
+ * \param outBuffer The output buffer
+ * \param callback A callback function of type \ref AudioCallbackFloatOut
+ * \param ptr User pointer, which is passed to the callback
+ * \param policy RealtimePolicy for the working thread
+ * \return A handle of type \ref WorkingThreadHandle, which can be used to start/stop the working thread.
+ *
+ * Same as the byte variant, but the \a callback renders planar float samples, which the
+ * working thread converts to the format of the buffer once per periode.
+ *
+*/
+WorkingThreadHandle registerOutputCallbackOnBuffer(SharedBufferHandle outBuffer,
+												   AudioCallbackFloatOut callback,
+												   SharedUserPtr ptr,
+												   const RealtimePolicy &policy)
+{
+	WorkingThreadHandle handle;
+	handle.terminateRequest = createTerminateFlag();
+	handle.thread = std::shared_ptr<std::thread>(new std::thread(writeAudioFloatFunction,
+																 outBuffer,
+																 callback,
+																 handle.terminateRequest,
+																 ptr,
+																 policy));
+	return handle;
+}
+
+/** \ingroup Factory
+ *
+ * \brief Registers a float callback on a \ref SharedBuffer for Input/Output operations
+ * \param inBuffer The input buffer
+ * \param outBuffer The output buffer
+ * \param callback A callback function of type \ref AudioCallbackFloatInOut
+ * \param ptr User pointer, which is passed to the callback
+ * \param policy RealtimePolicy for the working thread
+ * \return A handle of type \ref WorkingThreadHandle, which can be used to start/stop the working thread.
+ *
+ * Same as the byte variant, but the working thread converts the input periode to planar float
+ * and the planar float output of the \a callback to the format of \a outBuffer.
+ *
+*/
+WorkingThreadHandle registerInOutCallbackOnBuffer(SharedBufferHandle inBuffer,
+												  SharedBufferHandle outBuffer,
+												  AudioCallbackFloatInOut callback,
+												  SharedUserPtr ptr,
+												  const RealtimePolicy &policy)
+{
+	WorkingThreadHandle handle;
+	handle.terminateRequest = createTerminateFlag();
+	handle.thread = std::shared_ptr<std::thread>(new std::thread(readWriteAudioFloatFunction,
+																 inBuffer,
+																 outBuffer,
+																 callback,
+																 handle.terminateRequest,
+																 ptr,
+																 policy));
+	return handle;
+}
+
+// Returns the AudioAlsaOutput behind a handle or throws
+static AudioAlsaOutput* getAlsaOutput(SharedAudioHandle output, const std::string& func)
+{
+	AudioAlsaOutput *alsaOutput = dynamic_cast<AudioAlsaOutput*>(output.get());
+	if (!alsaOutput)
+		throw(AudioAlsaException(func, __FILE__, __LINE__, -EINVAL, "Direct callbacks are only supported on AudioAlsaOutput."));
+
+	return alsaOutput;
+}
+
+/** \ingroup Factory
+ *
+ * \brief Registers a callback directly on an output device
+ * \param output An output device, created by Nl::createAlsaOutputDevice() or Nl::createJackOutputDevice()
+ * \param callback A callback function of type \ref audioCallbackOut
+ * \param ptr User pointer, which is passed to the callback
+ * \throw AudioAlsaException is thrown, if \a output is neither an ALSA nor a JACK output device.
+ *
+ * Unlike Nl::registerOutputCallbackOnBuffer() no extra thread and no buffer is involved. The
+ * \a callback is called by the device thread itself, right after the device is ready for another
+ * periode. This saves one periode of latency and one context switch per periode. For JACK devices
+ * the \a callback is called from the JACK process callback.
+ * Has to be called before the device is started. No \ref WorkingThreadHandle is needed.
+ *
+*/
+void registerOutputCallbackOnDevice(SharedAudioHandle output,
+									AudioCallbackOut callback,
+									SharedUserPtr ptr)
+{
+	AudioJack *jack = dynamic_cast<AudioJack*>(output.get());
+	if (jack) {
+		jack->setCallback(callback, ptr);
+		return;
+	}
+
+	getAlsaOutput(output, __func__)->setCallback(callback, ptr);
+}
+
+/** \ingroup Factory
+ *
+ * \brief Registers an in/out callback directly on an output device
+ * \param inBuffer The input buffer, best created by Nl::createNonBlockingBuffer()
+ * \param output An output device, created by Nl::createAlsaOutputDevice()
+ * \param callback A callback function of type \ref audioCallbackInOut
+ * \param ptr User pointer, which is passed to the callback
+ * \throw AudioAlsaException is thrown, if \a output is not an ALSA output device.
+ *
+ * Same as Nl::registerOutputCallbackOnDevice(), but the output device thread reads one periode
+ * from \a inBuffer and passes it to the \a callback as well. The input device still runs
+ * its own thread, but the callback thread of Nl::registerInOutCallbackOnBuffer() is gone.
+ * Has to be called before the device is started.
+ *
+*/
+void registerInOutCallbackOnDevice(SharedBufferHandle inBuffer,
+								   SharedAudioHandle output,
+								   AudioCallbackInOut callback,
+								   SharedUserPtr ptr)
+{
+	getAlsaOutput(output, __func__)->setCallback(inBuffer, callback, ptr);
+}
+
+/** \ingroup Factory
+ *
+ * \brief Registers an in/out callback on a duplex device
+ * \param duplex A duplex device, created by Nl::createAlsaDuplexDevice()
+ * \param callback A callback function of type \ref audioCallbackInOut
+ * \param ptr User pointer, which is passed to the callback
+ * \throw AudioAlsaException is thrown, if \a duplex is not an AudioAlsaDuplex.
+ *
+ * The \a callback is called by the single device thread between reading and writing a periode.
+ * Has to be called before the device is started.
+ *
+*/
+void registerInOutCallbackOnDevice(SharedAudioHandle duplex,
+								   AudioCallbackInOut callback,
+								   SharedUserPtr ptr)
+{
+	AudioAlsaDuplex *alsaDuplex = dynamic_cast<AudioAlsaDuplex*>(duplex.get());
+	if (!alsaDuplex)
+		throw(AudioAlsaException(__func__, __FILE__, __LINE__, -EINVAL, "Device is not an AudioAlsaDuplex."));
+
+	alsaDuplex->setCallback(callback, ptr);
+}
+
+/** \ingroup Factory
+ *
+ * \brief Selects the best sample format, the device supports
+ * \param device An ALSA or JACK device, which is not started yet
+ * \return The selected format
+ *
+ * Prefers native float, then the widest integer format. If none of the known formats
+ * is available, the current format is kept. Used by the float callback registrations,
+ * since the format does not matter to float clients anymore.
+ *
+*/
+sampleformat_t negotiateSampleFormat(SharedAudioHandle device)
+{
+	static const char* preferredFormats[] = { "FLOAT_LE", "S32_LE", "S24_LE", "S24_3LE", "S16_LE" };
+
+	const std::list<sampleformat_t> available = device->getAvailableSampleformats();
+
+	for (const char* format : preferredFormats) {
+		if (std::find(available.begin(), available.end(), format) != available.end()) {
+			device->setSampleFormat(format);
+			return format;
+		}
+	}
+
+	return device->getSampleFormat();
+}
+
+/** \ingroup Factory
+ *
+ * \brief Registers a float callback directly on an output device
+ * \param output An output device, created by Nl::createAlsaOutputDevice() or Nl::createJackOutputDevice()
+ * \param callback A callback function of type \ref AudioCallbackFloatOut
+ * \param ptr User pointer, which is passed to the callback
+ * \throw AudioAlsaException is thrown, if \a output is neither an ALSA nor a JACK output device.
+ *
+ * Same as the byte variant, but the \a callback renders planar float samples. The device format
+ * is negotiated using Nl::negotiateSampleFormat() and the conversion is done once per periode by
+ * the device. JACK ports are passed to the \a callback without any conversion.
+ * Has to be called before the device is started.
+ *
+*/
+void registerOutputCallbackOnDevice(SharedAudioHandle output,
+									AudioCallbackFloatOut callback,
+									SharedUserPtr ptr)
+{
+	AudioJack *jack = dynamic_cast<AudioJack*>(output.get());
+	if (jack) {
+		jack->setCallback(callback, ptr);
+		return;
+	}
+
+	AudioAlsaOutput *alsaOutput = getAlsaOutput(output, __func__);
+	negotiateSampleFormat(output);
+	alsaOutput->setCallback(callback, ptr);
+}
+
+/** \ingroup Factory
+ *
+ * \brief Registers a float in/out callback on a duplex device
+ * \param duplex A duplex device, created by Nl::createAlsaDuplexDevice()
+ * \param callback A callback function of type \ref AudioCallbackFloatInOut
+ * \param ptr User pointer, which is passed to the callback
+ * \throw AudioAlsaException is thrown, if \a duplex is not an AudioAlsaDuplex.
+ *
+ * Same as the byte variant, but the \a callback works on planar float samples. The device format
+ * is negotiated using Nl::negotiateSampleFormat().
+ * Has to be called before the device is started.
+ *
+*/
+void registerInOutCallbackOnDevice(SharedAudioHandle duplex,
+								   AudioCallbackFloatInOut callback,
+								   SharedUserPtr ptr)
+{
+	AudioAlsaDuplex *alsaDuplex = dynamic_cast<AudioAlsaDuplex*>(duplex.get());
+	if (!alsaDuplex)
+		throw(AudioAlsaException(__func__, __FILE__, __LINE__, -EINVAL, "Device is not an AudioAlsaDuplex."));
+
+	negotiateSampleFormat(duplex);
+	alsaDuplex->setCallback(callback, ptr);
+}
 
 } // namespace Nl
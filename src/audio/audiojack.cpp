@@ -18,19 +18,33 @@
 ***/
 
 #include "audio/audiojack.h"
-#include "common/blockingcircularbuffer.h"
 #include "common/alsa/alsacardidentifier.h"
 
+#include <algorithm>
+#include <iostream>
+#include <cstring>
+#include <string>
 
 namespace Nl {
 
+static const char* JACK_SAMPLE_FORMAT = "FLOAT_LE"; /*!< JACK ports always carry 32 bit float */
+static const unsigned int JACK_MAX_PERIODE = 8192; /*!< Largest periode size of a JACK server in frames, scratch memory and buffer are sized for it */
+
 AudioJack::AudioJack(const AlsaAudioCardIdentifier &card, SharedBufferHandle buffer, bool isInput) :
 	m_isInput(isInput),
 	m_audioBuffer(buffer),
-	m_jackPort(nullptr),
 	m_jackClient(nullptr),
-	m_card(card)
-
+	m_card(card),
+	m_channels(2),
+	m_bufferCount(2),
+	m_specs(),
+	m_scratch(nullptr),
+	m_scratchSize(0),
+	m_callback(nullptr),
+	m_floatCallback(nullptr),
+	m_userPtr(nullptr),
+	m_xrunCounter(0),
+	m_bufferXrunCounter(0)
 {
 	std::cout << "New " << __func__ << " as " << (isInput ? "input" : "output") << std::endl;
 }
@@ -38,148 +52,421 @@ AudioJack::AudioJack(const AlsaAudioCardIdentifier &card, SharedBufferHandle buf
 AudioJack::~AudioJack()
 {
 	close();
+	delete[] m_scratch;
 }
 
 void AudioJack::open()
 {
 	jack_status_t status;
-	if ((m_jackClient = jack_client_open("jack_client_open", JackNullOption, &status)) == nullptr) {
-		std::cout << "### JACK server not running? ret=" << m_jackClient << " status=" << status << std::endl;
-	}
+	const std::string clientName = m_isInput ? "nlaudio_in" : "nlaudio_out";
 
-	if ((m_jackPort = jack_port_register(m_jackClient, "jack_port_register", JACK_DEFAULT_AUDIO_TYPE,
-										 m_isInput ? JackPortIsInput : JackPortIsOutput, 0)) == nullptr) {
-		std::cout << "### some error on calling jack_port_register" << std::endl;
+	if ((m_jackClient = jack_client_open(clientName.c_str(), JackNoStartServer, &status)) == nullptr) {
+		std::cout << "### JACK server not running? status=" << status << std::endl;
+		return;
 	}
 
+	jack_set_buffer_size_callback(m_jackClient, AudioJack::bufferSizeChanged, this);
+	jack_set_xrun_callback(m_jackClient, AudioJack::xrunOccured, this);
+	jack_set_thread_init_callback(m_jackClient, AudioJack::threadInit, this);
+	jack_on_shutdown(m_jackClient, AudioJack::shutdown, this);
 }
 
 void AudioJack::close()
 {
-	int ret;
-	if ((ret = jack_port_unregister(m_jackClient, m_jackPort)) != 0) {
-		std::cout << "### some error on calling jack_port_unregister" << std::endl;
+	if (!m_jackClient)
+		return;
+
+	for (auto port : m_jackPorts) {
+		if (jack_port_unregister(m_jackClient, port) != 0)
+			std::cout << "### some error on calling jack_port_unregister" << std::endl;
 	}
+	m_jackPorts.clear();
 
-	if ((ret = jack_client_close(m_jackClient)) != 0) {
+	if (jack_client_close(m_jackClient) != 0)
 		std::cout << "### some error on calling jack_client_close" << std::endl;
-	}
+
+	m_jackClient = nullptr;
 }
 
 void AudioJack::start()
 {
 	int ret = 0;
 
+	if (!m_jackClient) {
+		std::cout << "### " << __func__ << ": JACK client is not open" << std::endl;
+		return;
+	}
+
+	registerPorts();
 	init();
 
-	if ((ret = jack_set_process_callback(m_jackClient, AudioJack::worker, nullptr)) != 0) {
+	if ((ret = jack_set_process_callback(m_jackClient, AudioJack::worker, this)) != 0) {
 		std::cout << "### some error on calling jack_set_process_callback(" << ret << ")" << std::endl;
 	}
 
+	std::cout << "NlAudioJack Specs: " << std::endl << m_specs;
+
 	if ((ret = jack_activate(m_jackClient)) != 0) {
 		std::cout << "### some error on calling jack_activate" << std::endl;
+		return;
 	}
 
+	connectPhysicalPorts();
 }
 
 void AudioJack::stop()
 {
-	int ret;
-	if ((ret = jack_deactivate(m_jackClient)) != 0) {
+	if (!m_jackClient)
+		return;
+
+	if (jack_deactivate(m_jackClient) != 0) {
 		std::cout << "### some error on calling jack_deaktivate" << std::endl;
 	}
-
 }
 
+/** \ingroup Audio
+ *
+ * \brief Initializes the buffer and the scratch memory for the current JACK setup
+ *
+ * The buffer holds getBufferCount() periodes of the largest periode size of JACK, so
+ * the server can change its periode size later on, without reallocating the buffer
+ * while the producer or consumer on the other side is using it.
+ *
+*/
 void AudioJack::init()
 {
-	m_audioBuffer->init(512);
+	m_specs = getSpecs();
+
+	const unsigned int frames = std::max(m_specs.buffersizeInFramesPerPeriode, JACK_MAX_PERIODE);
+	allocateScratch(frames * m_specs.bytesPerFrame);
+
+	if (m_audioBuffer && !m_callback && !m_floatCallback) {
+		SampleSpecs bufferSpecs = m_specs;
+		bufferSpecs.buffersizeInFrames = frames * m_bufferCount;
+		bufferSpecs.buffersizeInSamples = bufferSpecs.buffersizeInFrames * bufferSpecs.channels;
+		bufferSpecs.buffersizeInBytes = bufferSpecs.buffersizeInFrames * bufferSpecs.bytesPerFrame;
+		m_audioBuffer->init(bufferSpecs);
+	}
+}
+
+/** \ingroup Audio
+ *
+ * \brief Sets the callback, which is called from the JACK process callback
+ * \param callback A callback function of type \ref AudioCallbackOut (or \ref AudioCallbackIn for inputs)
+ * \param ptr User pointer, which is passed to the callback
+ *
+ * For outputs, the callback renders one periode of interleaved float frames. For inputs,
+ * the callback receives one periode. The buffer is not used in that case.
+ * Has to be called before start().
+ *
+*/
+void AudioJack::setCallback(AudioCallbackOut callback, SharedUserPtr ptr)
+{
+	m_callback = callback;
+	m_floatCallback = nullptr;
+	m_userPtr = ptr;
+}
+
+/** \ingroup Audio
+ *
+ * \brief Sets a float callback, which is called from the JACK process callback
+ * \param callback A callback function of type \ref AudioCallbackFloatOut (or \ref AudioCallbackFloatIn for inputs)
+ * \param ptr User pointer, which is passed to the callback
+ *
+ * The callback works on the JACK port buffers directly, one per channel. The buffer is
+ * not used in that case. Has to be called before start().
+ *
+*/
+void AudioJack::setCallback(AudioCallbackFloatOut callback, SharedUserPtr ptr)
+{
+	m_callback = nullptr;
+	m_floatCallback = callback;
+	m_userPtr = ptr;
 }
 
 void AudioJack::setBuffersize(unsigned int buffersize)
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
+	// The periode size is owned by the JACK server, which might serve other clients as well
+	if (m_jackClient && buffersize != getBuffersize())
+		std::cout << __func__ << ": JACK server runs with " << jack_get_buffer_size(m_jackClient)
+				  << " frames per periode, ignoring requested buffersize of " << buffersize << std::endl;
 }
 
 unsigned int AudioJack::getBuffersize()
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
-	return 0;
+	if (!m_jackClient)
+		return 0;
+
+	return jack_get_buffer_size(m_jackClient) * m_bufferCount;
 }
 
 void AudioJack::setBufferCount(unsigned int buffercount)
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
+	m_bufferCount = buffercount > 0 ? buffercount : 1;
 }
 
 unsigned int AudioJack::getBufferCount()
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
-	return 0;
+	return m_bufferCount;
 }
 
 void AudioJack::setSamplerate(samplerate_t rate)
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
+	// The samplerate is owned by the JACK server
+	if (m_jackClient && rate != getSamplerate())
+		std::cout << __func__ << ": JACK server runs at " << getSamplerate()
+				  << " Hz, ignoring requested samplerate of " << rate << " Hz" << std::endl;
 }
 
 samplerate_t AudioJack::getSamplerate() const
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
-	return 0;
+	if (!m_jackClient)
+		return 0;
+
+	return jack_get_sample_rate(m_jackClient);
 }
 
 std::list<sampleformat_t> AudioJack::getAvailableSampleformats() const
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
 	std::list<sampleformat_t> ret;
+	ret.push_back(JACK_SAMPLE_FORMAT);
 	return ret;
 }
 
 sampleformat_t AudioJack::getSampleFormat() const
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
-	return "";
+	return JACK_SAMPLE_FORMAT;
 }
 
 void AudioJack::setSampleFormat(sampleformat_t format)
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
+	if (format != JACK_SAMPLE_FORMAT)
+		std::cout << __func__ << ": JACK only supports " << JACK_SAMPLE_FORMAT << ", ignoring " << format << std::endl;
 }
 
 void AudioJack::setChannelCount(channelcount_t n)
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
+	if (!m_jackPorts.empty()) {
+		std::cout << __func__ << ": Ports are already registered, can not change channel count" << std::endl;
+		return;
+	}
+
+	m_channels = n;
 }
 
 channelcount_t AudioJack::getChannelCount()
 {
-	std::cout << __func__ << ": implement me!" << std::endl;
+	return m_jackPorts.empty() ? m_channels : m_jackPorts.size();
 }
 
 BufferStatistics AudioJack::getStats()
 {
-	//TODO: Implement me!!
+	BufferStatistics ret = {};
+	if (m_audioBuffer)
+		m_audioBuffer->getStat(&ret.bytesReadFromBuffer, &ret.bytesWrittenToBuffer);
+	ret.xrunCount = m_xrunCounter;
+	ret.bufferXrunCount = m_bufferXrunCounter;
+
+	return ret;
+}
+
+/** \ingroup Audio
+ *
+ * \brief Returns the SampleSpecs for the current JACK setup
+ * \return SampleSpecs describing interleaved 32 bit float frames
+ *
+*/
+SampleSpecs AudioJack::getSpecs() const
+{
+	SampleSpecs specs = {};
+
+	const unsigned int periode = m_jackClient ? jack_get_buffer_size(m_jackClient) : 0;
+
+	specs.samplerate = getSamplerate();
+	// The process callback serves the registered ports, which might be less than requested
+	specs.channels = m_jackPorts.empty() ? m_channels : m_jackPorts.size();
+	specs.bytesPerSample = sizeof(jack_default_audio_sample_t);
+	specs.bytesPerSamplePhysical = sizeof(jack_default_audio_sample_t);
+	specs.bytesPerFrame = specs.bytesPerSample * specs.channels;
+
+	specs.buffersizeInFramesPerPeriode = periode;
+	specs.buffersizeInFrames = periode * m_bufferCount;
+	specs.buffersizeInSamplesPerPeriode = specs.buffersizeInFramesPerPeriode * specs.channels;
+	specs.buffersizeInSamples = specs.buffersizeInFrames * specs.channels;
+	specs.buffersizeInBytesPerPeriode = specs.buffersizeInFramesPerPeriode * specs.bytesPerFrame;
+	specs.buffersizeInBytes = specs.buffersizeInFrames * specs.bytesPerFrame;
+
+	specs.isFloat = true;
+	specs.isLittleEndian = true;
+	specs.isSigned = true;
+	specs.isInterleaved = true;
+
+	specs.latency = specs.samplerate ? static_cast<double>(periode) / static_cast<double>(specs.samplerate) * 1000.0 : 0.0;
+
+	return specs;
+}
+
+void AudioJack::registerPorts()
+{
+	if (!m_jackPorts.empty())
+		return;
+
+	for (unsigned int channel=0; channel<m_channels; channel++) {
+		const std::string name = (m_isInput ? "in_" : "out_") + std::to_string(channel + 1);
+		jack_port_t *port = jack_port_register(m_jackClient, name.c_str(), JACK_DEFAULT_AUDIO_TYPE,
+											   m_isInput ? JackPortIsInput : JackPortIsOutput, 0);
+		if (!port) {
+			std::cout << "### some error on calling jack_port_register(" << name << ")" << std::endl;
+			continue;
+		}
+		m_jackPorts.push_back(port);
+	}
+
+	m_portBuffers.resize(m_jackPorts.size(), nullptr);
+}
+
+// Connects our ports to the physical ports of the system, as far as they are available
+void AudioJack::connectPhysicalPorts()
+{
+	const char **physicalPorts = jack_get_ports(m_jackClient, nullptr, JACK_DEFAULT_AUDIO_TYPE,
+												JackPortIsPhysical | (m_isInput ? JackPortIsOutput : JackPortIsInput));
+	if (!physicalPorts)
+		return;
+
+	for (unsigned int i=0; i<m_jackPorts.size() && physicalPorts[i]; i++) {
+		const char *ownPort = jack_port_name(m_jackPorts[i]);
+		int ret = m_isInput ? jack_connect(m_jackClient, physicalPorts[i], ownPort)
+							: jack_connect(m_jackClient, ownPort, physicalPorts[i]);
+		if (ret != 0)
+			std::cout << "### could not connect " << ownPort << " to " << physicalPorts[i] << std::endl;
+	}
+
+	jack_free(physicalPorts);
+}
+
+void AudioJack::allocateScratch(unsigned int size)
+{
+	if (size <= m_scratchSize)
+		return;
+
+	delete[] m_scratch;
+	m_scratch = new u_int8_t[size];
+	m_scratchSize = size;
+	memset(m_scratch, 0, m_scratchSize);
+}
+
+// Exchanges one periode with the buffer, never blocks
+void AudioJack::exchangeWithBuffer(unsigned int bytes)
+{
+	if (!m_audioBuffer) {
+		if (!m_isInput)
+			memset(m_scratch, 0, bytes);
+		return;
+	}
+
+	bool ok = false;
+	if (m_isInput)
+		ok = (!m_audioBuffer->isBlocking() || m_audioBuffer->availableToWrite() >= bytes) && m_audioBuffer->set(m_scratch, bytes);
+	else
+		ok = (!m_audioBuffer->isBlocking() || m_audioBuffer->availableToRead() >= bytes) && m_audioBuffer->get(m_scratch, bytes);
+
+	if (!ok) {
+		if (!m_isInput)
+			memset(m_scratch, 0, bytes);
+		m_bufferXrunCounter++;
+	}
 }
 
 //static
 int AudioJack::worker(jack_nframes_t nframes, void *arg)
 {
 	AudioJack *instance = static_cast<AudioJack*>(arg);
-	bool isInput = instance->m_isInput;
+	const unsigned int channels = instance->m_jackPorts.size();
+	const unsigned int bytes = nframes * channels * sizeof(jack_default_audio_sample_t);
+
+	if (bytes > instance->m_scratchSize || nframes != instance->m_specs.buffersizeInFramesPerPeriode) {
+		// Should not happen, bufferSizeChanged() is called before a new periode size is used
+		for (unsigned int channel=0; channel<channels; channel++)
+			memset(jack_port_get_buffer(instance->m_jackPorts[channel], nframes), 0, nframes * sizeof(jack_default_audio_sample_t));
+		instance->m_bufferXrunCounter++;
+		return 0;
+	}
 
-	unsigned int i;
+	if (instance->m_floatCallback) {
+		for (unsigned int channel=0; channel<channels; channel++)
+			instance->m_portBuffers[channel] = static_cast<jack_default_audio_sample_t*>(jack_port_get_buffer(instance->m_jackPorts[channel], nframes));
+		instance->m_floatCallback(instance->m_portBuffers.data(), nframes, instance->m_specs, instance->m_userPtr);
+		return 0;
+	}
 
-	void* buffer = jack_port_get_buffer(instance->m_jackPort, nframes);
+	jack_default_audio_sample_t *interleaved = reinterpret_cast<jack_default_audio_sample_t*>(instance->m_scratch);
+
+	if (instance->m_isInput) {
+		for (unsigned int channel=0; channel<channels; channel++) {
+			const jack_default_audio_sample_t *port = static_cast<jack_default_audio_sample_t*>(jack_port_get_buffer(instance->m_jackPorts[channel], nframes));
+			for (unsigned int frame=0; frame<nframes; frame++)
+				interleaved[frame * channels + channel] = port[frame];
+		}
+
+		if (instance->m_callback)
+			instance->m_callback(instance->m_scratch, instance->m_specs, instance->m_userPtr);
+		else
+			instance->exchangeWithBuffer(bytes);
+	} else {
+		if (instance->m_callback)
+			instance->m_callback(instance->m_scratch, instance->m_specs, instance->m_userPtr);
+		else
+			instance->exchangeWithBuffer(bytes);
+
+		for (unsigned int channel=0; channel<channels; channel++) {
+			jack_default_audio_sample_t *port = static_cast<jack_default_audio_sample_t*>(jack_port_get_buffer(instance->m_jackPorts[channel], nframes));
+			for (unsigned int frame=0; frame<nframes; frame++)
+				port[frame] = interleaved[frame * channels + channel];
+		}
+	}
 
 	return 0;
+}
 
-	if (isInput)
-		instance->m_audioBuffer->set(static_cast<unsigned char*>(buffer), nframes);
-	else
-		instance->m_audioBuffer->get(static_cast<unsigned char*>(buffer), nframes);
+//static
+int AudioJack::bufferSizeChanged(jack_nframes_t nframes, void *arg)
+{
+	// Called by JACK from a non realtime thread, while no process callback is running
+	AudioJack *instance = static_cast<AudioJack*>(arg);
+	std::cout << "JACK periode size changed to " << nframes << " frames" << std::endl;
+
+	// Scratch memory and buffer are sized for the largest periode in init(), so nothing is reallocated here
+	instance->m_specs = instance->getSpecs();
+	if (instance->m_specs.buffersizeInBytesPerPeriode > instance->m_scratchSize)
+		std::cout << "### JACK periode size exceeds " << JACK_MAX_PERIODE << " frames, periodes are muted" << std::endl;
 
 	return 0;
 }
 
+//static
+int AudioJack::xrunOccured(void *arg)
+{
+	AudioJack *instance = static_cast<AudioJack*>(arg);
+	instance->m_xrunCounter++;
+	return 0;
+}
+
+//static
+void AudioJack::threadInit(void *arg)
+{
+	// Called by JACK in the process thread, before it runs the process callback the first time
+	AudioJack *instance = static_cast<AudioJack*>(arg);
+
+	RealtimePolicy policy = instance->m_realtimePolicy;
+	policy.schedulingClass = SCHED_OTHER;
+	applyRealtimePolicy(policy, instance->m_isInput ? "nlaudio_jack_in" : "nlaudio_jack_out");
+}
+
+//static
+void AudioJack::shutdown(void *arg)
+{
+	AudioJack *instance = static_cast<AudioJack*>(arg);
+	std::cout << "### JACK server shut down, " << (instance->m_isInput ? "input" : "output") << " stopped" << std::endl;
+}
+
 } // namespace Nl
@@ -0,0 +1,502 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#include "audio/sampleconversion.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace Nl {
+
+namespace {
+
+const unsigned int CHUNK_SIZE = 256; ///< Samples, converted in one go on the stack
+
+/** Describes how samples are layed out in the byte stream */
+struct Layout {
+	unsigned int bits;		///< Significant bits per sample
+	unsigned int width;		///< Bytes per sample in the stream, including padding
+	unsigned int frameStep; ///< Bytes per frame in the stream
+	unsigned int sampleStep;	///< Bytes between two samples of one channel
+	unsigned int channelOffset; ///< Bytes between the first samples of two channels
+	bool isFloat;
+	bool isSigned;
+	bool isLittleEndian;
+	float scale;			///< Factor from float to integer
+};
+
+// Non interleaved streams hold one block of frames per channel
+Layout getLayout(const SampleSpecs& sampleSpecs, unsigned int frames)
+{
+	Layout l;
+	l.bits = sampleSpecs.bytesPerSample * 8;
+	l.width = sampleSpecs.bytesPerSamplePhysical > sampleSpecs.bytesPerSample ? sampleSpecs.bytesPerSamplePhysical : sampleSpecs.bytesPerSample;
+	l.frameStep = l.width * sampleSpecs.channels;
+	l.sampleStep = sampleSpecs.isInterleaved ? l.frameStep : l.width;
+	l.channelOffset = sampleSpecs.isInterleaved ? l.width : l.width * frames;
+	l.isFloat = sampleSpecs.isFloat;
+	l.isSigned = sampleSpecs.isSigned;
+	l.isLittleEndian = sampleSpecs.isLittleEndian;
+	// 2^31 - 1 is not representable as float, use the next smaller value for 32 bit
+	l.scale = l.bits >= 32 ? 2147483520.f : static_cast<float>((1u << (l.bits - 1)) - 1);
+	return l;
+}
+
+bool isNativeLittleEndian()
+{
+	return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+}
+
+//****** Float <-> int32 kernels ******//
+
+typedef void (*FloatToIntKernel)(const float* in, int32_t* out, unsigned int n, float scale);
+typedef void (*IntToFloatKernel)(const int32_t* in, float* out, unsigned int n, float scale);
+
+void floatToIntScalar(const float* in, int32_t* out, unsigned int n, float scale)
+{
+	for (unsigned int i=0; i<n; i++) {
+		float sample = in[i];
+		if (sample > 1.f) sample = 1.f;
+		if (sample < -1.f) sample = -1.f;
+		out[i] = static_cast<int32_t>(lrintf(sample * scale));
+	}
+}
+
+void intToFloatScalar(const int32_t* in, float* out, unsigned int n, float scale)
+{
+	for (unsigned int i=0; i<n; i++)
+		out[i] = static_cast<float>(in[i]) * scale;
+}
+
+#if defined(__SSE2__)
+void floatToIntSse2(const float* in, int32_t* out, unsigned int n, float scale)
+{
+	const __m128 vMax = _mm_set1_ps(1.f);
+	const __m128 vMin = _mm_set1_ps(-1.f);
+	const __m128 vScale = _mm_set1_ps(scale);
+
+	unsigned int i = 0;
+	for (; i+4<=n; i+=4) {
+		__m128 x = _mm_loadu_ps(in + i);
+		x = _mm_min_ps(_mm_max_ps(x, vMin), vMax);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_cvtps_epi32(_mm_mul_ps(x, vScale)));
+	}
+	floatToIntScalar(in + i, out + i, n - i, scale);
+}
+
+void intToFloatSse2(const int32_t* in, float* out, unsigned int n, float scale)
+{
+	const __m128 vScale = _mm_set1_ps(scale);
+
+	unsigned int i = 0;
+	for (; i+4<=n; i+=4) {
+		__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+		_mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(x), vScale));
+	}
+	intToFloatScalar(in + i, out + i, n - i, scale);
+}
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2")))
+void floatToIntAvx2(const float* in, int32_t* out, unsigned int n, float scale)
+{
+	const __m256 vMax = _mm256_set1_ps(1.f);
+	const __m256 vMin = _mm256_set1_ps(-1.f);
+	const __m256 vScale = _mm256_set1_ps(scale);
+
+	unsigned int i = 0;
+	for (; i+8<=n; i+=8) {
+		__m256 x = _mm256_loadu_ps(in + i);
+		x = _mm256_min_ps(_mm256_max_ps(x, vMin), vMax);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_cvtps_epi32(_mm256_mul_ps(x, vScale)));
+	}
+	floatToIntScalar(in + i, out + i, n - i, scale);
+}
+
+__attribute__((target("avx2")))
+void intToFloatAvx2(const int32_t* in, float* out, unsigned int n, float scale)
+{
+	const __m256 vScale = _mm256_set1_ps(scale);
+
+	unsigned int i = 0;
+	for (; i+8<=n; i+=8) {
+		__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+		_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(x), vScale));
+	}
+	intToFloatScalar(in + i, out + i, n - i, scale);
+}
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+void floatToIntNeon(const float* in, int32_t* out, unsigned int n, float scale)
+{
+	const float32x4_t vMax = vdupq_n_f32(1.f);
+	const float32x4_t vMin = vdupq_n_f32(-1.f);
+	const float32x4_t vScale = vdupq_n_f32(scale);
+#if !defined(__aarch64__) && !defined(__ARM_FEATURE_DIRECTED_ROUNDING)
+	const float32x4_t vRound = vdupq_n_f32(8388608.f);	// 2^23, from here on every float is an integer
+	const uint32x4_t vSign = vdupq_n_u32(0x80000000u);
+#endif
+
+	unsigned int i = 0;
+	for (; i+4<=n; i+=4) {
+		float32x4_t x = vld1q_f32(in + i);
+		x = vmulq_f32(vminq_f32(vmaxq_f32(x, vMin), vMax), vScale);
+#if defined(__aarch64__) || defined(__ARM_FEATURE_DIRECTED_ROUNDING)
+		vst1q_s32(out + i, vcvtnq_s32_f32(x));
+#else
+		// armv7 only converts by truncation, so round the magnitude to nearest even first like lrintf()
+		// (adding 2^23 drops the fraction), then put the sign back
+		const float32x4_t magnitude = vabsq_f32(x);
+		float32x4_t rounded = vsubq_f32(vaddq_f32(magnitude, vRound), vRound);
+		rounded = vbslq_f32(vcltq_f32(magnitude, vRound), rounded, magnitude);
+		rounded = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(rounded), vandq_u32(vreinterpretq_u32_f32(x), vSign)));
+		vst1q_s32(out + i, vcvtq_s32_f32(rounded));
+#endif
+	}
+	floatToIntScalar(in + i, out + i, n - i, scale);
+}
+
+void intToFloatNeon(const int32_t* in, float* out, unsigned int n, float scale)
+{
+	const float32x4_t vScale = vdupq_n_f32(scale);
+
+	unsigned int i = 0;
+	for (; i+4<=n; i+=4)
+		vst1q_f32(out + i, vmulq_f32(vcvtq_f32_s32(vld1q_s32(in + i)), vScale));
+	intToFloatScalar(in + i, out + i, n - i, scale);
+}
+#endif
+
+FloatToIntKernel selectFloatToInt()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return floatToIntAvx2;
+#endif
+#if defined(__SSE2__)
+	return floatToIntSse2;
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	return floatToIntNeon;
+#else
+	return floatToIntScalar;
+#endif
+}
+
+IntToFloatKernel selectIntToFloat()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return intToFloatAvx2;
+#endif
+#if defined(__SSE2__)
+	return intToFloatSse2;
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	return intToFloatNeon;
+#else
+	return intToFloatScalar;
+#endif
+}
+
+const FloatToIntKernel floatToInt = selectFloatToInt();
+const IntToFloatKernel intToFloat = selectIntToFloat();
+
+//****** int32 <-> bytes ******//
+
+template <unsigned int Width, bool LittleEndian>
+void packSamples(const int32_t* in, u_int8_t* out, unsigned int n, unsigned int step, uint32_t offset)
+{
+	for (unsigned int i=0; i<n; i++, out+=step) {
+		const uint32_t value = static_cast<uint32_t>(in[i]) + offset;
+		for (unsigned int byte=0; byte<Width; byte++)
+			out[byte] = value >> (LittleEndian ? byte*8 : (Width-byte-1)*8);
+	}
+}
+
+template <unsigned int Width, bool LittleEndian>
+void unpackSamples(const u_int8_t* in, int32_t* out, unsigned int n, unsigned int step, unsigned int bits, uint32_t offset)
+{
+	const unsigned int shift = 32 - bits;
+	for (unsigned int i=0; i<n; i++, in+=step) {
+		uint32_t value = 0;
+		for (unsigned int byte=0; byte<Width; byte++)
+			value |= static_cast<uint32_t>(in[byte]) << (LittleEndian ? byte*8 : (Width-byte-1)*8);
+		// Drop padding bits and sign extend
+		out[i] = static_cast<int32_t>((value - offset) << shift) >> shift;
+	}
+}
+
+void pack(const int32_t* in, u_int8_t* out, unsigned int n, unsigned int step, const Layout& l)
+{
+	const uint32_t offset = l.isSigned ? 0 : (1u << (l.bits - 1));
+
+	switch (static_cast<int>(l.width) * (l.isLittleEndian ? 1 : -1)) {
+	case 2: packSamples<2, true>(in, out, n, step, offset); break;
+	case 3: packSamples<3, true>(in, out, n, step, offset); break;
+	case 4: packSamples<4, true>(in, out, n, step, offset); break;
+	case -2: packSamples<2, false>(in, out, n, step, offset); break;
+	case -3: packSamples<3, false>(in, out, n, step, offset); break;
+	case -4: packSamples<4, false>(in, out, n, step, offset); break;
+	default: break;
+	}
+}
+
+void unpack(const u_int8_t* in, int32_t* out, unsigned int n, unsigned int step, const Layout& l)
+{
+	const uint32_t offset = l.isSigned ? 0 : (1u << (l.bits - 1));
+
+	switch (static_cast<int>(l.width) * (l.isLittleEndian ? 1 : -1)) {
+	case 2: unpackSamples<2, true>(in, out, n, step, l.bits, offset); break;
+	case 3: unpackSamples<3, true>(in, out, n, step, l.bits, offset); break;
+	case 4: unpackSamples<4, true>(in, out, n, step, l.bits, offset); break;
+	case -2: unpackSamples<2, false>(in, out, n, step, l.bits, offset); break;
+	case -3: unpackSamples<3, false>(in, out, n, step, l.bits, offset); break;
+	case -4: unpackSamples<4, false>(in, out, n, step, l.bits, offset); break;
+	default: memset(out, 0, n * sizeof(int32_t)); break;
+	}
+}
+
+//****** float <-> float bytes ******//
+
+void packFloats(const float* in, u_int8_t* out, unsigned int n, unsigned int step, const Layout& l)
+{
+	const bool swap = l.isLittleEndian != isNativeLittleEndian();
+
+	for (unsigned int i=0; i<n; i++, out+=step) {
+		float sample = in[i];
+		if (sample > 1.f) sample = 1.f;
+		if (sample < -1.f) sample = -1.f;
+
+		uint32_t value;
+		memcpy(&value, &sample, sizeof(value));
+		if (swap)
+			value = __builtin_bswap32(value);
+		memcpy(out, &value, sizeof(value));
+	}
+}
+
+void unpackFloats(const u_int8_t* in, float* out, unsigned int n, unsigned int step, const Layout& l)
+{
+	const bool swap = l.isLittleEndian != isNativeLittleEndian();
+
+	for (unsigned int i=0; i<n; i++, in+=step) {
+		uint32_t value;
+		memcpy(&value, in, sizeof(value));
+		if (swap)
+			value = __builtin_bswap32(value);
+		memcpy(&out[i], &value, sizeof(value));
+	}
+}
+
+// Converts n contiguous float samples, which are written every step bytes
+void convertFromFloat(const float* in, u_int8_t* out, unsigned int n, unsigned int step, const Layout& l)
+{
+	if (l.isFloat) {
+		packFloats(in, out, n, step, l);
+		return;
+	}
+
+	int32_t tmp[CHUNK_SIZE];
+	for (unsigned int done=0; done<n; done+=CHUNK_SIZE) {
+		const unsigned int count = (n - done) < CHUNK_SIZE ? (n - done) : CHUNK_SIZE;
+		floatToInt(in + done, tmp, count, l.scale);
+		pack(tmp, out + done * step, count, step, l);
+	}
+}
+
+// Same, but the float samples are inStride floats apart. They are gathered chunk wise first.
+void convertFromFloat(const float* in, unsigned int inStride, u_int8_t* out, unsigned int n, unsigned int step, const Layout& l)
+{
+	if (inStride == 1) {
+		convertFromFloat(in, out, n, step, l);
+		return;
+	}
+
+	float tmp[CHUNK_SIZE];
+	for (unsigned int done=0; done<n; done+=CHUNK_SIZE) {
+		const unsigned int count = (n - done) < CHUNK_SIZE ? (n - done) : CHUNK_SIZE;
+		for (unsigned int i=0; i<count; i++)
+			tmp[i] = in[(done + i) * inStride];
+		convertFromFloat(tmp, out + done * step, count, step, l);
+	}
+}
+
+// Converts n samples, which are read every step bytes, to contiguous floats
+void convertToFloat(const u_int8_t* in, float* out, unsigned int n, unsigned int step, const Layout& l)
+{
+	if (l.isFloat) {
+		unpackFloats(in, out, n, step, l);
+		return;
+	}
+
+	const float scale = 1.f / static_cast<float>(1u << (l.bits - 1));
+
+	int32_t tmp[CHUNK_SIZE];
+	for (unsigned int done=0; done<n; done+=CHUNK_SIZE) {
+		const unsigned int count = (n - done) < CHUNK_SIZE ? (n - done) : CHUNK_SIZE;
+		unpack(in + done * step, tmp, count, step, l);
+		intToFloat(tmp, out + done, count, scale);
+	}
+}
+
+// Same, but the float samples are written outStride floats apart
+void convertToFloat(const u_int8_t* in, float* out, unsigned int outStride, unsigned int n, unsigned int step, const Layout& l)
+{
+	if (outStride == 1) {
+		convertToFloat(in, out, n, step, l);
+		return;
+	}
+
+	float tmp[CHUNK_SIZE];
+	for (unsigned int done=0; done<n; done+=CHUNK_SIZE) {
+		const unsigned int count = (n - done) < CHUNK_SIZE ? (n - done) : CHUNK_SIZE;
+		convertToFloat(in + done * step, tmp, count, step, l);
+		for (unsigned int i=0; i<count; i++)
+			out[(done + i) * outStride] = tmp[i];
+	}
+}
+
+} // namespace
+
+/** \ingroup Tools
+ *
+ * \brief Writes interleaved float frames to an audio bytestream
+ * \param out Bytestream of audiodata
+ * \param in Interleaved float samples from -1.0 to 1.0, frames * channels long
+ * \param frames Number of frames to convert
+ * \param sampleSpecs Sample specification of the current setup
+ *
+*/
+void setSamples(u_int8_t* out, const float* in, u_int32_t frames, const SampleSpecs& sampleSpecs)
+{
+	const Layout l = getLayout(sampleSpecs, frames);
+
+	if (sampleSpecs.isInterleaved) {
+		convertFromFloat(in, out, frames * sampleSpecs.channels, l.width, l);
+		return;
+	}
+
+	for (unsigned int channel=0; channel<sampleSpecs.channels; channel++)
+		convertFromFloat(in + channel, sampleSpecs.channels, out + channel * l.channelOffset, frames, l.sampleStep, l);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Writes planar float channels to an audio bytestream
+ * \param out Bytestream of audiodata
+ * \param in One float array per channel, each frames long
+ * \param frames Number of frames to convert
+ * \param sampleSpecs Sample specification of the current setup
+ *
+*/
+void setSamples(u_int8_t* out, const float* const* in, u_int32_t frames, const SampleSpecs& sampleSpecs)
+{
+	const Layout l = getLayout(sampleSpecs, frames);
+	for (unsigned int channel=0; channel<sampleSpecs.channels; channel++)
+		convertFromFloat(in[channel], out + channel * l.channelOffset, frames, l.sampleStep, l);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Writes an AudioBlock to an audio bytestream
+ * \param out Bytestream of audiodata
+ * \param in The samples, one periode of the stream is \a in.frames() long
+ * \param sampleSpecs Sample specification of the current setup
+ *
+ * Channels missing in \a in are written as silence.
+ *
+*/
+void setSamples(u_int8_t* out, const AudioBlock& in, const SampleSpecs& sampleSpecs)
+{
+	const Layout l = getLayout(sampleSpecs, in.frames());
+	const float silence[1] = { 0.f };
+
+	for (unsigned int channel=0; channel<sampleSpecs.channels; channel++) {
+		if (channel < in.channelCount())
+			convertFromFloat(in.channel(channel), in.stride(), out + channel * l.channelOffset, in.frames(), l.sampleStep, l);
+		else
+			convertFromFloat(silence, 0, out + channel * l.channelOffset, in.frames(), l.sampleStep, l);
+	}
+}
+
+/** \ingroup Tools
+ *
+ * \brief Reads interleaved float frames from an audio bytestream
+ * \param in Bytestream of audiodata
+ * \param out Interleaved float samples, frames * channels long
+ * \param frames Number of frames to convert
+ * \param sampleSpecs Sample specification of the current setup
+ *
+*/
+void getSamples(const u_int8_t* in, float* out, u_int32_t frames, const SampleSpecs& sampleSpecs)
+{
+	const Layout l = getLayout(sampleSpecs, frames);
+
+	if (sampleSpecs.isInterleaved) {
+		convertToFloat(in, out, frames * sampleSpecs.channels, l.width, l);
+		return;
+	}
+
+	for (unsigned int channel=0; channel<sampleSpecs.channels; channel++)
+		convertToFloat(in + channel * l.channelOffset, out + channel, sampleSpecs.channels, frames, l.sampleStep, l);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Reads planar float channels from an audio bytestream
+ * \param in Bytestream of audiodata
+ * \param out One float array per channel, each frames long
+ * \param frames Number of frames to convert
+ * \param sampleSpecs Sample specification of the current setup
+ *
+*/
+void getSamples(const u_int8_t* in, float* const* out, u_int32_t frames, const SampleSpecs& sampleSpecs)
+{
+	const Layout l = getLayout(sampleSpecs, frames);
+	for (unsigned int channel=0; channel<sampleSpecs.channels; channel++)
+		convertToFloat(in + channel * l.channelOffset, out[channel], frames, l.sampleStep, l);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Reads an audio bytestream into an AudioBlock
+ * \param in Bytestream of audiodata, one periode of the stream is \a out.frames() long
+ * \param out The samples. Channels of the stream beyond \a out.channelCount() are skipped.
+ * \param sampleSpecs Sample specification of the current setup
+ *
+*/
+void getSamples(const u_int8_t* in, const AudioBlock& out, const SampleSpecs& sampleSpecs)
+{
+	const Layout l = getLayout(sampleSpecs, out.frames());
+	const unsigned int channels = sampleSpecs.channels < out.channelCount() ? sampleSpecs.channels : out.channelCount();
+
+	for (unsigned int channel=0; channel<channels; channel++)
+		convertToFloat(in + channel * l.channelOffset, out.channel(channel), out.stride(), out.frames(), l.sampleStep, l);
+}
+
+} // namespace Nl
@@ -19,6 +19,7 @@
 
 
 #include <iostream>
+#include <cstring>
 
 #include "audio/samplespecs.h"
 
@@ -38,10 +39,16 @@ namespace Nl {
 */
 unsigned int getByteIndex(unsigned int frameIndex, unsigned int channel, unsigned int byte, const SampleSpecs &sampleSpecs)
 {
+	const unsigned int bytesPerSample = sampleSpecs.bytesPerFrame/sampleSpecs.channels;
+
+	// Non interleaved: Each periode holds one block of frames per channel
+	if (!sampleSpecs.isInterleaved)
+		return (channel*sampleSpecs.buffersizeInFramesPerPeriode*bytesPerSample) + (frameIndex*bytesPerSample) + byte;
+
 	return	// Index of current Frame
-			(frameIndex*sampleSpecs.channels*sampleSpecs.bytesPerSample) +
+			(frameIndex*sampleSpecs.bytesPerFrame) +
 			// Index of current channel in Frame (= Sample)
-			(channel*sampleSpecs.bytesPerSample) +
+			(channel*bytesPerSample) +
 			// Index of current byte in Sample
 			byte;
 }
@@ -67,6 +74,13 @@ float getSample(u_int8_t* in, u_int32_t frameIndex, u_int32_t channel, const Sam
 	if (channel > sampleSpecs.channels)
 		return 0.f;
 
+	// Native float, as used by JACK
+	if (sampleSpecs.isFloat && sampleSpecs.bytesPerSample == sizeof(float)) {
+		float currentSample;
+		memcpy(&currentSample, &in[getByteIndex(frameIndex, channel, 0, sampleSpecs)], sizeof(float));
+		return currentSample;
+	}
+
 	if (sampleSpecs.isSigned) {
 
 		signed int currentSample = 0;
@@ -124,6 +138,12 @@ void setSample(u_int8_t* out, float sample, u_int32_t frameIndex, u_int32_t chan
 	if (sample > 1.0) sample = 1.0;
 	if (sample < -1.0) sample = -1.0;
 
+	// Native float, as used by JACK
+	if (sampleSpecs.isFloat && sampleSpecs.bytesPerSample == sizeof(float)) {
+		memcpy(&out[getByteIndex(frameIndex, channel, 0, sampleSpecs)], &sample, sizeof(float));
+		return;
+	}
+
 	if (sampleSpecs.isSigned) {
 
 		int32_t currentMask = 0;
@@ -219,6 +239,7 @@ std::ostream& operator<<(std::ostream& lhs, const SampleSpecs& rhs)
 		   "isLittleEndian:                    " << rhs.isLittleEndian << std::endl <<
 		   "isFloat                            " << rhs.isFloat << std::endl <<
 		   "isSigned:                          " << rhs.isSigned << std::endl <<
+		   "isInterleaved:                     " << rhs.isInterleaved << std::endl <<
 		   "latency:                           " << rhs.latency << " ms" << std::endl;
 	return lhs;
 }
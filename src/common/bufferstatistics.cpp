@@ -40,7 +40,8 @@ std::ostream& operator<<(std::ostream& lhs, const BufferStatistics& rhs)
 {
 	lhs << "  Bytes Read From Buffer:   " << rhs.bytesReadFromBuffer << std::endl
 		<< "  Bytes Written To Buffer:  " << rhs.bytesWrittenToBuffer << std::endl
-		<< "  Over-/Underrun Count:     " << rhs.xrunCount << std::endl;
+		<< "  Over-/Underrun Count:     " << rhs.xrunCount << std::endl
+		<< "  Buffer Xrun Count:        " << rhs.bufferXrunCount << std::endl;
 
 	return lhs;
 }
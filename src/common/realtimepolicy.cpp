@@ -0,0 +1,157 @@
+/***
+  Copyright (c) 2018 Nonlinear Labs GmbH
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+***/
+
+#include "common/realtimepolicy.h"
+
+#include <iostream>
+#include <algorithm>
+#include <mutex>
+#include <cstring>
+#include <cerrno>
+#include <alloca.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+namespace Nl {
+
+namespace {
+
+const char* schedulingClassName(int schedulingClass)
+{
+	switch (schedulingClass) {
+	case SCHED_FIFO: return "SCHED_FIFO";
+	case SCHED_RR: return "SCHED_RR";
+	case SCHED_OTHER: return "SCHED_OTHER";
+	default: return "unknown";
+	}
+}
+
+// Locking is process wide, so it is done once and the result is remembered
+bool lockMemoryOnce()
+{
+	static std::once_flag flag;
+	static bool locked = false;
+
+	std::call_once(flag, []() {
+		if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+			std::cout << "### RealtimePolicy: mlockall failed: " << strerror(errno)
+					  << " (check the memlock limit in /etc/security/limits.conf)" << std::endl;
+		else
+			locked = true;
+	});
+
+	return locked;
+}
+
+// Touches size bytes of stack below the caller, so the pages are mapped before the real work starts
+__attribute__((noinline)) void prefaultStack(size_t size)
+{
+	unsigned char *stack = static_cast<unsigned char*>(alloca(size));
+	memset(stack, 0, size);
+	// Keep the compiler from removing the memset
+	asm volatile("" : : "r"(stack) : "memory");
+}
+
+} // namespace
+
+/** \ingroup Tools
+ *
+ * \brief Applies a RealtimePolicy to the calling thread
+ * \param policy The policy to apply
+ * \param threadName Name of the thread, used for reports and set as thread name (max 15 chars are used)
+ * \return true, if every part of the policy could be applied
+ *
+ * Sets the scheduling class and priority, the CPU affinity, locks the memory of the process
+ * and prefaults the stack, as requested by \a policy. Every failure is reported on std::cout,
+ * the thread continues with whatever could be applied. Has to be called by the thread itself,
+ * before it enters its loop.
+ *
+*/
+bool applyRealtimePolicy(const RealtimePolicy &policy, const std::string &threadName)
+{
+	if (policy.isDefault())
+		return true;
+
+	bool ok = true;
+
+	pthread_setname_np(pthread_self(), threadName.substr(0, 15).c_str());
+
+	if (policy.lockMemory)
+		ok &= lockMemoryOnce();
+
+	if (!policy.cpus.empty()) {
+		cpu_set_t cpuset;
+		CPU_ZERO(&cpuset);
+		for (int cpu : policy.cpus)
+			CPU_SET(cpu, &cpuset);
+
+		int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+		if (ret != 0) {
+			std::cout << "### RealtimePolicy: " << threadName << ": could not set cpu affinity: " << strerror(ret) << std::endl;
+			ok = false;
+		}
+	}
+
+	if (policy.schedulingClass != SCHED_OTHER) {
+		struct sched_param param;
+		const int minPriority = sched_get_priority_min(policy.schedulingClass);
+		const int maxPriority = sched_get_priority_max(policy.schedulingClass);
+		param.sched_priority = std::min(std::max(policy.priority, minPriority), maxPriority);
+
+		int ret = pthread_setschedparam(pthread_self(), policy.schedulingClass, &param);
+		if (ret != 0) {
+			std::cout << "### RealtimePolicy: " << threadName << ": could not switch to " << schedulingClassName(policy.schedulingClass)
+					  << " with priority " << param.sched_priority << ": " << strerror(ret)
+					  << (ret == EPERM ? " (check the rtprio limit in /etc/security/limits.conf)" : "") << std::endl;
+			ok = false;
+		}
+	}
+
+	if (policy.prefaultStackSize)
+		prefaultStack(policy.prefaultStackSize);
+
+	std::cout << "RealtimePolicy: " << threadName << ": " << policy << (ok ? "" : " (partially applied)") << std::endl;
+
+	return ok;
+}
+
+/** \ingroup Tools
+ *
+ * \brief Prints a RealtimePolicy
+ *
+*/
+std::ostream& operator<<(std::ostream& lhs, const RealtimePolicy& rhs)
+{
+	lhs << schedulingClassName(rhs.schedulingClass);
+	if (rhs.schedulingClass != SCHED_OTHER)
+		lhs << " priority " << rhs.priority;
+
+	if (!rhs.cpus.empty()) {
+		lhs << ", cpus";
+		for (int cpu : rhs.cpus)
+			lhs << " " << cpu;
+	}
+
+	if (rhs.lockMemory)
+		lhs << ", memory locked";
+	if (rhs.prefaultStackSize)
+		lhs << ", " << rhs.prefaultStackSize / 1024 << " KiB stack prefaulted";
+
+	return lhs;
+}
+
+} // namespace Nl
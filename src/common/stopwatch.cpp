@@ -18,24 +18,248 @@
 ***/
 
 #include "common/stopwatch.h"
+#include <algorithm>
 #include <iomanip>
+#include <limits>
 
 namespace Nl {
 
+namespace {
+
+/** One running measurement of the calling thread */
+struct OpenScope {
+    StopWatch *stopWatch;
+    StopWatch::ScopeId scope;
+    std::chrono::steady_clock::time_point start;
+};
+
+/** Per thread stack of running measurements, so start() and stop() can nest and never share state between threads */
+struct ScopeStack {
+    std::array<OpenScope, StopWatch::MAX_NESTING> entries;
+    unsigned int depth;
+};
+
+thread_local ScopeStack t_scopeStack = {};
+
+const uint64_t NO_MIN = std::numeric_limits<uint64_t>::max();
+
+} // namespace
+
+/** \ingroup Tools
+ *
+ * \brief Constructor
+ *
+ * Creates an empty Snapshot
+ *
+*/
+LatencyHistogram::Snapshot::Snapshot() :
+    buckets(),
+    count(0),
+    sum(0),
+    min(NO_MIN),
+    max(0),
+    deadlineMisses(0)
+{
+}
+
+/** \ingroup Tools
+ *
+ * \brief Adds another Snapshot to this one
+ * \param other Snapshot, whose values are added
+ *
+*/
+void LatencyHistogram::Snapshot::add(const Snapshot &other)
+{
+    for (unsigned int i=0; i<BUCKETS; i++)
+        buckets[i] += other.buckets[i];
+
+    count += other.count;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    deadlineMisses += other.deadlineMisses;
+}
+
+/** \ingroup Tools
+ *
+ * \brief Returns a percentile of the recorded durations
+ * \param p Percentile in the range 0.0 - 100.0
+ * \return Upper bound of the bucket, which contains the percentile, in nanoseconds
+ *
+ * The result is never larger than the largest recorded duration.
+ *
+*/
+uint64_t LatencyHistogram::Snapshot::percentile(double p) const
+{
+    if (count == 0)
+        return 0;
+
+    const double rank = static_cast<double>(count) * std::min(std::max(p, 0.0), 100.0) / 100.0;
+    uint64_t cumulative = 0;
+
+    for (unsigned int i=0; i<BUCKETS; i++) {
+        cumulative += buckets[i];
+        if (cumulative > 0 && static_cast<double>(cumulative) >= rank)
+            return std::min(std::max(bucketUpperBound(i), min), max);
+    }
+
+    return max;
+}
+
 /** \ingroup Tools
  *
  * \brief Constructor
- * \param sw Pointer to \ref StopWatch object
- * \param name Name of timestamp
+ *
+ * Creates an empty histogram
+ *
+*/
+LatencyHistogram::LatencyHistogram() :
+    m_buckets(),
+    m_count(0),
+    m_sum(0),
+    m_min(NO_MIN),
+    m_max(0),
+    m_deadlineMisses(0)
+{
+    for (auto &bucket : m_buckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Records one duration
+ * \param ns Duration in nanoseconds
+ * \param deadlineMissed true, if the duration was above the deadline
+ *
+ * Wait free, as long as only one thread records into the histogram, and lock free otherwise.
+ * Safe to call on the audio thread.
+ *
+*/
+void LatencyHistogram::record(uint64_t ns, bool deadlineMissed)
+{
+    m_buckets[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(ns, std::memory_order_relaxed);
+
+    if (deadlineMissed)
+        m_deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t current = m_min.load(std::memory_order_relaxed);
+    while (ns < current && !m_min.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {}
+
+    current = m_max.load(std::memory_order_relaxed);
+    while (ns > current && !m_max.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {}
+}
+
+/** \ingroup Tools
+ *
+ * \brief Moves all recorded values into a Snapshot
+ * \param snapshot Snapshot, the values are added to
+ *
+ * The histogram is empty afterwards. Values recorded concurrently either end up in this
+ * or in the next Snapshot, so count and buckets might differ by a few values.
+ *
+*/
+void LatencyHistogram::drainTo(Snapshot &snapshot)
+{
+    Snapshot drained;
+
+    for (unsigned int i=0; i<BUCKETS; i++)
+        drained.buckets[i] = m_buckets[i].exchange(0, std::memory_order_relaxed);
+
+    drained.count = m_count.exchange(0, std::memory_order_relaxed);
+    drained.sum = m_sum.exchange(0, std::memory_order_relaxed);
+    drained.min = m_min.exchange(NO_MIN, std::memory_order_relaxed);
+    drained.max = m_max.exchange(0, std::memory_order_relaxed);
+    drained.deadlineMisses = m_deadlineMisses.exchange(0, std::memory_order_relaxed);
+
+    snapshot.add(drained);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Returns the bucket for a duration
+ * \param ns Duration in nanoseconds
+ * \return Index of the bucket in the range 0 - BUCKETS-1
+ *
+ * Values below SUB_BUCKETS get their own bucket, each following power of two is split
+ * into SUB_BUCKETS linear buckets.
+ *
+*/
+unsigned int LatencyHistogram::bucketIndex(uint64_t ns)
+{
+    if (ns < SUB_BUCKETS)
+        return static_cast<unsigned int>(ns);
+
+    const unsigned int exponent = 63 - __builtin_clzll(ns);
+    const unsigned int sub = (ns >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    const unsigned int index = (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+
+    return std::min(index, BUCKETS - 1);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Returns the smallest duration of a bucket
+ * \param index Index of the bucket
+ * \return Duration in nanoseconds
+ *
+*/
+uint64_t LatencyHistogram::bucketLowerBound(unsigned int index)
+{
+    if (index < SUB_BUCKETS)
+        return index;
+
+    const unsigned int exponent = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    return static_cast<uint64_t>(SUB_BUCKETS + index % SUB_BUCKETS) << (exponent - SUB_BUCKET_BITS);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Returns the largest duration of a bucket
+ * \param index Index of the bucket
+ * \return Duration in nanoseconds
+ *
+*/
+uint64_t LatencyHistogram::bucketUpperBound(unsigned int index)
+{
+    if (index >= BUCKETS - 1)
+        return std::numeric_limits<uint64_t>::max();
+
+    return bucketLowerBound(index + 1) - 1;
+}
+
+/** \ingroup Tools
+ *
+ * \brief Constructor
+ * \param sw Reference to \ref StopWatch object
+ * \param scope Scope, as returned by StopWatch::scope()
  *
  * Calls StopWatch::start() in a RAII fashion.
  *
 */
-StopBlockTime::StopBlockTime(std::shared_ptr<StopWatch> sw, std::string name = "noname") :
-    m_currentStopWatch(sw)
+StopBlockTime::StopBlockTime(StopWatch &sw, uint16_t scope) :
+    m_currentStopWatch(&sw)
+{
+    m_currentStopWatch->start(scope);
+}
+
+/** \ingroup Tools
+ *
+ * \brief Constructor
+ * \param sw Pointer to \ref StopWatch object, might be empty
+ * \param scope Scope, as returned by StopWatch::scope()
+ *
+ * Calls StopWatch::start() in a RAII fashion. The shared pointer is not copied, so no
+ * reference count is touched on the audio thread. The caller has to keep the StopWatch
+ * alive, as long as this object exists.
+ *
+*/
+StopBlockTime::StopBlockTime(const std::shared_ptr<StopWatch> &sw, uint16_t scope) :
+    m_currentStopWatch(sw.get())
 {
     if (m_currentStopWatch)
-        m_currentStopWatch->start(name);
+        m_currentStopWatch->start(scope);
 }
 
 /** \ingroup Tools
@@ -56,72 +280,117 @@ StopBlockTime::~StopBlockTime()
 /** \ingroup Tools
  *
  * \brief Constructor
+ * \param name Name of the StopWatch, used for printing
+ * \param m Print mode, see \ref Mode
+ * \param deadline Durations above this value are counted as deadline misses. 0 disables counting.
  *
  * Creates a StopWatch object
  *
 */
-StopWatch::StopWatch(const std::string &name, uint32_t windowSize, Mode m) :
-    m_mutex(),
-    m_timestamps(),
-    m_currentTimeStamp(),
-    m_waitingForStop(false),
+StopWatch::StopWatch(const std::string &name, Mode m, std::chrono::nanoseconds deadline) :
+    m_scopeMutex(),
+    m_scopes(),
+    m_scopeCount(0),
+    m_deadlineNs(static_cast<uint64_t>(deadline.count())),
+    m_unbalancedCount(0),
     m_name(name),
-    m_windowSize(windowSize),
     m_mode(m)
 {
 }
 
+/** \ingroup Tools
+ *
+ * \brief Returns the ScopeId for a name
+ * \param name Name of the scope
+ * \return ScopeId, which can be passed to start() and StopBlockTime
+ *
+ * The same name always returns the same ScopeId. This function locks and might allocate,
+ * so it should be called once, outside the audio thread. If all MAX_SCOPES are in use, the
+ * last one is shared by all further names.
+ *
+*/
+StopWatch::ScopeId StopWatch::scope(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(m_scopeMutex);
+
+    const unsigned int count = m_scopeCount.load(std::memory_order_relaxed);
+    for (unsigned int i=0; i<count; i++) {
+        if (m_scopes[i].name == name)
+            return static_cast<ScopeId>(i);
+    }
+
+    if (count >= MAX_SCOPES) {
+        std::cout << "ERR: " << "StopWatch [" << m_name << "]: Too many scopes. Recording "
+                  << name << " as " << m_scopes[MAX_SCOPES - 1].name << "!" << std::endl;
+        return static_cast<ScopeId>(MAX_SCOPES - 1);
+    }
+
+    m_scopes[count].name = name;
+    m_scopeCount.store(count + 1, std::memory_order_release);
+
+    return static_cast<ScopeId>(count);
+}
+
 /** \ingroup Tools
  *
  * \brief Set start timestamp to now.
- * \param name Name of timestamp
+ * \param scope Scope, as returned by scope()
  *
- * Sets the start point for a duration to now.
- * \ref StopBlockTime provides a RAII style interface for the same purpos.
+ * Sets the start point for a duration to now. Calls can be nested, each stop() ends the
+ * most recent start() of the calling thread.
+ * \ref StopBlockTime provides a RAII style interface for the same purpose.
  *
 */
-void StopWatch::start(const std::string &name)
+void StopWatch::start(ScopeId scope)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    ScopeStack &stack = t_scopeStack;
 
-    if (m_waitingForStop) {
-        std::cout << "ERR: " << "Unbalanced start()/stop(). Ignoring start()!" << std::endl;
+    if (stack.depth >= MAX_NESTING || scope >= m_scopeCount.load(std::memory_order_acquire)) {
+        m_unbalancedCount.fetch_add(1, std::memory_order_relaxed);
         return;
     }
 
-    m_currentTimeStamp.start = std::chrono::high_resolution_clock::now();
-    m_currentTimeStamp.name = name;
-
-    m_waitingForStop = true;
+    OpenScope &entry = stack.entries[stack.depth++];
+    entry.stopWatch = this;
+    entry.scope = scope;
+    entry.start = std::chrono::steady_clock::now();
 }
+
 /** \ingroup Tools
  *
  * \brief Set stop timestamp to now.
  *
- * Sets the stop point for a duration to now.
- * \ref StopBlockTime provides a RAII style interface for the same purpos.
+ * Sets the stop point for a duration to now and records the duration in the histogram of
+ * its scope. Does not lock and does not allocate.
+ * \ref StopBlockTime provides a RAII style interface for the same purpose.
  *
 */
 void StopWatch::stop()
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto now = std::chrono::steady_clock::now();
+    ScopeStack &stack = t_scopeStack;
 
-    if (!m_waitingForStop) {
-        std::cout << "ERR: " << "Unbalanced start()/stop(). Ignoring stop()!" << std::endl;
+    if (stack.depth == 0 || stack.entries[stack.depth - 1].stopWatch != this) {
+        m_unbalancedCount.fetch_add(1, std::memory_order_relaxed);
         return;
     }
 
-    m_currentTimeStamp.stop = std::chrono::high_resolution_clock::now();
-
-    // Do moving window, if 10000 values are reached
-    if (m_timestamps.size() >= 10000)
-        m_timestamps.pop();
-
-    // Protect by mutex
-    m_timestamps.push(m_currentTimeStamp);
+    const OpenScope &entry = stack.entries[--stack.depth];
+    const uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - entry.start).count());
+    const uint64_t deadline = m_deadlineNs.load(std::memory_order_relaxed);
 
+    m_scopes[entry.scope].histogram.record(ns, deadline != 0 && ns > deadline);
+}
 
-    m_waitingForStop = false;
+/** \ingroup Tools
+ *
+ * \brief Sets the deadline
+ * \param deadline Durations above this value are counted as deadline misses. 0 disables counting.
+ *
+*/
+void StopWatch::setDeadline(std::chrono::nanoseconds deadline)
+{
+    m_deadlineNs.store(static_cast<uint64_t>(deadline.count()), std::memory_order_relaxed);
 }
 
 /** \ingroup Tools
@@ -130,51 +399,58 @@ void StopWatch::stop()
  * \param rhs A stream of type \ref std::ostream where data is written to.
  * \return A stream of type \ref std::ostream containing new data.
  *
- * This function prints a detailed list, oder a summery, dependent on \ref Mode
+ * This function drains the histograms of all scopes and prints a summary per scope,
+ * and the histogram itself, dependent on \ref Mode. Has to be called from a non real
+ * time thread.
  *
 */
 std::ostream& StopWatch::print(std::ostream& rhs)
 {
-    if (m_mode == SUMMARY)
-        return printSummary(rhs);
+    const unsigned int count = m_scopeCount.load(std::memory_order_acquire);
+    const uint64_t deadline = m_deadlineNs.load(std::memory_order_relaxed);
+
+    rhs << "Timing: [" << m_name << "]";
+    if (deadline)
+        rhs << " deadline=" << std::setiosflags(std::ios::fixed) << std::setprecision(2) << deadline / 1000.0 << "us";
+    rhs << std::endl;
+
+    for (unsigned int i=0; i<count; i++) {
+        LatencyHistogram::Snapshot snapshot;
+        m_scopes[i].histogram.drainTo(snapshot);
+
+        if (m_mode == SUMMARY)
+            printSummary(rhs, m_scopes[i].name, snapshot);
+        else
+            printDetailed(rhs, m_scopes[i].name, snapshot);
+    }
 
-    return printDetailed(rhs);
+    const uint64_t unbalanced = m_unbalancedCount.exchange(0, std::memory_order_relaxed);
+    if (unbalanced)
+        rhs << "ERR: " << "Unbalanced start()/stop(): " << unbalanced << " calls ignored!" << std::endl;
+
+    return rhs;
 }
 
 /** \ingroup Tools
  *
- * \brief Prints a detailed list with all timestamps
+ * \brief Prints the summary and all non empty buckets of a scope
  * \param rhs A stream of type \ref std::ostream where data is written to.
+ * \param name Name of the scope
+ * \param snapshot Drained histogram of the scope
  * \return A stream of type \ref std::ostream containing new data.
  *
- * This function prints a list with all start, stop and duration times.
- *
 */
-std::ostream& StopWatch::printDetailed(std::ostream &rhs)
+std::ostream& StopWatch::printDetailed(std::ostream &rhs, const std::string &name, const LatencyHistogram::Snapshot &snapshot)
 {
-    //TODO: Make this print the whole buffer with all details.
-    //      Not used right now.
-
-    // Create an new empty copy and swap with the full one.
-    m_mutex.lock();
-    std::queue<Timestamp> workCopy;
-    std::swap(m_timestamps, workCopy);
-    m_mutex.unlock();
-
-    while (!workCopy.empty()) {
-        Timestamp cur = workCopy.front();
-        workCopy.pop();
-
-        int delta_us = std::chrono::duration_cast<std::chrono::microseconds>(cur.stop-cur.start).count();
-
-        std::cout << cur.name
-                  << "  "
-                     //<< std::chrono::system_clock::to_time_t(cur.start)
-                     //<< std::put_time(std::chrono::system_clock::to_time_t(cur.start), "%F %T")
-                     //<< "  "
-                     //<< std::put_time(std::chrono::system_clock::to_time_t(cur.stop), "%F %T")
-                  << "  "
-                  << delta_us <<  " us" << std::endl;
+    printSummary(rhs, name, snapshot);
+
+    for (unsigned int i=0; i<LatencyHistogram::BUCKETS; i++) {
+        if (snapshot.buckets[i] == 0)
+            continue;
+
+        rhs << std::setiosflags(std::ios::fixed) << std::setprecision(3)
+            << "  " << std::setw(12) << LatencyHistogram::bucketLowerBound(i) / 1000.0 << "us "
+            << snapshot.buckets[i] << std::endl;
     }
 
     return rhs;
@@ -182,55 +458,30 @@ std::ostream& StopWatch::printDetailed(std::ostream &rhs)
 
 /** \ingroup Tools
  *
- * \brief Prints a summary of all timestamps
+ * \brief Prints a summary of a scope
  * \param rhs A stream of type \ref std::ostream where data is written to.
+ * \param name Name of the scope
+ * \param snapshot Drained histogram of the scope
  * \return A stream of type \ref std::ostream containing new data.
  *
- * This function prints a summary of start, stop and duration times and empties the queue.
+ * Prints count, min, mean, p50, p99, p99.9 and max in microseconds, and the number of deadline misses.
  *
 */
-std::ostream& StopWatch::printSummary(std::ostream &rhs)
+std::ostream& StopWatch::printSummary(std::ostream &rhs, const std::string &name, const LatencyHistogram::Snapshot &snapshot)
 {
-    // Create an new empty copy and swap with the full one.
-    m_mutex.lock();
-    std::queue<Timestamp> workCopy;
-    std::swap(m_timestamps, workCopy);
-    m_mutex.unlock();
-
-    unsigned long itemCount = workCopy.size();
-    unsigned long sum = 0;
-    unsigned int min = std::numeric_limits<unsigned int>::max();
-    unsigned int max = 0;
-    std::string minName = "";
-    std::string maxName = "";
-
-    while (!workCopy.empty()) {
-        Timestamp cur = workCopy.front();
-        workCopy.pop();
-
-        unsigned int delta_us = std::chrono::duration_cast<std::chrono::microseconds>(cur.stop-cur.start).count();
-        sum += delta_us;
-
-        if (delta_us < min) {
-            min = delta_us;
-            minName = cur.name;
-        }
-
-        if (delta_us > max) {
-            max = delta_us;
-            maxName = cur.name;
-        }
-    }
+    rhs << "[" << name << "] values=" << snapshot.count;
 
-    double mean = static_cast<double>(sum) / static_cast<double>(itemCount);
+    if (snapshot.count == 0)
+        return rhs << std::endl;
 
     rhs << std::setiosflags(std::ios::fixed) << std::setprecision(2)
-        << "Timing: [" << m_name << "] " << std::endl
-        << "values=" << itemCount << " "
-        << "sum=" << sum << "us "
-        << "min[" << minName << "]=" << min << "us "
-        << "max[" << maxName << "]=" << max << "us "
-        << "mean=" << mean << "us" << std::endl;
+        << " min=" << snapshot.min / 1000.0 << "us"
+        << " mean=" << snapshot.mean() / 1000.0 << "us"
+        << " p50=" << snapshot.percentile(50.0) / 1000.0 << "us"
+        << " p99=" << snapshot.percentile(99.0) / 1000.0 << "us"
+        << " p99.9=" << snapshot.percentile(99.9) / 1000.0 << "us"
+        << " max=" << snapshot.max / 1000.0 << "us"
+        << " misses=" << snapshot.deadlineMisses << std::endl;
 
     return rhs;
 }
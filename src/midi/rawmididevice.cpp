@@ -35,7 +35,7 @@ namespace Nl {
  * Constructor for RawMidiDevice
  *
 */
-RawMidiDevice::RawMidiDevice(const AlsaMidiCardIdentifier &card, std::shared_ptr<BlockingCircularBuffer<uint8_t>> buffer) :
+RawMidiDevice::RawMidiDevice(const AlsaMidiCardIdentifier &card, SharedBufferHandle buffer) :
 	m_handle(nullptr),
 	m_params(nullptr),
 	m_card(card),
@@ -93,6 +93,20 @@ void RawMidiDevice::start()
 	m_thread = new std::thread(RawMidiDevice::worker, this);
 }
 
+/** \ingroup Midi
+ *
+ * \brief Start the interface with a RealtimePolicy
+ * \param policy The policy, the worker thread applies to itself
+ *
+ * Same as start(), but the worker thread is configured by \a policy first.
+ *
+*/
+void RawMidiDevice::start(const RealtimePolicy &policy)
+{
+	setRealtimePolicy(policy);
+	start();
+}
+
 /** \ingroup Midi
  *
  * \brief Stop the interface
@@ -118,6 +132,8 @@ void RawMidiDevice::stop()
 */
 void RawMidiDevice::worker(RawMidiDevice *ptr)
 {
+	applyRealtimePolicy(ptr->m_realtimePolicy, "nlaudio_midi");
+
 	const int buffersize = ptr->m_buffersize;
 
     uint8_t buffer[buffersize] = {0};